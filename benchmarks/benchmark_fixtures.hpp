@@ -0,0 +1,488 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_BENCHMARKS_BENCHMARK_FIXTURES_HPP_
+#define LINALG_BENCHMARKS_BENCHMARK_FIXTURES_HPP_
+
+// Benchmarks currently use parentheses (e.g., A(i,j))
+// for the array access operator,
+// instead of square brackets (e.g., A[i,j]).
+// This must be defined before including any mdspan headers.
+#define MDSPAN_USE_PAREN_OPERATOR 1
+
+#include <mdspan/mdspan.hpp>
+#include "experimental/__p2630_bits/submdspan.hpp"
+#include <experimental/linalg>
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Every benchmark is named algorithm/type/layout/accessor/backend, and
+// takes the problem size n as its argument: the length of the vectors
+// for the BLAS 1 vector algorithms, and the extents of the n x n
+// matrices for the rest.  Each reports the rate of floating-point
+// operations ("flops", so that 12G/s is 12 GFLOP/s) and of the least
+// memory traffic the algorithm needs ("bytes", in GB/s).  A complex
+// multiply-add counts as 8 flops.
+//
+// Each algorithm runs on every element type, every layout, and every
+// accessor, one dimension at a time: every element type with the
+// first layout and the default accessor; every layout with double;
+// and the scaled and conjugated accessors on the input operands, with
+// double and std::complex<double>.  Each of those runs on every
+// backend, so that the backends of a configuration sit side by side
+// in the output.  Use --benchmark_filter to pick some, for example
+// --benchmark_filter='^matrix_product/double/.*/default/'.
+
+namespace linalg_benchmarks {
+
+namespace MdSpan = MDSPAN_IMPL_STANDARD_NAMESPACE;
+namespace LinearAlgebra = MDSPAN_IMPL_STANDARD_NAMESPACE :: MDSPAN_IMPL_PROPOSED_NAMESPACE :: linalg;
+
+using MdSpan::dextents;
+using MdSpan::layout_left;
+using MdSpan::layout_right;
+using MdSpan::layout_stride;
+using MdSpan::mdspan;
+
+template<class... Ts>
+struct type_list {};
+
+template<class T>
+struct type_tag {
+  using type = T;
+};
+
+// f(type_tag<T>{}) for each T in the list.
+template<class... Ts, class F>
+void for_each_type(type_list<Ts...>, F&& f)
+{
+  (f(type_tag<Ts>{}), ...);
+}
+
+////////////////////////////////////////////////////////////
+// Element types
+////////////////////////////////////////////////////////////
+
+using element_types =
+  type_list<float, double, std::complex<float>, std::complex<double>>;
+
+template<class T> inline constexpr const char* type_name = "";
+template<> inline constexpr const char* type_name<float> = "float";
+template<> inline constexpr const char* type_name<double> = "double";
+template<> inline constexpr const char* type_name<std::complex<float>> = "cfloat";
+template<> inline constexpr const char* type_name<std::complex<double>> = "cdouble";
+
+template<class T> inline constexpr bool is_complex_v = false;
+template<class R> inline constexpr bool is_complex_v<std::complex<R>> = true;
+
+template<class T>
+using real_t = decltype(std::abs(T{}));
+
+// Real flops in one addition, multiplication, or multiply-add of Ts.
+template<class T> inline constexpr double add_flops = is_complex_v<T> ? 2.0 : 1.0;
+template<class T> inline constexpr double mul_flops = is_complex_v<T> ? 6.0 : 1.0;
+template<class T> inline constexpr double madd_flops = is_complex_v<T> ? 8.0 : 2.0;
+// Real flops in one multiplication of a T by a real number.
+template<class T> inline constexpr double real_mul_flops = is_complex_v<T> ? 2.0 : 1.0;
+
+// Values in [-1, 1], none of them zero, so that the algorithms do the
+// same work they would on real data.
+template<class T>
+T bench_value(std::size_t k)
+{
+  const auto part = [] (std::size_t q) {
+    return real_t<T>(double(int((q * 7919) % 1999) - 999) / 1000.0 + 0.0005);
+  };
+  if constexpr (is_complex_v<T>) {
+    return T(part(k), part(3 * k + 1));
+  }
+  else {
+    return part(k);
+  }
+}
+
+////////////////////////////////////////////////////////////
+// Layouts
+////////////////////////////////////////////////////////////
+
+// Vectors are either contiguous or every other element of an array.
+struct contiguous_vector {
+  static constexpr const char* name = "contiguous";
+  static constexpr std::size_t stride = 1;
+  using layout_type = layout_right;
+};
+
+struct strided_vector {
+  static constexpr const char* name = "strided";
+  static constexpr std::size_t stride = 2;
+  using layout_type = layout_stride;
+};
+
+using vector_layouts = type_list<contiguous_vector, strided_vector>;
+
+template<class T, class VectorLayout>
+struct bench_vector {
+  using view_type = mdspan<T, dextents<std::size_t, 1>,
+                           typename VectorLayout::layout_type>;
+
+  bench_vector(std::size_t n, std::size_t seed) :
+    storage(n * VectorLayout::stride), view(make_view(storage.data(), n))
+  {
+    for (std::size_t i = 0; i < storage.size(); ++i) {
+      storage[i] = bench_value<T>(i + seed);
+    }
+  }
+
+  static view_type make_view(T* data, std::size_t n)
+  {
+    if constexpr (std::is_same_v<typename VectorLayout::layout_type, layout_stride>) {
+      return view_type(data, layout_stride::mapping<dextents<std::size_t, 1>>(
+        dextents<std::size_t, 1>(n), std::array<std::size_t, 1>{VectorLayout::stride}));
+    }
+    else {
+      return view_type(data, n);
+    }
+  }
+
+  std::size_t bytes() const { return view.extent(0) * sizeof(T); }
+
+  std::vector<T> storage;
+  view_type view;
+};
+
+// Matrices are column-major, row-major, column-major with a padded
+// leading dimension (as a layout_stride), or the transpose of a
+// row-major array.
+struct left_matrix {
+  static constexpr const char* name = "left";
+
+  template<class T>
+  static auto make_view(T* data, std::size_t m, std::size_t n)
+  {
+    return mdspan<T, dextents<std::size_t, 2>, layout_left>(data, m, n);
+  }
+  static std::size_t storage_size(std::size_t m, std::size_t n) { return m * n; }
+};
+
+struct right_matrix {
+  static constexpr const char* name = "right";
+
+  template<class T>
+  static auto make_view(T* data, std::size_t m, std::size_t n)
+  {
+    return mdspan<T, dextents<std::size_t, 2>, layout_right>(data, m, n);
+  }
+  static std::size_t storage_size(std::size_t m, std::size_t n) { return m * n; }
+};
+
+struct stride_matrix {
+  static constexpr const char* name = "stride";
+  static constexpr std::size_t padding = 8;
+
+  template<class T>
+  static auto make_view(T* data, std::size_t m, std::size_t n)
+  {
+    return mdspan<T, dextents<std::size_t, 2>, layout_stride>(data,
+      layout_stride::mapping<dextents<std::size_t, 2>>(dextents<std::size_t, 2>(m, n),
+        std::array<std::size_t, 2>{1, m + padding}));
+  }
+  static std::size_t storage_size(std::size_t m, std::size_t n) { return (m + padding) * n; }
+};
+
+struct transposed_matrix {
+  static constexpr const char* name = "transposed";
+
+  template<class T>
+  static auto make_view(T* data, std::size_t m, std::size_t n)
+  {
+    return LinearAlgebra::transposed(
+      mdspan<T, dextents<std::size_t, 2>, layout_right>(data, n, m));
+  }
+  static std::size_t storage_size(std::size_t m, std::size_t n) { return m * n; }
+};
+
+using matrix_layouts =
+  type_list<left_matrix, right_matrix, stride_matrix, transposed_matrix>;
+
+template<class T, class MatrixLayout>
+struct bench_matrix {
+  using view_type =
+    decltype(MatrixLayout::make_view(std::declval<T*>(), std::size_t(0), std::size_t(0)));
+
+  bench_matrix(std::size_t m, std::size_t n, std::size_t seed) :
+    storage(MatrixLayout::storage_size(m, n)), view(MatrixLayout::make_view(storage.data(), m, n))
+  {
+    for (std::size_t i = 0; i < storage.size(); ++i) {
+      storage[i] = bench_value<T>(i + seed);
+    }
+  }
+
+  // Makes the matrix a well-conditioned triangular (in either triangle)
+  // one: ones on the diagonal, and the other elements divided by n, so
+  // that repeated products and solves neither overflow nor underflow.
+  bench_matrix& make_well_conditioned()
+  {
+    const std::size_t n = view.extent(0);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < view.extent(1); ++j) {
+        view(i,j) = i == j ? T(1) : view(i,j) / real_t<T>(n);
+      }
+    }
+    return *this;
+  }
+
+  std::size_t bytes() const { return view.extent(0) * view.extent(1) * sizeof(T); }
+
+  std::vector<T> storage;
+  view_type view;
+};
+
+////////////////////////////////////////////////////////////
+// Accessors of the input operands
+////////////////////////////////////////////////////////////
+
+struct default_access {
+  static constexpr const char* name = "default";
+
+  template<class Object>
+  static auto apply(Object x) { return x; }
+};
+
+struct scaled_access {
+  static constexpr const char* name = "scaled";
+
+  template<class Object>
+  static auto apply(Object x)
+  {
+    using value_type = typename Object::value_type;
+    return LinearAlgebra::scaled(value_type(real_t<value_type>(0.5)), x);
+  }
+};
+
+struct conjugated_access {
+  static constexpr const char* name = "conjugated";
+
+  template<class Object>
+  static auto apply(Object x) { return LinearAlgebra::conjugated(x); }
+};
+
+////////////////////////////////////////////////////////////
+// Backends
+////////////////////////////////////////////////////////////
+
+// Each backend gives the execution policy to pass to the algorithms,
+// says whether it can run in this build and with which operands, and
+// prepares the library before each benchmark.  "inline" is the
+// library's own serial code: with a BLAS linked in, it calls the BLAS
+// where the BLAS applies; with a BLAS loaded at run time, the BLAS is
+// unloaded for it, and "blas" loads it instead.  "par" runs the
+// library's own code on its thread pool, whose size LINALG_NUM_THREADS
+// sets, with the run-time BLAS unloaded too, so that it compares with
+// "inline"; "kokkos" runs the Kokkos Kernels implementation.
+
+struct inline_backend {
+  static constexpr const char* name = "inline";
+  static auto policy() { return LinearAlgebra::impl::inline_exec_t{}; }
+  static bool available() { return true; }
+  template<class Layout, class Access>
+  static constexpr bool accepts() { return true; }
+  static void setup()
+  {
+#if defined(LINALG_ENABLE_BLAS_RUNTIME)
+    LinearAlgebra::unload_blas_library();
+#endif
+  }
+};
+
+#if defined(LINALG_ENABLE_BLAS_RUNTIME)
+struct blas_backend {
+  static constexpr const char* name = "blas";
+  static auto policy() { return LinearAlgebra::impl::inline_exec_t{}; }
+  static bool available() { return LinearAlgebra::load_default_blas_library(); }
+  template<class Layout, class Access>
+  static constexpr bool accepts() { return true; }
+  static void setup() { LinearAlgebra::load_default_blas_library(); }
+};
+#endif
+
+struct par_backend {
+  static constexpr const char* name = "par";
+  static auto policy() { return LinearAlgebra::thread_pool_exec(); }
+  static bool available() { return true; }
+  template<class Layout, class Access>
+  static constexpr bool accepts() { return true; }
+  static void setup()
+  {
+#if defined(LINALG_ENABLE_BLAS_RUNTIME)
+    LinearAlgebra::unload_blas_library();
+#endif
+  }
+};
+
+#if defined(LINALG_ENABLE_KOKKOS)
+// Kokkos Kernels takes operands that map to Kokkos views: contiguous
+// arrays read through default_accessor.
+struct kokkos_backend {
+  static constexpr const char* name = "kokkos";
+  static auto policy() { return KokkosKernelsSTD::kokkos_exec<>(); }
+  static bool available() { return true; }
+  template<class Layout, class Access>
+  static constexpr bool accepts()
+  {
+    return std::is_same_v<Access, default_access> &&
+      (std::is_same_v<Layout, contiguous_vector> ||
+       std::is_same_v<Layout, left_matrix> ||
+       std::is_same_v<Layout, right_matrix>);
+  }
+  static void setup() {}
+};
+#endif
+
+using backends = type_list<
+  inline_backend
+#if defined(LINALG_ENABLE_BLAS_RUNTIME)
+  , blas_backend
+#endif
+  , par_backend
+#if defined(LINALG_ENABLE_KOKKOS)
+  , kokkos_backend
+#endif
+  >;
+
+////////////////////////////////////////////////////////////
+// Registration
+////////////////////////////////////////////////////////////
+
+// Reports flops floating-point operations and bytes of memory traffic
+// per iteration, as rates.
+inline void set_work_counters(benchmark::State& state, double flops, double bytes)
+{
+  state.counters["flops"] =
+    benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["bytes"] =
+    benchmark::Counter(bytes, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// An algorithm's benchmark is a class Bench with
+//
+//   - name, the algorithm's name;
+//   - layouts, a type_list of vector or matrix layouts, the first of
+//     which is the baseline;
+//   - has_inputs, whether it has read-only operands for the scaled
+//     and conjugated accessors;
+//   - sizes(), the problem sizes to run; and
+//   - run<T, Layout, Access, Backend>(state), which times the
+//     algorithm on size state.range(0) and sets the work counters.
+template<class Bench, class T, class Layout, class Access>
+void register_on_backends()
+{
+  for_each_type(backends{}, [] (auto backend) {
+    using Backend = typename decltype(backend)::type;
+    if constexpr (Backend::template accepts<Layout, Access>()) {
+      if (! Backend::available()) {
+        return;
+      }
+      const std::string name = std::string(Bench::name) + "/" + type_name<T> + "/" +
+        Layout::name + "/" + Access::name + "/" + Backend::name;
+      auto* b = benchmark::RegisterBenchmark(name.c_str(), [] (benchmark::State& state) {
+        Backend::setup();
+        Bench::template run<T, Layout, Access, Backend>(state);
+      });
+      b->ArgName("n")->UseRealTime()->Unit(benchmark::kMicrosecond);
+      for (std::int64_t n : Bench::sizes()) {
+        b->Arg(n);
+      }
+    }
+  });
+}
+
+template<class T>
+struct type_list_head;
+
+template<class T, class... Ts>
+struct type_list_head<type_list<T, Ts...>> {
+  using type = T;
+};
+
+template<class Bench>
+void register_variants()
+{
+  using base_layout = typename type_list_head<typename Bench::layouts>::type;
+  for_each_type(element_types{}, [] (auto t) {
+    using T = typename decltype(t)::type;
+    register_on_backends<Bench, T, base_layout, default_access>();
+  });
+  for_each_type(typename Bench::layouts{}, [] (auto layout) {
+    using Layout = typename decltype(layout)::type;
+    if constexpr (! std::is_same_v<Layout, base_layout>) {
+      register_on_backends<Bench, double, Layout, default_access>();
+    }
+  });
+  if constexpr (Bench::has_inputs) {
+    for_each_type(type_list<scaled_access, conjugated_access>{}, [] (auto access) {
+      using Access = typename decltype(access)::type;
+      register_on_backends<Bench, double, base_layout, Access>();
+      register_on_backends<Bench, std::complex<double>, base_layout, Access>();
+    });
+  }
+}
+
+template<class... Benches>
+void register_benchmarks()
+{
+  (register_variants<Benches>(), ...);
+}
+
+// Each benchmark file defines this, and benchmark_main.cpp calls it
+// before running the benchmarks.
+void register_all();
+
+} // end namespace linalg_benchmarks
+
+#endif //LINALG_BENCHMARKS_BENCHMARK_FIXTURES_HPP_
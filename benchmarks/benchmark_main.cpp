@@ -0,0 +1,28 @@
+#include "./benchmark_fixtures.hpp"
+
+#if defined(LINALG_ENABLE_KOKKOS)
+#include <Kokkos_Core.hpp>
+#endif
+
+int main(int argc, char* argv[])
+{
+#if defined(LINALG_ENABLE_KOKKOS)
+  Kokkos::initialize(argc, argv);
+#endif
+  int err = 0;
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+      err = 1;
+    }
+    else {
+      linalg_benchmarks::register_all();
+      ::benchmark::RunSpecifiedBenchmarks();
+      ::benchmark::Shutdown();
+    }
+  }
+#if defined(LINALG_ENABLE_KOKKOS)
+  Kokkos::finalize();
+#endif
+  return err;
+}
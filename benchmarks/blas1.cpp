@@ -0,0 +1,317 @@
+#include "./benchmark_fixtures.hpp"
+
+// BLAS 1: vector algorithms on vectors of n elements, and matrix norms
+// of n x n matrices.
+
+namespace linalg_benchmarks {
+namespace {
+
+std::vector<std::int64_t> vector_sizes()
+{
+  return {std::int64_t(1) << 12, std::int64_t(1) << 16,
+          std::int64_t(1) << 20, std::int64_t(1) << 22};
+}
+
+std::vector<std::int64_t> matrix_sizes()
+{
+  return {64, 256, 1024, 2048};
+}
+
+struct givens_rotation_apply_bench {
+  static constexpr const char* name = "givens_rotation_apply";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = false;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1), y(n, 2);
+    // A rotation keeps the vectors' norms, however many times it runs.
+    const real_t<T> c(0.6), s(0.8);
+    for (auto _ : state) {
+      LinearAlgebra::givens_rotation_apply(Backend::policy(), x.view, y.view, c, s);
+      benchmark::ClobberMemory();
+    }
+    // c and s are real: four real-by-T products and two additions.
+    set_work_counters(state, double(n) * (4.0 * real_mul_flops<T> + 2.0 * add_flops<T>),
+                      4.0 * double(x.bytes()));
+  }
+};
+
+struct swap_elements_bench {
+  static constexpr const char* name = "swap_elements";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = false;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1), y(n, 2);
+    for (auto _ : state) {
+      LinearAlgebra::swap_elements(Backend::policy(), x.view, y.view);
+      benchmark::ClobberMemory();
+    }
+    set_work_counters(state, 0.0, 4.0 * double(x.bytes()));
+  }
+};
+
+struct scale_bench {
+  static constexpr const char* name = "scale";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = false;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1);
+    // -1 keeps the elements' magnitudes, however many times it runs.
+    const T alpha(-1);
+    for (auto _ : state) {
+      LinearAlgebra::scale(Backend::policy(), alpha, x.view);
+      benchmark::ClobberMemory();
+    }
+    set_work_counters(state, double(n) * mul_flops<T>, 2.0 * double(x.bytes()));
+  }
+};
+
+struct copy_bench {
+  static constexpr const char* name = "copy";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1), y(n, 2);
+    const auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      LinearAlgebra::copy(Backend::policy(), x_in, y.view);
+      benchmark::ClobberMemory();
+    }
+    set_work_counters(state, 0.0, 2.0 * double(x.bytes()));
+  }
+};
+
+struct add_bench {
+  static constexpr const char* name = "add";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1), y(n, 2), z(n, 3);
+    const auto x_in = Access::apply(x.view);
+    const auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      LinearAlgebra::add(Backend::policy(), x_in, y_in, z.view);
+      benchmark::ClobberMemory();
+    }
+    set_work_counters(state, double(n) * add_flops<T>, 3.0 * double(x.bytes()));
+  }
+};
+
+struct dot_bench {
+  static constexpr const char* name = "dot";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1), y(n, 2);
+    const auto x_in = Access::apply(x.view);
+    const auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(LinearAlgebra::dot(Backend::policy(), x_in, y_in));
+    }
+    set_work_counters(state, double(n) * madd_flops<T>, 2.0 * double(x.bytes()));
+  }
+};
+
+struct dotc_bench {
+  static constexpr const char* name = "dotc";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1), y(n, 2);
+    const auto x_in = Access::apply(x.view);
+    const auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(LinearAlgebra::dotc(Backend::policy(), x_in, y_in));
+    }
+    set_work_counters(state, double(n) * madd_flops<T>, 2.0 * double(x.bytes()));
+  }
+};
+
+struct vector_sum_of_squares_bench {
+  static constexpr const char* name = "vector_sum_of_squares";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    using real_type = real_t<T>;
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1);
+    const auto x_in = Access::apply(x.view);
+    const LinearAlgebra::sum_of_squares_result<real_type> init{real_type(0), real_type(1)};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+        LinearAlgebra::vector_sum_of_squares(Backend::policy(), x_in, init));
+    }
+    set_work_counters(state, double(n) * madd_flops<T> / 2.0, double(x.bytes()));
+  }
+};
+
+struct vector_norm2_bench {
+  static constexpr const char* name = "vector_norm2";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1);
+    const auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(LinearAlgebra::vector_norm2(Backend::policy(), x_in));
+    }
+    set_work_counters(state, double(n) * madd_flops<T> / 2.0, double(x.bytes()));
+  }
+};
+
+struct vector_abs_sum_bench {
+  static constexpr const char* name = "vector_abs_sum";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1);
+    const auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(LinearAlgebra::vector_abs_sum(Backend::policy(), x_in));
+    }
+    set_work_counters(state, double(n) * add_flops<T>, double(x.bytes()));
+  }
+};
+
+struct idx_abs_max_bench {
+  static constexpr const char* name = "idx_abs_max";
+  using layouts = vector_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return vector_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_vector<T, Layout> x(n, 1);
+    const auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(LinearAlgebra::idx_abs_max(Backend::policy(), x_in));
+    }
+    set_work_counters(state, double(n) * add_flops<T>, double(x.bytes()));
+  }
+};
+
+template<class Derived>
+struct matrix_norm_bench {
+  using layouts = matrix_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return matrix_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_matrix<T, Layout> A(n, n, 1);
+    const auto A_in = Access::apply(A.view);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(Derived::norm(Backend::policy(), A_in));
+    }
+    set_work_counters(state, double(n) * double(n) * Derived::template element_flops<T>,
+                      double(A.bytes()));
+  }
+};
+
+struct matrix_frob_norm_bench : matrix_norm_bench<matrix_frob_norm_bench> {
+  static constexpr const char* name = "matrix_frob_norm";
+  template<class T> static constexpr double element_flops = madd_flops<T> / 2.0;
+
+  template<class Exec, class in_matrix_t>
+  static auto norm(Exec&& exec, in_matrix_t A)
+  {
+    return LinearAlgebra::matrix_frob_norm(std::forward<Exec>(exec), A);
+  }
+};
+
+struct matrix_one_norm_bench : matrix_norm_bench<matrix_one_norm_bench> {
+  static constexpr const char* name = "matrix_one_norm";
+  template<class T> static constexpr double element_flops = add_flops<T>;
+
+  template<class Exec, class in_matrix_t>
+  static auto norm(Exec&& exec, in_matrix_t A)
+  {
+    return LinearAlgebra::matrix_one_norm(std::forward<Exec>(exec), A);
+  }
+};
+
+struct matrix_inf_norm_bench : matrix_norm_bench<matrix_inf_norm_bench> {
+  static constexpr const char* name = "matrix_inf_norm";
+  template<class T> static constexpr double element_flops = add_flops<T>;
+
+  template<class Exec, class in_matrix_t>
+  static auto norm(Exec&& exec, in_matrix_t A)
+  {
+    return LinearAlgebra::matrix_inf_norm(std::forward<Exec>(exec), A);
+  }
+};
+
+} // end anonymous namespace
+
+void register_all()
+{
+  register_benchmarks<
+    givens_rotation_apply_bench,
+    swap_elements_bench,
+    scale_bench,
+    copy_bench,
+    add_bench,
+    dot_bench,
+    dotc_bench,
+    vector_sum_of_squares_bench,
+    vector_norm2_bench,
+    vector_abs_sum_bench,
+    idx_abs_max_bench,
+    matrix_frob_norm_bench,
+    matrix_one_norm_bench,
+    matrix_inf_norm_bench>();
+}
+
+} // end namespace linalg_benchmarks
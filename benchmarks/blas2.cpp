@@ -0,0 +1,257 @@
+#include "./benchmark_fixtures.hpp"
+
+// BLAS 2: n x n matrices and contiguous vectors of n elements.  The
+// layout and the accessor apply to the matrix; the accessor also
+// applies to the input vectors.
+
+namespace linalg_benchmarks {
+namespace {
+
+using LinearAlgebra::explicit_diagonal;
+using LinearAlgebra::lower_triangle;
+
+std::vector<std::int64_t> blas2_sizes()
+{
+  return {64, 256, 1024, 2048};
+}
+
+// y := A * x, with a general, symmetric, Hermitian or triangular A.
+template<class Derived>
+struct matrix_vector_product_bench_base {
+  using layouts = matrix_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return blas2_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_matrix<T, Layout> A(n, n, 1);
+    bench_vector<T, contiguous_vector> x(n, 2), y(n, 3);
+    const auto A_in = Access::apply(A.view);
+    const auto x_in = Access::apply(x.view);
+    for (auto _ : state) {
+      Derived::product(Backend::policy(), A_in, x_in, y.view);
+      benchmark::ClobberMemory();
+    }
+    const double entries = double(n) * double(n) * Derived::fraction;
+    set_work_counters(state, entries * madd_flops<T>,
+                      entries * sizeof(T) + 2.0 * double(x.bytes()));
+  }
+};
+
+struct matrix_vector_product_bench :
+  matrix_vector_product_bench_base<matrix_vector_product_bench>
+{
+  static constexpr const char* name = "matrix_vector_product";
+  static constexpr double fraction = 1.0;
+
+  template<class Exec, class A_t, class x_t, class y_t>
+  static void product(Exec&& exec, A_t A, x_t x, y_t y)
+  {
+    LinearAlgebra::matrix_vector_product(std::forward<Exec>(exec), A, x, y);
+  }
+};
+
+// The symmetric and Hermitian products read one triangle of A, but
+// do as many multiply-adds as the general product.
+struct symmetric_matrix_vector_product_bench :
+  matrix_vector_product_bench_base<symmetric_matrix_vector_product_bench>
+{
+  static constexpr const char* name = "symmetric_matrix_vector_product";
+  static constexpr double fraction = 1.0;
+
+  template<class Exec, class A_t, class x_t, class y_t>
+  static void product(Exec&& exec, A_t A, x_t x, y_t y)
+  {
+    LinearAlgebra::symmetric_matrix_vector_product(std::forward<Exec>(exec),
+      A, lower_triangle, x, y);
+  }
+};
+
+struct hermitian_matrix_vector_product_bench :
+  matrix_vector_product_bench_base<hermitian_matrix_vector_product_bench>
+{
+  static constexpr const char* name = "hermitian_matrix_vector_product";
+  static constexpr double fraction = 1.0;
+
+  template<class Exec, class A_t, class x_t, class y_t>
+  static void product(Exec&& exec, A_t A, x_t x, y_t y)
+  {
+    LinearAlgebra::hermitian_matrix_vector_product(std::forward<Exec>(exec),
+      A, lower_triangle, x, y);
+  }
+};
+
+struct triangular_matrix_vector_product_bench :
+  matrix_vector_product_bench_base<triangular_matrix_vector_product_bench>
+{
+  static constexpr const char* name = "triangular_matrix_vector_product";
+  static constexpr double fraction = 0.5;
+
+  template<class Exec, class A_t, class x_t, class y_t>
+  static void product(Exec&& exec, A_t A, x_t x, y_t y)
+  {
+    LinearAlgebra::triangular_matrix_vector_product(std::forward<Exec>(exec),
+      A, lower_triangle, explicit_diagonal, x, y);
+  }
+};
+
+// x := A \ b, with b left as it is, so that every iteration solves the
+// same system.
+struct triangular_matrix_vector_solve_bench {
+  static constexpr const char* name = "triangular_matrix_vector_solve";
+  using layouts = matrix_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return blas2_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_matrix<T, Layout> A(n, n, 1);
+    A.make_well_conditioned();
+    bench_vector<T, contiguous_vector> b(n, 2), x(n, 3);
+    const auto A_in = Access::apply(A.view);
+    const auto b_in = Access::apply(b.view);
+    for (auto _ : state) {
+      LinearAlgebra::triangular_matrix_vector_solve(Backend::policy(),
+        A_in, lower_triangle, explicit_diagonal, b_in, x.view);
+      benchmark::ClobberMemory();
+    }
+    const double entries = double(n) * double(n) / 2.0;
+    set_work_counters(state, entries * madd_flops<T>,
+                      entries * sizeof(T) + 2.0 * double(x.bytes()));
+  }
+};
+
+// A := A + (outer products of x and y), on all of A or on one
+// triangle.  The elements of A grow by at most 1 or 2 per iteration,
+// which stays far from overflow.
+template<class Derived>
+struct rank_update_bench_base {
+  using layouts = matrix_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return blas2_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_matrix<T, Layout> A(n, n, 1);
+    bench_vector<T, contiguous_vector> x(n, 2), y(n, 3);
+    const auto x_in = Access::apply(x.view);
+    const auto y_in = Access::apply(y.view);
+    for (auto _ : state) {
+      Derived::update(Backend::policy(), x_in, y_in, A.view);
+      benchmark::ClobberMemory();
+    }
+    const double entries = double(n) * double(n) * Derived::fraction;
+    set_work_counters(state, entries * Derived::rank * madd_flops<T>,
+                      2.0 * entries * sizeof(T));
+  }
+};
+
+struct matrix_rank_1_update_bench : rank_update_bench_base<matrix_rank_1_update_bench> {
+  static constexpr const char* name = "matrix_rank_1_update";
+  static constexpr double fraction = 1.0;
+  static constexpr double rank = 1.0;
+
+  template<class Exec, class x_t, class y_t, class A_t>
+  static void update(Exec&& exec, x_t x, y_t y, A_t A)
+  {
+    LinearAlgebra::matrix_rank_1_update(std::forward<Exec>(exec), x, y, A);
+  }
+};
+
+struct matrix_rank_1_update_c_bench : rank_update_bench_base<matrix_rank_1_update_c_bench> {
+  static constexpr const char* name = "matrix_rank_1_update_c";
+  static constexpr double fraction = 1.0;
+  static constexpr double rank = 1.0;
+
+  template<class Exec, class x_t, class y_t, class A_t>
+  static void update(Exec&& exec, x_t x, y_t y, A_t A)
+  {
+    LinearAlgebra::matrix_rank_1_update_c(std::forward<Exec>(exec), x, y, A);
+  }
+};
+
+struct symmetric_matrix_rank_1_update_bench :
+  rank_update_bench_base<symmetric_matrix_rank_1_update_bench>
+{
+  static constexpr const char* name = "symmetric_matrix_rank_1_update";
+  static constexpr double fraction = 0.5;
+  static constexpr double rank = 1.0;
+
+  template<class Exec, class x_t, class y_t, class A_t>
+  static void update(Exec&& exec, x_t x, y_t /* y */, A_t A)
+  {
+    LinearAlgebra::symmetric_matrix_rank_1_update(std::forward<Exec>(exec),
+      x, A, lower_triangle);
+  }
+};
+
+struct hermitian_matrix_rank_1_update_bench :
+  rank_update_bench_base<hermitian_matrix_rank_1_update_bench>
+{
+  static constexpr const char* name = "hermitian_matrix_rank_1_update";
+  static constexpr double fraction = 0.5;
+  static constexpr double rank = 1.0;
+
+  template<class Exec, class x_t, class y_t, class A_t>
+  static void update(Exec&& exec, x_t x, y_t /* y */, A_t A)
+  {
+    LinearAlgebra::hermitian_matrix_rank_1_update(std::forward<Exec>(exec),
+      x, A, lower_triangle);
+  }
+};
+
+struct symmetric_matrix_rank_2_update_bench :
+  rank_update_bench_base<symmetric_matrix_rank_2_update_bench>
+{
+  static constexpr const char* name = "symmetric_matrix_rank_2_update";
+  static constexpr double fraction = 0.5;
+  static constexpr double rank = 2.0;
+
+  template<class Exec, class x_t, class y_t, class A_t>
+  static void update(Exec&& exec, x_t x, y_t y, A_t A)
+  {
+    LinearAlgebra::symmetric_matrix_rank_2_update(std::forward<Exec>(exec),
+      x, y, A, lower_triangle);
+  }
+};
+
+struct hermitian_matrix_rank_2_update_bench :
+  rank_update_bench_base<hermitian_matrix_rank_2_update_bench>
+{
+  static constexpr const char* name = "hermitian_matrix_rank_2_update";
+  static constexpr double fraction = 0.5;
+  static constexpr double rank = 2.0;
+
+  template<class Exec, class x_t, class y_t, class A_t>
+  static void update(Exec&& exec, x_t x, y_t y, A_t A)
+  {
+    LinearAlgebra::hermitian_matrix_rank_2_update(std::forward<Exec>(exec),
+      x, y, A, lower_triangle);
+  }
+};
+
+} // end anonymous namespace
+
+void register_all()
+{
+  register_benchmarks<
+    matrix_vector_product_bench,
+    symmetric_matrix_vector_product_bench,
+    hermitian_matrix_vector_product_bench,
+    triangular_matrix_vector_product_bench,
+    triangular_matrix_vector_solve_bench,
+    matrix_rank_1_update_bench,
+    matrix_rank_1_update_c_bench,
+    symmetric_matrix_rank_1_update_bench,
+    hermitian_matrix_rank_1_update_bench,
+    symmetric_matrix_rank_2_update_bench,
+    hermitian_matrix_rank_2_update_bench>();
+}
+
+} // end namespace linalg_benchmarks
@@ -0,0 +1,236 @@
+#include "./benchmark_fixtures.hpp"
+
+// BLAS 3: n x n matrices.  The layout applies to every matrix, and the
+// accessor to the input matrices.
+
+namespace linalg_benchmarks {
+namespace {
+
+using LinearAlgebra::explicit_diagonal;
+using LinearAlgebra::lower_triangle;
+
+std::vector<std::int64_t> blas3_sizes()
+{
+  return {64, 256, 1024};
+}
+
+// C := op(A, B), where the algorithm writes C from A and B alone, and
+// does fraction * n^3 multiply-adds.  A is well conditioned, for the
+// solves.
+template<class Derived>
+struct matrix_matrix_bench_base {
+  using layouts = matrix_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return blas3_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_matrix<T, Layout> A(n, n, 1), B(n, n, 2), C(n, n, 3);
+    A.make_well_conditioned();
+    const auto A_in = Access::apply(A.view);
+    const auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Derived::compute(Backend::policy(), A_in, B_in, C.view);
+      benchmark::ClobberMemory();
+    }
+    set_work_counters(state,
+      Derived::fraction * double(n) * double(n) * double(n) * madd_flops<T>,
+      3.0 * double(C.bytes()));
+  }
+};
+
+struct matrix_product_bench : matrix_matrix_bench_base<matrix_product_bench> {
+  static constexpr const char* name = "matrix_product";
+  static constexpr double fraction = 1.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void compute(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::matrix_product(std::forward<Exec>(exec), A, B, C);
+  }
+};
+
+struct symmetric_matrix_product_bench : matrix_matrix_bench_base<symmetric_matrix_product_bench> {
+  static constexpr const char* name = "symmetric_matrix_product";
+  static constexpr double fraction = 1.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void compute(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::symmetric_matrix_product(std::forward<Exec>(exec), A, lower_triangle, B, C);
+  }
+};
+
+struct hermitian_matrix_product_bench : matrix_matrix_bench_base<hermitian_matrix_product_bench> {
+  static constexpr const char* name = "hermitian_matrix_product";
+  static constexpr double fraction = 1.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void compute(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::hermitian_matrix_product(std::forward<Exec>(exec), A, lower_triangle, B, C);
+  }
+};
+
+// C := A * B with a triangular A.
+struct triangular_matrix_product_bench :
+  matrix_matrix_bench_base<triangular_matrix_product_bench>
+{
+  static constexpr const char* name = "triangular_matrix_product";
+  static constexpr double fraction = 0.5;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void compute(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::triangular_matrix_product(std::forward<Exec>(exec),
+      A, lower_triangle, explicit_diagonal, B, C);
+  }
+};
+
+// C := B * A with a triangular A.
+struct triangular_matrix_product_right_bench :
+  matrix_matrix_bench_base<triangular_matrix_product_right_bench>
+{
+  static constexpr const char* name = "triangular_matrix_product_right";
+  static constexpr double fraction = 0.5;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void compute(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::triangular_matrix_product(std::forward<Exec>(exec),
+      B, A, lower_triangle, explicit_diagonal, C);
+  }
+};
+
+// X := A \ B, with B left as it is.
+struct triangular_matrix_matrix_left_solve_bench :
+  matrix_matrix_bench_base<triangular_matrix_matrix_left_solve_bench>
+{
+  static constexpr const char* name = "triangular_matrix_matrix_left_solve";
+  static constexpr double fraction = 0.5;
+
+  template<class Exec, class A_t, class B_t, class X_t>
+  static void compute(Exec&& exec, A_t A, B_t B, X_t X)
+  {
+    LinearAlgebra::triangular_matrix_matrix_left_solve(std::forward<Exec>(exec),
+      A, lower_triangle, explicit_diagonal, B, X);
+  }
+};
+
+// X := B / A, with B left as it is.
+struct triangular_matrix_matrix_right_solve_bench :
+  matrix_matrix_bench_base<triangular_matrix_matrix_right_solve_bench>
+{
+  static constexpr const char* name = "triangular_matrix_matrix_right_solve";
+  static constexpr double fraction = 0.5;
+
+  template<class Exec, class A_t, class B_t, class X_t>
+  static void compute(Exec&& exec, A_t A, B_t B, X_t X)
+  {
+    LinearAlgebra::triangular_matrix_matrix_right_solve(std::forward<Exec>(exec),
+      A, lower_triangle, explicit_diagonal, B, X);
+  }
+};
+
+// C := C + A * op(A), or C := C + A * op(B) + B * op(A), on one
+// triangle of C, which has n^2 / 2 elements that each take n (or 2n)
+// multiply-adds.  The elements of C grow by about n per iteration,
+// which stays far from overflow.
+template<class Derived>
+struct rank_k_update_bench_base {
+  using layouts = matrix_layouts;
+  static constexpr bool has_inputs = true;
+  static std::vector<std::int64_t> sizes() { return blas3_sizes(); }
+
+  template<class T, class Layout, class Access, class Backend>
+  static void run(benchmark::State& state)
+  {
+    const std::size_t n = state.range(0);
+    bench_matrix<T, Layout> A(n, n, 1), B(n, n, 2), C(n, n, 3);
+    const auto A_in = Access::apply(A.view);
+    const auto B_in = Access::apply(B.view);
+    for (auto _ : state) {
+      Derived::update(Backend::policy(), A_in, B_in, C.view);
+      benchmark::ClobberMemory();
+    }
+    set_work_counters(state,
+      Derived::rank / 2.0 * double(n) * double(n) * double(n) * madd_flops<T>,
+      (Derived::rank + 1.0) * double(C.bytes()));
+  }
+};
+
+struct symmetric_matrix_rank_k_update_bench :
+  rank_k_update_bench_base<symmetric_matrix_rank_k_update_bench>
+{
+  static constexpr const char* name = "symmetric_matrix_rank_k_update";
+  static constexpr double rank = 1.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void update(Exec&& exec, A_t A, B_t /* B */, C_t C)
+  {
+    LinearAlgebra::symmetric_matrix_rank_k_update(std::forward<Exec>(exec), A, C, lower_triangle);
+  }
+};
+
+struct hermitian_matrix_rank_k_update_bench :
+  rank_k_update_bench_base<hermitian_matrix_rank_k_update_bench>
+{
+  static constexpr const char* name = "hermitian_matrix_rank_k_update";
+  static constexpr double rank = 1.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void update(Exec&& exec, A_t A, B_t /* B */, C_t C)
+  {
+    LinearAlgebra::hermitian_matrix_rank_k_update(std::forward<Exec>(exec), A, C, lower_triangle);
+  }
+};
+
+struct symmetric_matrix_rank_2k_update_bench :
+  rank_k_update_bench_base<symmetric_matrix_rank_2k_update_bench>
+{
+  static constexpr const char* name = "symmetric_matrix_rank_2k_update";
+  static constexpr double rank = 2.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void update(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::symmetric_matrix_rank_2k_update(std::forward<Exec>(exec),
+      A, B, C, lower_triangle);
+  }
+};
+
+struct hermitian_matrix_rank_2k_update_bench :
+  rank_k_update_bench_base<hermitian_matrix_rank_2k_update_bench>
+{
+  static constexpr const char* name = "hermitian_matrix_rank_2k_update";
+  static constexpr double rank = 2.0;
+
+  template<class Exec, class A_t, class B_t, class C_t>
+  static void update(Exec&& exec, A_t A, B_t B, C_t C)
+  {
+    LinearAlgebra::hermitian_matrix_rank_2k_update(std::forward<Exec>(exec),
+      A, B, C, lower_triangle);
+  }
+};
+
+} // end anonymous namespace
+
+void register_all()
+{
+  register_benchmarks<
+    matrix_product_bench,
+    symmetric_matrix_product_bench,
+    hermitian_matrix_product_bench,
+    triangular_matrix_product_bench,
+    triangular_matrix_product_right_bench,
+    triangular_matrix_matrix_left_solve_bench,
+    triangular_matrix_matrix_right_solve_bench,
+    symmetric_matrix_rank_k_update_bench,
+    hermitian_matrix_rank_k_update_bench,
+    symmetric_matrix_rank_2k_update_bench,
+    hermitian_matrix_rank_2k_update_bench>();
+}
+
+} // end namespace linalg_benchmarks
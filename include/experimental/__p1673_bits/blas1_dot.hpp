@@ -43,6 +43,7 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_DOT_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_DOT_HPP_
 
+#include <cstddef>
 #include <type_traits>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
@@ -77,6 +78,46 @@ struct is_custom_dot_avail<
 
 } // end anonymous namespace
 
+namespace impl {
+
+// dot can use the SIMD kernels if both vectors read Scalar values
+// straight from arrays (possibly scaled or conjugated), so that the
+// kernels accumulate in Scalar just as the generic loop does.
+template<class Scalar, class in_vector_1_t, class in_vector_2_t>
+constexpr bool dot_simd_eligible()
+{
+  return is_blas_scalar_v<Scalar> &&
+    blas_traits_t<Scalar, in_vector_1_t>::valid &&
+    blas_traits_t<Scalar, in_vector_2_t>::valid &&
+    in_vector_1_t::is_always_strided() &&
+    in_vector_2_t::is_always_strided();
+}
+
+// Sum of v1(k) * v2(k), computed from the arrays behind v1 and v2.
+// Scaling factors come out of the sum, and a conjugated v2 is handled
+// as conj(sum of conj(v1(k)) * s2(k)), with s2 the stored elements.
+template<class Scalar, class in_vector_1_t, class in_vector_2_t>
+Scalar dot_simd(in_vector_1_t v1, in_vector_2_t v2)
+{
+  using traits_1 = blas_traits_t<Scalar, in_vector_1_t>;
+  using traits_2 = blas_traits_t<Scalar, in_vector_2_t>;
+  const std::size_t n = v1.extent(0);
+  if (n == 0) {
+    return Scalar{};
+  }
+  const Scalar* x = v1.data_handle() + v1.mapping()(0);
+  const Scalar* y = v2.data_handle() + v2.mapping()(0);
+  Scalar sum = simd_dot<traits_1::conj != traits_2::conj>(n,
+    x, std::ptrdiff_t(v1.stride(0)), y, std::ptrdiff_t(v2.stride(0)));
+  if constexpr (traits_2::conj) {
+    sum = conj_if_needed(sum);
+  }
+  return traits_1::scaling_factor(v1.accessor()) *
+    traits_2::scaling_factor(v2.accessor()) * sum;
+}
+
+} // end namespace impl
+
 
 template<class ElementType1,
 	 class SizeType1,
@@ -99,11 +140,19 @@ Scalar dot(
                 v2.static_extent(0) == dynamic_extent ||
                 v1.static_extent(0) == v2.static_extent(0));
 
-  using size_type = std::common_type_t<SizeType1, SizeType2>;
-  for (size_type k = 0; k < v1.extent(0); ++k) {
-    init += v1(k) * v2(k);
+  if constexpr (impl::static_kernel_eligible<ext1, decltype(v1), decltype(v2)>()) {
+    return impl::static_dot(v1, v2, init);
+  }
+  else if constexpr (impl::dot_simd_eligible<Scalar, decltype(v1), decltype(v2)>()) {
+    return init + impl::dot_simd<Scalar>(v1, v2);
+  }
+  else {
+    using size_type = std::common_type_t<SizeType1, SizeType2>;
+    for (size_type k = 0; k < v1.extent(0); ++k) {
+      init += v1(k) * v2(k);
+    }
+    return init;
   }
-  return init;
 }
 
 template<class ExecutionPolicy,
@@ -43,8 +43,12 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_GIVENS_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_GIVENS_HPP_
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
@@ -107,6 +111,27 @@ struct is_custom_givens_rotation_apply_avail<
     >
   >
   : std::true_type{};
+
+template <class Exec, class A_t, class c_t, class s_t, class = void>
+struct is_custom_givens_rotation_sequence_apply_avail : std::false_type {};
+
+template <class Exec, class A_t, class c_t, class s_t>
+struct is_custom_givens_rotation_sequence_apply_avail<
+  Exec, A_t, c_t, s_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(givens_rotation_sequence_apply
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<c_t>(),
+		std::declval<s_t>()
+		)
+	       )
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
 } // end anonymous namespace
 
 MDSPAN_TEMPLATE_REQUIRES( class Real, /* requires */ ( _MDSPAN_TRAIT(std::is_floating_point, Real) ) )
@@ -371,6 +396,54 @@ label20:
   }
 }
 
+namespace impl {
+
+// The rotation kernels can work on x and y in place if they are
+// writable arrays of the same BLAS scalar type, c has its real type,
+// and s is real or (for complex arrays) complex of that type.  Those
+// are exactly the cases where the kernels' arithmetic is the loop's.
+template<class inout_vector_1_t, class inout_vector_2_t, class Real, class S>
+constexpr bool givens_simd_eligible()
+{
+  using element_type = typename inout_vector_1_t::element_type;
+  return is_blas_writable_v<inout_vector_1_t> &&
+    is_blas_writable_v<inout_vector_2_t> &&
+    std::is_same_v<element_type, typename inout_vector_2_t::element_type> &&
+    std::is_same_v<Real, simd_real_t<element_type>> &&
+    (std::is_same_v<S, Real> ||
+     (is_complex_v<element_type> && std::is_same_v<S, element_type>));
+}
+
+// (x(i), y(i)) := (c x(i) + s y(i), c y(i) - conj(s) x(i)).
+template<class inout_vector_1_t, class inout_vector_2_t, class Real, class S>
+void givens_rotation_apply_vectors(inout_vector_1_t x, inout_vector_2_t y,
+  const Real c, const S s)
+{
+  static_assert(x.static_extent(0) == dynamic_extent ||
+                y.static_extent(0) == dynamic_extent ||
+                x.static_extent(0) == y.static_extent(0));
+
+  if constexpr (givens_simd_eligible<inout_vector_1_t, inout_vector_2_t, Real, S>()) {
+    const std::size_t n = x.extent(0);
+    if (n != 0) {
+      simd_rot(n, x.data_handle() + x.mapping()(0), std::ptrdiff_t(x.stride(0)),
+        y.data_handle() + y.mapping()(0), std::ptrdiff_t(y.stride(0)), c, s);
+    }
+  }
+  else {
+    using index_type = ::std::common_type_t<
+      typename inout_vector_1_t::index_type, typename inout_vector_2_t::index_type>;
+    const auto x_extent_0 = static_cast<index_type>(x.extent(0));
+    for (index_type i = 0; i < x_extent_0; ++i) {
+      const auto dtemp = c * x(i) + s * y(i);
+      y(i) = c * y(i) - conj_if_needed(s) * x(i);
+      x(i) = dtemp;
+    }
+  }
+}
+
+} // end namespace impl
+
 MDSPAN_TEMPLATE_REQUIRES(
          class ElementType1,
 	 class SizeType1,
@@ -392,17 +465,7 @@ void givens_rotation_apply(
   const Real c,
   const Real s)
 {
-  static_assert(x.static_extent(0) == dynamic_extent ||
-                y.static_extent(0) == dynamic_extent ||
-                x.static_extent(0) == y.static_extent(0));
-
-  using index_type = ::std::common_type_t<SizeType1, SizeType2>;
-  const auto x_extent_0 = static_cast<index_type>(x.extent(0));
-  for (index_type i = 0; i < x_extent_0; ++i) {
-    const auto dtemp = c * x(i) + s * y(i);
-    y(i) = c * y(i) - s * x(i);
-    x(i) = dtemp;
-  }
+  impl::givens_rotation_apply_vectors(x, y, c, s);
 }
 
 MDSPAN_TEMPLATE_REQUIRES(
@@ -488,18 +551,7 @@ void givens_rotation_apply(
   const Real c,
   const std::complex<Real> s)
 {
-  static_assert(x.static_extent(0) == dynamic_extent ||
-                y.static_extent(0) == dynamic_extent ||
-                x.static_extent(0) == y.static_extent(0));
-
-  using std::conj;
-  using index_type = ::std::common_type_t<SizeType1, SizeType2>;
-  const auto x_extent_0 = static_cast<index_type>(x.extent(0));
-  for (index_type i = 0; i < x_extent_0; ++i) {
-    const auto dtemp = c * x(i) + s * y(i);
-    y(i) = c * y(i) - conj(s) * x(i);
-    x(i) = dtemp;
-  }
+  impl::givens_rotation_apply_vectors(x, y, c, s);
 }
 
 MDSPAN_TEMPLATE_REQUIRES(
@@ -559,6 +611,211 @@ void givens_rotation_apply(
   givens_rotation_apply(impl::default_exec_t{}, x, y, c, s);
 }
 
+// Sequences of plane rotations applied to the columns of a matrix.
+//
+// givens_rotation_sequence_apply(A, c, s) rotates columns k and k+1
+// of the m x n matrix A by (c(k, j), s(k, j)), for k = 0, 1, ..., n-2
+// in turn, for each sequence j = 0, 1, ... in turn, with the result
+// of givens_rotation_apply on those columns.  c and s have n-1 rows
+// and one column per sequence; vectors c and s hold one sequence.
+// For real data this is LAPACK's xLASR with SIDE = 'R', PIVOT = 'V',
+// and DIRECT = 'F'; s may also be complex, as in ZROT.
+//
+// Each row of A goes through the rotations independently of the
+// others.  The column-major kernel thus cuts A into blocks of rows
+// and runs the whole sequence on one block before the next.  With
+// several sequences, it applies rotation k of sequence j at step
+// k + 2j: rotations of the same step touch disjoint columns, and each
+// comes after every rotation it depends on.  That wavefront sweeps
+// across A once, and all sequences work on the few columns under it
+// while they are in cache.  Rows of row-major matrices are rotated
+// one at a time, keeping the running column in a register.
+
+namespace impl {
+
+template<class in_object_t>
+auto givens_sequence_entry(const in_object_t& v, std::size_t k, std::size_t j)
+{
+  using index_type = typename in_object_t::index_type;
+  using value_type = typename in_object_t::value_type;
+  if constexpr (in_object_t::rank() == 1) {
+    (void) j;
+    return value_type(v(index_type(k)));
+  }
+  else {
+    return value_type(v(index_type(k), index_type(j)));
+  }
+}
+
+// Calls f(k, j) for each rotation k in [0, num_rotations) of each
+// sequence j in [0, num_sequences), in wavefront order: at step t,
+// the rotations k = t - 2j.
+template<class F>
+void givens_sequence_wavefront(std::size_t num_rotations,
+  std::size_t num_sequences, F f)
+{
+  const std::size_t num_steps = num_rotations + 2 * (num_sequences - 1);
+  for (std::size_t t = 0; t < num_steps; ++t) {
+    const std::size_t j_begin =
+      t < num_rotations ? 0 : (t - num_rotations) / 2 + 1;
+    const std::size_t j_end = std::min(num_sequences, t / 2 + 1);
+    for (std::size_t j = j_begin; j < j_end; ++j) {
+      f(t - 2 * j, j);
+    }
+  }
+}
+
+// Rows in each block of the wavefront, such that the 2q + 2 columns
+// around the wavefront's position take at most 128 KiB: half of the
+// smallest L2 cache (256 KiB) of current x86 and ARM cores, which
+// leaves the other half to the rotations' coefficients and to the
+// lines the hardware prefetcher brings in ahead of the band.
+inline std::size_t givens_sequence_block_rows(std::size_t num_columns,
+  std::size_t num_sequences, std::size_t element_size)
+{
+  constexpr std::size_t cache_bytes = 131072;
+  const std::size_t band = std::min(num_columns, 2 * num_sequences + 2);
+  return std::max(std::size_t(64), cache_bytes / (element_size * band));
+}
+
+template<class inout_matrix_t, class in_c_t, class in_s_t>
+void givens_rotation_sequence_apply_impl(inout_matrix_t A, in_c_t c, in_s_t s)
+{
+  static_assert(in_c_t::rank() == 1 || in_c_t::rank() == 2);
+  static_assert(in_s_t::rank() == in_c_t::rank());
+  using c_type = typename in_c_t::value_type;
+  using s_type = typename in_s_t::value_type;
+  using element_type = typename inout_matrix_t::element_type;
+  using index_type = typename inout_matrix_t::index_type;
+
+  const std::size_t m = A.extent(0);
+  const std::size_t n = A.extent(1);
+  const std::size_t num_sequences =
+    in_c_t::rank() == 1 ? std::size_t(1) : std::size_t(c.extent(in_c_t::rank() - 1));
+  if (m == 0 || n < 2 || num_sequences == 0) {
+    return;
+  }
+  const std::size_t num_rotations = n - 1;
+
+  // Each task reads every coefficient once per row (or block of
+  // rows), so copy them out of c and s first.
+  std::vector<c_type> cs(num_rotations * num_sequences);
+  std::vector<s_type> sn(num_rotations * num_sequences);
+  for (std::size_t j = 0; j < num_sequences; ++j) {
+    for (std::size_t k = 0; k < num_rotations; ++k) {
+      cs[j * num_rotations + k] = givens_sequence_entry(c, k, j);
+      sn[j * num_rotations + k] = givens_sequence_entry(s, k, j);
+    }
+  }
+
+  const std::size_t block_rows =
+    givens_sequence_block_rows(n, num_sequences, sizeof(element_type));
+  if constexpr (givens_simd_eligible<inout_matrix_t, inout_matrix_t, c_type, s_type>()) {
+    element_type* a = A.data_handle() + A.mapping()(0, 0);
+    const auto rs = std::ptrdiff_t(A.stride(0));
+    const auto cstride = std::ptrdiff_t(A.stride(1));
+    if (cstride == 1 && rs != 1) {
+      for (std::size_t i = 0; i < m; ++i) {
+        element_type* row = a + std::ptrdiff_t(i) * rs;
+        for (std::size_t j = 0; j < num_sequences; ++j) {
+          const c_type* cs_j = cs.data() + j * num_rotations;
+          const s_type* sn_j = sn.data() + j * num_rotations;
+          element_type x = row[0];
+          for (std::size_t k = 0; k < num_rotations; ++k) {
+            const element_type y = row[k + 1];
+            row[k] = cs_j[k] * x + sn_j[k] * y;
+            x = cs_j[k] * y - conj_if_needed(sn_j[k]) * x;
+          }
+          row[num_rotations] = x;
+        }
+      }
+    }
+    else {
+      for (std::size_t i0 = 0; i0 < m; i0 += block_rows) {
+        const std::size_t rows = std::min(block_rows, m - i0);
+        element_type* block = a + std::ptrdiff_t(i0) * rs;
+        givens_sequence_wavefront(num_rotations, num_sequences,
+          [&] (std::size_t k, std::size_t j) {
+            const std::size_t r = j * num_rotations + k;
+            simd_rot(rows, block + std::ptrdiff_t(k) * cstride, rs,
+              block + std::ptrdiff_t(k + 1) * cstride, rs, cs[r], sn[r]);
+          });
+      }
+    }
+  }
+  else {
+    for (std::size_t i0 = 0; i0 < m; i0 += block_rows) {
+      const std::size_t i1 = std::min(m, i0 + block_rows);
+      givens_sequence_wavefront(num_rotations, num_sequences,
+        [&] (std::size_t k, std::size_t j) {
+          const c_type c_kj = cs[j * num_rotations + k];
+          const s_type s_kj = sn[j * num_rotations + k];
+          const auto col_x = index_type(k);
+          const auto col_y = index_type(k + 1);
+          for (std::size_t i = i0; i < i1; ++i) {
+            const auto row = index_type(i);
+            const auto dtemp = c_kj * A(row, col_x) + s_kj * A(row, col_y);
+            A(row, col_y) = c_kj * A(row, col_y) - conj_if_needed(s_kj) * A(row, col_x);
+            A(row, col_x) = dtemp;
+          }
+        });
+    }
+  }
+}
+
+} // end namespace impl
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class ElementType_c, class SizeType_c, ::std::size_t... ext_c,
+         class Layout_c, class Accessor_c,
+         class ElementType_s, class SizeType_s, ::std::size_t... ext_s,
+         class Layout_s, class Accessor_s>
+void givens_rotation_sequence_apply(
+  impl::inline_exec_t&& /* exec */,
+  P1673_MATRIX_PARAMETER( A ),
+  mdspan<ElementType_c, extents<SizeType_c, ext_c...>, Layout_c, Accessor_c> c,
+  mdspan<ElementType_s, extents<SizeType_s, ext_s...>, Layout_s, Accessor_s> s)
+{
+  impl::givens_rotation_sequence_apply_impl(A, c, s);
+}
+
+template<class ExecutionPolicy,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class ElementType_c, class SizeType_c, ::std::size_t... ext_c,
+         class Layout_c, class Accessor_c,
+         class ElementType_s, class SizeType_s, ::std::size_t... ext_s,
+         class Layout_s, class Accessor_s>
+void givens_rotation_sequence_apply(
+  ExecutionPolicy&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  mdspan<ElementType_c, extents<SizeType_c, ext_c...>, Layout_c, Accessor_c> c,
+  mdspan<ElementType_s, extents<SizeType_s, ext_s...>, Layout_s, Accessor_s> s)
+{
+  constexpr bool use_custom = is_custom_givens_rotation_sequence_apply_avail<
+    decltype(execpolicy_mapper(exec)), decltype(A), decltype(c), decltype(s)
+    >::value;
+
+  if constexpr (use_custom) {
+    givens_rotation_sequence_apply(execpolicy_mapper(exec), A, c, s);
+  }
+  else {
+    givens_rotation_sequence_apply(impl::inline_exec_t{}, A, c, s);
+  }
+}
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class ElementType_c, class SizeType_c, ::std::size_t... ext_c,
+         class Layout_c, class Accessor_c,
+         class ElementType_s, class SizeType_s, ::std::size_t... ext_s,
+         class Layout_s, class Accessor_s>
+void givens_rotation_sequence_apply(
+  P1673_MATRIX_PARAMETER( A ),
+  mdspan<ElementType_c, extents<SizeType_c, ext_c...>, Layout_c, Accessor_c> c,
+  mdspan<ElementType_s, extents<SizeType_s, ext_s...>, Layout_s, Accessor_s> s)
+{
+  givens_rotation_sequence_apply(impl::default_exec_t{}, A, c, s);
+}
+
 } // end namespace linalg
 } // end inline namespace __p1673_version_0
 } // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
@@ -81,8 +81,10 @@ void add_rank_1(
                 x.static_extent(0) == y.static_extent(0));
 
   using size_type = std::common_type_t<SizeType_x, SizeType_y, SizeType_z>;
+  const auto x_elements = impl::decompose_accessor(x);
+  const auto y_elements = impl::decompose_accessor(y);
   for (size_type i = 0; i < z.extent(0); ++i) {
-    z(i) = x(i) + y(i);
+    z(i) = x_elements(i) + y_elements(i);
   }
 }
 
@@ -130,9 +132,11 @@ void add_rank_2(
                 x.static_extent(1) == y.static_extent(1));
 
   using size_type = std::common_type_t<SizeType_x, SizeType_y, SizeType_z>;
+  const auto x_elements = impl::decompose_accessor(x);
+  const auto y_elements = impl::decompose_accessor(y);
   for (size_type j = 0; j < x.extent(1); ++j) {
     for (size_type i = 0; i < x.extent(0); ++i) {
-      z(i,j) = x(i,j) + y(i,j);
+      z(i,j) = x_elements(i,j) + y_elements(i,j);
     }
   }
 }
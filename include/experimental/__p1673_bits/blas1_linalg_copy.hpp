@@ -68,8 +68,9 @@ void copy_rank_1(
                 y.static_extent(0) == dynamic_extent ||
                 x.static_extent(0) == y.static_extent(0));
   using size_type = std::common_type_t<SizeType_x, SizeType_y>;
+  const auto x_elements = impl::decompose_accessor(x);
   for (size_type i = 0; i < y.extent(0); ++i) {
-    y(i) = x(i);
+    y(i) = x_elements(i);
   }
 }
 
@@ -96,9 +97,10 @@ void copy_rank_2(
                 y.static_extent(1) == dynamic_extent ||
                 x.static_extent(1) == y.static_extent(1));
   using size_type = std::common_type_t<SizeType_x, SizeType_y>;
+  const auto x_elements = impl::decompose_accessor(x);
   for (size_type j = 0; j < y.extent(1); ++j) {
     for (size_type i = 0; i < y.extent(0); ++i) {
-      y(i,j) = x(i,j);
+      y(i,j) = x_elements(i,j);
     }
   }
 }
@@ -76,6 +76,37 @@ struct is_custom_matrix_frob_norm_avail<
   : std::true_type{};
 } // end anonymous namespace
 
+namespace impl {
+
+// Add the squares of A's elements, row by row, to the sum of squares
+// scale^2 * ssq.  Rescaling, as in the Reference BLAS DNRM2
+// implementation, avoids unwarranted overflow or underflow.
+template<class in_matrix_t, class Scalar>
+void matrix_sum_of_squares_update(const in_matrix_t& A, Scalar& scale, Scalar& ssq)
+{
+  using std::abs;
+  using size_type = typename in_matrix_t::index_type;
+  const auto A_elements = decompose_accessor(A);
+  for (size_type i = 0; i < A.extent(0); ++i) {
+    for (size_type j = 0; j < A.extent(1); ++j) {
+      const auto absaij = abs(A_elements(i,j));
+      if (absaij != 0.0) {
+        if (scale < absaij) {
+          const auto quotient = scale / absaij;
+          ssq = Scalar(1.0) + ssq * quotient * quotient;
+          scale = absaij;
+        }
+        else {
+          const auto quotient = absaij / scale;
+          ssq = ssq + quotient * quotient;
+        }
+      }
+    }
+  }
+}
+
+} // end namespace impl
+
 template<
     class ElementType,
     class SizeType,
@@ -103,24 +134,9 @@ Scalar matrix_frob_norm(
     return result;
   }
 
-  // Rescaling avoids unwarranted overflow or underflow.
   Scalar scale = 0.0;
   Scalar ssq = 1.0;
-  for (size_type i = 0; i < A.extent(0); ++i) {
-    for (size_type j = 0; j < A.extent(1); ++j) {
-      const auto absaij = abs(A(i,j));
-      if (absaij != 0.0) {
-        const auto quotient = scale / absaij;
-        if (scale < absaij) {
-          ssq = Scalar(1.0) + ssq * quotient * quotient;
-          scale = absaij;
-        }
-        else {
-          ssq = ssq + quotient * quotient;
-        }
-      }
-    }
-  }
+  impl::matrix_sum_of_squares_update(A, scale, ssq);
   result += scale * sqrt(ssq);
   return result;
 }
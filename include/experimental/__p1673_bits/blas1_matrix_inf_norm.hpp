@@ -104,10 +104,11 @@ Scalar matrix_inf_norm(
     return result;
   }
 
+  const auto A_elements = impl::decompose_accessor(A);
   for (size_type i = 0; i < A.extent(0); ++i) {
     auto row_sum = init;
     for (size_type j = 0; j < A.extent(1); ++j) {
-      row_sum += abs(A(i,j));
+      row_sum += abs(A_elements(i,j));
     }
     result = max(row_sum, result);
   }
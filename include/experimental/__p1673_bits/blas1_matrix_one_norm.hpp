@@ -105,12 +105,13 @@ Scalar matrix_one_norm(
     return result;
   }
 
+  const auto A_elements = impl::decompose_accessor(A);
   // These loops can be rearranged for optimal memory access patterns,
   // but it would require dynamic memory allocation.
   for (size_type j = 0; j < A.extent(1); ++j) {
     auto col_sum = init;
     for (size_type i = 0; i < A.extent(0); ++i) {
-      col_sum += abs(A(i,j));
+      col_sum += abs(A_elements(i,j));
     }
     result = max(col_sum, result);
   }
@@ -115,7 +115,10 @@ void scale(
 {
   static_assert(x.rank() <= 2);
 
-  if constexpr (x.rank() == 1) {
+  if constexpr (impl::static_kernel_eligible<(ext * ... * 1), decltype(x)>()) {
+    impl::static_scale(alpha, x);
+  }
+  else if constexpr (x.rank() == 1) {
     linalg_scale_rank_1(alpha, x);
   }
   else if constexpr (x.rank() == 2) {
@@ -84,12 +84,23 @@ Scalar vector_abs_sum(
   mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
   Scalar init)
 {
+  using std::abs;
   const SizeType numElt = v.extent(0);
-  for (SizeType i = 0; i < numElt; ++i) {
-    using std::abs;
-    init += abs(v(i));
+  if constexpr (impl::is_decomposable_accessor_v<decltype(v)>) {
+    // |alpha * conj(s)| = |alpha| * |s|, so alpha comes out of the sum.
+    const auto v_elements = impl::decompose_accessor(v);
+    Scalar sum{};
+    for (SizeType i = 0; i < numElt; ++i) {
+      sum += abs(v_elements.stored(i));
+    }
+    return init + abs(v_elements.alpha) * sum;
+  }
+  else {
+    for (SizeType i = 0; i < numElt; ++i) {
+      init += abs(v(i));
+    }
+    return init;
   }
-  return init;
 }
 
 template<class ExecutionPolicy,
@@ -43,11 +43,152 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_VECTOR_IDX_ABS_MAX_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_VECTOR_IDX_ABS_MAX_HPP_
 
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
 namespace linalg {
 
+// Magnitudes that idx_abs_max can compare.
+//
+// idx_abs_max_modulus, the default, compares abs(v(i)).
+// idx_abs_max_abs_parts compares |real(v(i))| + |imag(v(i))|, like the
+// BLAS ICAMAX and IZAMAX.  That needs no square root, so it vectorizes
+// for complex vectors too.  The two are the same for real vectors.
+struct idx_abs_max_modulus_t {
+  explicit idx_abs_max_modulus_t() = default;
+};
+inline constexpr idx_abs_max_modulus_t idx_abs_max_modulus{};
+
+struct idx_abs_max_abs_parts_t {
+  explicit idx_abs_max_abs_parts_t() = default;
+};
+inline constexpr idx_abs_max_abs_parts_t idx_abs_max_abs_parts{};
+
+namespace impl {
+
+template<class T>
+inline constexpr bool is_idx_abs_max_magnitude_v =
+  std::is_same_v<T, idx_abs_max_modulus_t> ||
+  std::is_same_v<T, idx_abs_max_abs_parts_t>;
+
+template<class T>
+auto idx_abs_max_magnitude(const T& x, idx_abs_max_modulus_t)
+{
+  using std::abs;
+  return abs(x);
+}
+
+template<class T>
+auto idx_abs_max_magnitude(const T& x, idx_abs_max_abs_parts_t)
+{
+  using std::abs;
+  if constexpr (is_complex_v<T>) {
+    return abs(x.real()) + abs(x.imag());
+  }
+  else {
+    return abs(x);
+  }
+}
+
+// The first element of largest magnitude in part of a vector.  found
+// is false if there is no such element: the part is empty, or all its
+// magnitudes are NaN.
+template<class Index, class Magnitude>
+struct idx_abs_max_result {
+  Index index;
+  Magnitude magnitude;
+  bool found;
+};
+
+// The SIMD kernels take vectors of float or double that read straight
+// from arrays (possibly scaled or conjugated), and complex vectors
+// when comparing idx_abs_max_abs_parts.
+template<class in_vector_t, class Magnitude>
+constexpr bool idx_abs_max_simd_eligible()
+{
+  using value_type = typename in_vector_t::value_type;
+  return is_blas_scalar_v<value_type> &&
+    (! is_complex_v<value_type> ||
+     std::is_same_v<Magnitude, idx_abs_max_abs_parts_t>) &&
+    blas_traits_t<value_type, in_vector_t>::valid &&
+    in_vector_t::is_always_strided();
+}
+
+template<class in_vector_t, class Magnitude>
+auto idx_abs_max_generic_search(in_vector_t v, Magnitude magnitude)
+{
+  using value_type = typename in_vector_t::value_type;
+  using index_type = typename in_vector_t::index_type;
+  using magnitude_type =
+    decltype(idx_abs_max_magnitude(std::declval<value_type>(), magnitude));
+
+  idx_abs_max_result<index_type, magnitude_type> best{0, magnitude_type{}, false};
+  for (index_type i = 0; i < v.extent(0); ++i) {
+    const magnitude_type a = idx_abs_max_magnitude(value_type(v(i)), magnitude);
+    // Skip NaN, which never compares greater than anything.
+    if (best.found ? best.magnitude < a : a == a) {
+      best = {i, a, true};
+    }
+  }
+  return best;
+}
+
+// The first element of largest magnitude in v, skipping NaN.
+template<class in_vector_t, class Magnitude>
+auto idx_abs_max_search(in_vector_t v, Magnitude magnitude)
+{
+  if constexpr (idx_abs_max_simd_eligible<in_vector_t, Magnitude>()) {
+    using value_type = typename in_vector_t::value_type;
+    using index_type = typename in_vector_t::index_type;
+    using real_type = simd_real_t<value_type>;
+
+    const std::size_t n = v.extent(0);
+    if (n == 0) {
+      return idx_abs_max_result<index_type, real_type>{0, real_type{}, false};
+    }
+    // |alpha * x| rounds to |alpha| * |x| only for real alpha.
+    const value_type alpha =
+      blas_traits_t<value_type, in_vector_t>::scaling_factor(v.accessor());
+    using std::abs;
+    real_type scale{};
+    if constexpr (is_complex_v<value_type>) {
+      if (alpha.imag() != real_type(0)) {
+        return idx_abs_max_generic_search(v, magnitude);
+      }
+      scale = abs(alpha.real());
+    }
+    else {
+      scale = abs(alpha);
+    }
+    const value_type* data = v.data_handle() + v.mapping()(0);
+    const auto best = simd_iamax<is_complex_v<value_type>>(n,
+      simd_real_data(data), std::ptrdiff_t(v.stride(0)), scale);
+    return idx_abs_max_result<index_type, real_type>{
+      index_type(best.index), best.magnitude, best.magnitude >= real_type(0)};
+  }
+  else {
+    return idx_abs_max_generic_search(v, magnitude);
+  }
+}
+
+// The answer for nonempty v, given the result of searching all of it.
+// As in the reference BLAS, NaN in v(0) wins, since nothing compares
+// greater than it.
+template<class in_vector_t, class Magnitude, class Result>
+typename in_vector_t::index_type
+idx_abs_max_index(in_vector_t v, Magnitude magnitude, const Result& best)
+{
+  using value_type = typename in_vector_t::value_type;
+  const auto a0 = idx_abs_max_magnitude(value_type(v(0)), magnitude);
+  return (best.found && a0 == a0) ? best.index : 0;
+}
+
+} // end namespace impl
+
 // begin anonymous namespace
 namespace {
 
@@ -61,7 +202,24 @@ struct is_custom_idx_abs_max_avail<
     //FRizzi: maybe should use is_convertible?
     std::is_same<
       decltype(idx_abs_max(std::declval<Exec>(), std::declval<v_t>())),
-      typename v_t::extents_type::size_type
+      typename v_t::index_type
+      >::value
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+template <class Exec, class v_t, class Magnitude, class = void>
+struct is_custom_idx_abs_max_with_magnitude_avail : std::false_type {};
+
+template <class Exec, class v_t, class Magnitude>
+struct is_custom_idx_abs_max_with_magnitude_avail<
+  Exec, v_t, Magnitude,
+  std::enable_if_t<
+    std::is_same<
+      decltype(idx_abs_max(std::declval<Exec>(), std::declval<v_t>(),
+                           std::declval<Magnitude>())),
+      typename v_t::index_type
       >::value
     && ! impl::is_inline_exec_v<Exec>
     >
@@ -71,30 +229,34 @@ struct is_custom_idx_abs_max_avail<
 template<class ElementType,
          class SizeType, ::std::size_t ext0,
          class Layout,
-         class Accessor>
+         class Accessor,
+         class Magnitude>
 SizeType idx_abs_max_default_impl(
-  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v)
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Magnitude magnitude)
 {
-  using std::abs;
-  using magnitude_type = decltype(abs(v(0)));
-
   if (v.extent(0) == 0) {
     return std::numeric_limits<SizeType>::max();
   }
-
-  SizeType maxInd = 0;
-  magnitude_type maxVal = abs(v(0));
-  for (SizeType i = 1; i < v.extent(0); ++i) {
-    if (maxVal < abs(v(i))) {
-      maxVal = abs(v(i));
-      maxInd = i;
-    }
-  }
-  return maxInd; // FIXME check for NaN "never less than" stuff
+  return impl::idx_abs_max_index(v, magnitude, impl::idx_abs_max_search(v, magnitude));
 }
 
 } // end anonymous namespace
 
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Magnitude,
+         std::enable_if_t<impl::is_idx_abs_max_magnitude_v<Magnitude>, bool> = true>
+SizeType idx_abs_max(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Magnitude magnitude)
+{
+  return idx_abs_max_default_impl(v, magnitude);
+}
+
 template<class ElementType,
          class SizeType, ::std::size_t ext0,
          class Layout,
@@ -103,7 +265,35 @@ SizeType idx_abs_max(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v)
 {
-  return idx_abs_max_default_impl(v);
+  return idx_abs_max_default_impl(v, idx_abs_max_modulus);
+}
+
+template<class ExecutionPolicy,
+         class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Magnitude,
+         std::enable_if_t<impl::is_idx_abs_max_magnitude_v<Magnitude>, bool> = true>
+SizeType idx_abs_max(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Magnitude magnitude)
+{
+  if (v.extent(0) == 0) {
+    return std::numeric_limits<SizeType>::max();
+  }
+
+  constexpr bool use_custom = is_custom_idx_abs_max_with_magnitude_avail<
+    decltype(execpolicy_mapper(exec)), decltype(v), Magnitude
+    >::value;
+
+  if constexpr (use_custom) {
+    return idx_abs_max(execpolicy_mapper(exec), v, magnitude);
+  }
+  else {
+    return idx_abs_max(impl::inline_exec_t{}, v, magnitude);
+  }
 }
 
 template<class ExecutionPolicy,
@@ -131,6 +321,19 @@ SizeType idx_abs_max(
   }
 }
 
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Magnitude,
+         std::enable_if_t<impl::is_idx_abs_max_magnitude_v<Magnitude>, bool> = true>
+SizeType idx_abs_max(
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Magnitude magnitude)
+{
+  return idx_abs_max(impl::default_exec_t{}, v, magnitude);
+}
+
 template<class ElementType,
          class SizeType, ::std::size_t ext0,
          class Layout,
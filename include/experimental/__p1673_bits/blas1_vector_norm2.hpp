@@ -46,6 +46,7 @@
 #include "blas1_vector_sum_of_squares.hpp"
 #include <cmath>
 #include <cstdlib>
+#include <type_traits>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
@@ -134,6 +135,30 @@ Scalar vector_norm2(
   return vector_norm2(impl::default_exec_t{}, x, init);
 }
 
+// Euclidean norm with a chosen algorithm for the sum of squares,
+// sum_of_squares_rescaling or sum_of_squares_blue.
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar,
+         class SumOfSquaresAlgorithm,
+         std::enable_if_t<
+           std::is_same_v<SumOfSquaresAlgorithm, sum_of_squares_rescaling_t> ||
+           std::is_same_v<SumOfSquaresAlgorithm, sum_of_squares_blue_t>, bool> = true>
+Scalar vector_norm2(
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  Scalar init,
+  SumOfSquaresAlgorithm algorithm)
+{
+  sum_of_squares_result<Scalar> ssq_init;
+  ssq_init.scaling_factor = Scalar{};
+  ssq_init.scaled_sum_of_squares = 1.0;
+  auto ssq_res = vector_sum_of_squares(x, ssq_init, algorithm);
+  using std::sqrt;
+  return init + ssq_res.scaling_factor * sqrt(ssq_res.scaled_sum_of_squares);
+}
+
 
 namespace vector_norm2_detail {
   using std::abs;
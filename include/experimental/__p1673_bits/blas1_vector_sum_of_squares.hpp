@@ -44,7 +44,9 @@
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS1_VECTOR_SUM_OF_SQUARES_HPP_
 
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
+#include <type_traits>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
@@ -58,6 +60,26 @@ struct sum_of_squares_result {
   Scalar scaled_sum_of_squares;
 };
 
+// Algorithms for vector_sum_of_squares and vector_norm2.
+//
+// sum_of_squares_rescaling is the reference BLAS DNRM2 update, which
+// rescales the running sum whenever a larger element comes along and
+// so divides once per element.  sum_of_squares_blue is Blue's
+// algorithm, which sorts the elements into three accumulators by
+// magnitude and needs no divisions, so it vectorizes.  Both avoid
+// unwarranted overflow and underflow.  By default, the algorithms use
+// Blue's algorithm for vectors of float, double, or their complex
+// types stored in arrays, and rescaling for everything else.
+struct sum_of_squares_rescaling_t {
+  explicit sum_of_squares_rescaling_t() = default;
+};
+inline constexpr sum_of_squares_rescaling_t sum_of_squares_rescaling{};
+
+struct sum_of_squares_blue_t {
+  explicit sum_of_squares_blue_t() = default;
+};
+inline constexpr sum_of_squares_blue_t sum_of_squares_blue{};
+
 namespace
 {
 template <class Exec, class x_t, class Scalar, class = void>
@@ -82,16 +104,98 @@ struct is_custom_vector_sum_of_squares_avail<
 
 } // end anonymous namespace
 
-template<class ElementType,
-	 class SizeType,
-         ::std::size_t ext0,
-         class Layout,
-         class Accessor,
-         class Scalar>
-sum_of_squares_result<Scalar> vector_sum_of_squares(
-  impl::inline_exec_t&& /* exec */,
-  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
-  sum_of_squares_result<Scalar> init)
+namespace impl {
+
+// Add the sum of squares scale^2 * ssq to init.
+template<class Scalar>
+sum_of_squares_result<Scalar> sum_of_squares_merge(
+  sum_of_squares_result<Scalar> init, Scalar scale, Scalar ssq)
+{
+  if (ssq == Scalar(0)) {
+    return init;
+  }
+  if (init.scaling_factor == Scalar(0)) {
+    return {scale, ssq};
+  }
+  if (init.scaling_factor < scale) {
+    const Scalar ratio = init.scaling_factor / scale;
+    return {scale, ssq + init.scaled_sum_of_squares * ratio * ratio};
+  }
+  const Scalar ratio = scale / init.scaling_factor;
+  return {init.scaling_factor, init.scaled_sum_of_squares + ssq * ratio * ratio};
+}
+
+// Blue's algorithm can read x's array directly if x holds float,
+// double, or their complex types, possibly scaled, and Scalar is the
+// matching real type.
+template<class Scalar, class in_vector_t>
+constexpr bool sum_of_squares_simd_eligible()
+{
+  using value_type = typename in_vector_t::value_type;
+  return is_blas_scalar_v<value_type> &&
+    std::is_same_v<Scalar, simd_real_t<value_type>> &&
+    blas_traits_t<value_type, in_vector_t>::valid &&
+    in_vector_t::is_always_strided();
+}
+
+template<class Scalar, class in_vector_t>
+sum_of_squares_result<Scalar> sum_of_squares_simd(
+  in_vector_t x, sum_of_squares_result<Scalar> init)
+{
+  using value_type = typename in_vector_t::value_type;
+  const std::size_t n = x.extent(0);
+  if (n == 0) {
+    return init;
+  }
+  const value_type* data = x.data_handle() + x.mapping()(0);
+  const std::ptrdiff_t incx = std::ptrdiff_t(x.stride(0));
+  blue_sums<Scalar> sums;
+  if constexpr (is_complex_v<value_type>) {
+    // Real and imaginary parts are just more elements to square.
+    const Scalar* reals = simd_real_data(data);
+    if (incx == 1) {
+      sums = simd_blue_sums(2 * n, reals, 1);
+    }
+    else {
+      const auto re = simd_blue_sums(n, reals, 2 * incx);
+      const auto im = simd_blue_sums(n, reals + 1, 2 * incx);
+      sums = {re.small + im.small, re.medium + im.medium, re.big + im.big};
+    }
+  }
+  else {
+    sums = simd_blue_sums(n, data, incx);
+  }
+  auto [scale, ssq] = blue_combine(sums);
+  using std::abs;
+  scale *= Scalar(abs(blas_traits_t<value_type, in_vector_t>::scaling_factor(x.accessor())));
+  return sum_of_squares_merge(init, scale, ssq);
+}
+
+// Blue's algorithm through x's mdspan interface, for everything else.
+template<class Scalar, class in_vector_t>
+sum_of_squares_result<Scalar> sum_of_squares_blue_generic(
+  in_vector_t x, sum_of_squares_result<Scalar> init)
+{
+  using value_type = typename in_vector_t::value_type;
+  blue_sums<Scalar> sums;
+  for (std::size_t i = 0; i < x.extent(0); ++i) {
+    const value_type x_i = x(i);
+    if constexpr (is_complex_v<value_type>) {
+      blue_accumulate(sums, Scalar(x_i.real()));
+      blue_accumulate(sums, Scalar(x_i.imag()));
+    }
+    else {
+      using std::abs;
+      blue_accumulate(sums, Scalar(abs(x_i)));
+    }
+  }
+  const auto [scale, ssq] = blue_combine(sums);
+  return sum_of_squares_merge(init, scale, ssq);
+}
+
+template<class Scalar, class in_vector_t>
+sum_of_squares_result<Scalar> sum_of_squares_rescaling_update(
+  in_vector_t x, sum_of_squares_result<Scalar> init)
 {
   using std::abs;
 
@@ -104,15 +208,16 @@ sum_of_squares_result<Scalar> vector_sum_of_squares(
 
   Scalar scale = init.scaling_factor;
   Scalar ssq = init.scaled_sum_of_squares;
-  for (SizeType i = 0; i < x.extent(0); ++i) {
+  for (typename in_vector_t::index_type i = 0; i < x.extent(0); ++i) {
     if (abs(x(i)) != 0.0) {
       const auto absxi = abs(x(i));
-      const auto quotient = scale / absxi;
       if (scale < absxi) {
-          ssq = Scalar(1.0) + ssq * quotient * quotient;
-          scale = absxi;
+        const auto quotient = scale / absxi;
+        ssq = Scalar(1.0) + ssq * quotient * quotient;
+        scale = absxi;
       }
       else {
+        const auto quotient = absxi / scale;
         ssq = ssq + quotient * quotient;
       }
     }
@@ -124,6 +229,27 @@ sum_of_squares_result<Scalar> vector_sum_of_squares(
   return result;
 }
 
+} // end namespace impl
+
+template<class ElementType,
+	 class SizeType,
+         ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+sum_of_squares_result<Scalar> vector_sum_of_squares(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  sum_of_squares_result<Scalar> init)
+{
+  if constexpr (impl::sum_of_squares_simd_eligible<Scalar, decltype(x)>()) {
+    return impl::sum_of_squares_simd(x, init);
+  }
+  else {
+    return impl::sum_of_squares_rescaling_update(x, init);
+  }
+}
+
 template<class ExecutionPolicy,
          class ElementType,
 	 class SizeType,
@@ -162,6 +288,39 @@ sum_of_squares_result<Scalar> vector_sum_of_squares(
   return vector_sum_of_squares(impl::default_exec_t{}, v, init);
 }
 
+template<class ElementType,
+	 class SizeType,
+         ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+sum_of_squares_result<Scalar> vector_sum_of_squares(
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  sum_of_squares_result<Scalar> init,
+  sum_of_squares_rescaling_t /* algorithm */)
+{
+  return impl::sum_of_squares_rescaling_update(v, init);
+}
+
+template<class ElementType,
+	 class SizeType,
+         ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+sum_of_squares_result<Scalar> vector_sum_of_squares(
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  sum_of_squares_result<Scalar> init,
+  sum_of_squares_blue_t /* algorithm */)
+{
+  if constexpr (impl::sum_of_squares_simd_eligible<Scalar, decltype(v)>()) {
+    return impl::sum_of_squares_simd(v, init);
+  }
+  else {
+    return impl::sum_of_squares_blue_generic(v, init);
+  }
+}
+
 
 } // end namespace linalg
 } // end inline namespace __p1673_version_0
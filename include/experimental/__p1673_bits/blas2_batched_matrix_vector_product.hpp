@@ -0,0 +1,391 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_BATCHED_MATRIX_VECTOR_PRODUCT_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_BATCHED_MATRIX_VECTOR_PRODUCT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+// Batched matrix-vector products: y[b] := A[b] * x[b], or y[b] :=
+// y0[b] + A[b] * x[b], for a rank-3 batch A of matrices (batch, rows,
+// columns) and rank-2 batches x, y of vectors (batch, length).  When
+// the batch index has stride 1 in all of them (as with
+// layout_batch_interleaved), the SIMD lanes run across the items; see
+// blas3_batched_matrix_product.hpp.  Otherwise each item goes through
+// matrix_vector_product.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+
+namespace impl {
+
+// y(b,:) := init(b,:) + A(b,:,:) * x(b,:) for b in [b_begin, b_end),
+// for batches with unit batch stride.
+template<class in_batch_t, class in_vector_batch_t, class out_vector_batch_t, class Init>
+void interleaved_batched_gemv(const in_batch_t& A, const in_vector_batch_t& x,
+                              const out_vector_batch_t& y, Init init,
+                              std::size_t b_begin, std::size_t b_end)
+{
+  using value_type = typename out_vector_batch_t::value_type;
+  const std::size_t m = A.extent(1);
+  const std::size_t n = A.extent(2);
+  if (b_begin >= b_end || m == 0) {
+    return;
+  }
+  const value_type* const a = A.data_handle();
+  const value_type* const xp = x.data_handle();
+  value_type* const yp = y.data_handle();
+  const std::size_t a_i = A.stride(1), a_j = A.stride(2);
+  const std::size_t x_j = x.stride(1), y_i = y.stride(1);
+  const simd_isa isa = active_simd_isa();
+  const std::size_t chunk =
+    interleaved_batch_chunk(m * n + m + n, sizeof(value_type));
+
+  for (std::size_t b0 = b_begin; b0 < b_end; b0 += chunk) {
+    const std::size_t w = std::min(chunk, b_end - b0);
+    for (std::size_t i = 0; i < m; ++i) {
+      value_type* const y_b = yp + b0 + i * y_i;
+      for (std::size_t t = 0; t < w; ++t) {
+        y_b[t] = init(b0 + t, i);
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        simd_multiply_add(isa, a + b0 + i * a_i + j * a_j, xp + b0 + j * x_j, y_b, w);
+      }
+    }
+  }
+}
+
+// The products of items [b_begin, b_end) of a batch.  init(b, i) is
+// the value that y(b,i) starts from; item_product(b) computes item b
+// with matrix_vector_product.
+template<class in_batch_t, class in_vector_batch_t, class out_vector_batch_t,
+         class Init, class ItemProduct>
+void batched_matrix_vector_product_block(const in_batch_t& A, const in_vector_batch_t& x,
+                                         const out_vector_batch_t& y, Init init,
+                                         ItemProduct item_product,
+                                         std::size_t b_begin, std::size_t b_end)
+{
+  if constexpr (interleaved_batch_eligible<out_vector_batch_t, in_batch_t, in_vector_batch_t>()) {
+    if (unit_batch_stride(A, x, y)) {
+      interleaved_batched_gemv(A, x, y, init, b_begin, b_end);
+      return;
+    }
+  }
+  if constexpr (! std::is_same_v<ItemProduct, std::nullptr_t>) {
+    for (std::size_t b = b_begin; b < b_end; ++b) {
+      item_product(b);
+    }
+  }
+  else {
+    for (std::size_t b = b_begin; b < b_end; ++b) {
+      for (std::size_t i = 0; i < A.extent(1); ++i) {
+        y(b,i) = init(b, i);
+        for (std::size_t j = 0; j < A.extent(2); ++j) {
+          y(b,i) += A(b,i,j) * x(b,j);
+        }
+      }
+    }
+  }
+}
+
+// y(b,:) := A(b,:,:) * x(b,:) for b in [b_begin, b_end).
+template<class in_batch_t, class in_vector_batch_t, class out_vector_batch_t>
+void batched_matrix_vector_product_block(const in_batch_t& A, const in_vector_batch_t& x,
+                                         const out_vector_batch_t& y,
+                                         std::size_t b_begin, std::size_t b_end)
+{
+  using element_type = typename out_vector_batch_t::element_type;
+  auto init = [] (std::size_t, std::size_t) { return element_type{}; };
+  if constexpr (in_batch_t::is_always_strided() && in_vector_batch_t::is_always_strided() &&
+                out_vector_batch_t::is_always_strided()) {
+    batched_matrix_vector_product_block(A, x, y, init, [&] (std::size_t b) {
+        linalg::matrix_vector_product(inline_exec_t{}, batch_item(A, b), batch_item(x, b),
+                                      batch_item(y, b));
+      }, b_begin, b_end);
+  }
+  else {
+    batched_matrix_vector_product_block(A, x, y, init, nullptr, b_begin, b_end);
+  }
+}
+
+// y(b,:) := y0(b,:) + A(b,:,:) * x(b,:) for b in [b_begin, b_end).
+template<class in_batch_t, class in_vector_batch_1_t, class in_vector_batch_2_t,
+         class out_vector_batch_t>
+void batched_matrix_vector_product_block(const in_batch_t& A, const in_vector_batch_1_t& x,
+                                         const in_vector_batch_2_t& y0,
+                                         const out_vector_batch_t& y,
+                                         std::size_t b_begin, std::size_t b_end)
+{
+  // y0 may be y itself; each element of y0 is read before y's element
+  // in the same place is written.
+  auto init = [&] (std::size_t b, std::size_t i) { return y0(b,i); };
+  if constexpr (in_batch_t::is_always_strided() && in_vector_batch_1_t::is_always_strided() &&
+                in_vector_batch_2_t::is_always_strided() &&
+                out_vector_batch_t::is_always_strided()) {
+    batched_matrix_vector_product_block(A, x, y, init, [&] (std::size_t b) {
+        linalg::matrix_vector_product(inline_exec_t{}, batch_item(A, b), batch_item(x, b),
+                                      batch_item(y0, b), batch_item(y, b));
+      }, b_begin, b_end);
+  }
+  else {
+    batched_matrix_vector_product_block(A, x, y, init, nullptr, b_begin, b_end);
+  }
+}
+
+} // end namespace impl
+
+namespace {
+
+template <class Exec, class A_t, class X_t, class Y_t, class = void>
+struct is_custom_batched_mat_vec_product_avail : std::false_type {};
+
+template <class Exec, class A_t, class X_t, class Y_t>
+struct is_custom_batched_mat_vec_product_avail<
+  Exec, A_t, X_t, Y_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       batched_matrix_vector_product
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<X_t>(),
+		std::declval<Y_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+template <class Exec, class A_t, class X_t, class Y_t, class Z_t, class = void>
+struct is_custom_batched_mat_vec_product_with_update_avail : std::false_type {};
+
+template <class Exec, class A_t, class X_t, class Y_t, class Z_t>
+struct is_custom_batched_mat_vec_product_with_update_avail<
+  Exec, A_t, X_t, Y_t, Z_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       batched_matrix_vector_product
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<X_t>(),
+		std::declval<Y_t>(),
+		std::declval<Z_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+} // end anonymous namespace
+
+// Overwriting batched matrix-vector product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void batched_matrix_vector_product(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  impl::batched_matrix_vector_product_block(A, x, y, 0, A.extent(0));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void batched_matrix_vector_product(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  constexpr bool use_custom = is_custom_batched_mat_vec_product_avail<
+    decltype(execpolicy_mapper(exec)), decltype(A), decltype(x), decltype(y)>::value;
+
+  if constexpr (use_custom) {
+    batched_matrix_vector_product(execpolicy_mapper(exec), A, x, y);
+  }
+  else {
+    batched_matrix_vector_product(impl::inline_exec_t{}, A, x, y);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void batched_matrix_vector_product(
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  batched_matrix_vector_product(impl::default_exec_t{}, A, x, y);
+}
+
+// Updating batched matrix-vector product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t batch_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void batched_matrix_vector_product(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, batch_z, ext_z>, Layout_z, Accessor_z> z)
+{
+  impl::batched_matrix_vector_product_block(A, x, y, z, 0, A.extent(0));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t batch_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void batched_matrix_vector_product(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, batch_z, ext_z>, Layout_z, Accessor_z> z)
+{
+  constexpr bool use_custom = is_custom_batched_mat_vec_product_with_update_avail<
+    decltype(execpolicy_mapper(exec)), decltype(A), decltype(x), decltype(y), decltype(z)>::value;
+
+  if constexpr (use_custom) {
+    batched_matrix_vector_product(execpolicy_mapper(exec), A, x, y, z);
+  }
+  else {
+    batched_matrix_vector_product(impl::inline_exec_t{}, A, x, y, z);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t batch_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void batched_matrix_vector_product(
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, batch_z, ext_z>, Layout_z, Accessor_z> z)
+{
+  batched_matrix_vector_product(impl::default_exec_t{}, A, x, y, z);
+}
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_BATCHED_MATRIX_VECTOR_PRODUCT_HPP_
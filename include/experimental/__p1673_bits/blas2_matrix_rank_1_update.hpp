@@ -159,6 +159,223 @@ struct is_custom_hermitian_matrix_rank_1_update_avail<
 
 } // end anonymous namespace
 
+namespace impl {
+
+// Outer-product update A := A + u_0 v_0^T + ... + u_{R-1} v_{R-1}^T of
+// the elements of A in the Triangle, or of all of A if Triangle is
+// void: the common kernel of the rank-1 and rank-2 updates.  A is a
+// column-major or row-major array of BLAS scalars, and is updated one
+// line (column or row) at a time in storage order.  Each line gets one
+// call of the SIMD axpy kernel over the part of the line in the
+// triangle, with the line's R factors in registers, so the inner loop
+// neither branches on the triangle nor reads x and y through their
+// accessors.
+//
+// The factors are copied into contiguous arrays once, so that each
+// line reads them in order, and so that the lines can be updated in
+// parallel.
+
+template<class inout_matrix_t>
+constexpr bool outer_product_update_eligible()
+{
+  return is_blas_writable_v<inout_matrix_t> &&
+    ! std::is_void_v<static_storage_order_t<typename inout_matrix_t::layout_type>>;
+}
+
+template<class inout_matrix_t, class Triangle, std::size_t R>
+class outer_product_update {
+public:
+  using value_type = typename inout_matrix_t::element_type;
+  static constexpr std::size_t rank = R;
+
+private:
+  static constexpr bool column_major = std::is_same_v<
+    static_storage_order_t<typename inout_matrix_t::layout_type>, column_major_t>;
+  using opposite_triangle = std::conditional_t<
+    std::is_same_v<Triangle, lower_triangle_t>, upper_triangle_t, lower_triangle_t>;
+
+public:
+  // Triangle of the matrix whose columns are A's lines: a row of A's
+  // lower triangle holds the elements up to the diagonal, like a
+  // column of an upper triangle.
+  using line_triangle_type = std::conditional_t<std::is_void_v<Triangle> || column_major,
+                                                Triangle, opposite_triangle>;
+
+  // u(q, i) is u_q(i), and v(q, j) is v_q(j).
+  template<class U, class V>
+  outer_product_update(const inout_matrix_t& A, U u, V v) :
+    a_(nullptr), lda_(0),
+    num_lines_(column_major ? A.extent(1) : A.extent(0)),
+    line_length_(column_major ? A.extent(0) : A.extent(1)),
+    along_(R * line_length_), factors_(R * num_lines_)
+  {
+    if (num_lines_ == 0 || line_length_ == 0) {
+      return;
+    }
+    a_ = A.data_handle() + A.mapping()(0, 0);
+    lda_ = column_major ? A.stride(1) : A.stride(0);
+    for (std::size_t q = 0; q < R; ++q) {
+      for (std::size_t k = 0; k < line_length_; ++k) {
+        along_[q * line_length_ + k] = column_major ? value_type(u(q, k)) : value_type(v(q, k));
+      }
+      for (std::size_t l = 0; l < num_lines_; ++l) {
+        factors_[q * num_lines_ + l] = column_major ? value_type(v(q, l)) : value_type(u(q, l));
+      }
+    }
+  }
+
+  std::size_t num_lines() const { return num_lines_; }
+  std::size_t line_length() const { return line_length_; }
+
+  void update() const
+  {
+    update_lines(0, num_lines_);
+  }
+
+  // Updates the lines [l_begin, l_end) of A.
+  void update_lines(std::size_t l_begin, std::size_t l_end) const
+  {
+    constexpr bool lower = std::is_same_v<line_triangle_type, lower_triangle_t>;
+    constexpr bool upper = std::is_same_v<line_triangle_type, upper_triangle_t>;
+    for (std::size_t l = l_begin; l < l_end; ++l) {
+      const std::size_t k_begin = lower ? l : 0;
+      const std::size_t k_end = upper ? std::min(l + 1, line_length_) : line_length_;
+      if (k_begin >= k_end) {
+        continue;
+      }
+      value_type c[R];
+      for (std::size_t q = 0; q < R; ++q) {
+        c[q] = factors_[q * num_lines_ + l];
+      }
+      simd_gemv_axpy_columns<R>(along_.data() + k_begin, line_length_, c,
+                                a_ + l * lda_ + k_begin, k_end - k_begin);
+    }
+  }
+
+private:
+  value_type* a_;
+  std::size_t lda_;
+  std::size_t num_lines_;
+  std::size_t line_length_;
+  // along_[q * line_length_ + k]: element k of the factor q that runs
+  // along each line.  factors_[q * num_lines_ + l]: the other factor
+  // q's element for line l.
+  std::vector<value_type> along_;
+  std::vector<value_type> factors_;
+};
+
+template<class Triangle, std::size_t R, class inout_matrix_t, class U, class V>
+outer_product_update<inout_matrix_t, Triangle, R>
+make_outer_product_update(const inout_matrix_t& A, U u, V v)
+{
+  return outer_product_update<inout_matrix_t, Triangle, R>(A, u, v);
+}
+
+// Kernels of the rank-1 updates: A := A + x y^T, and A := A + alpha x
+// x^T or alpha x x^H over a triangle, where alpha is optional.
+
+template<class inout_matrix_t, class in_vector_1_t, class in_vector_2_t>
+auto matrix_rank_1_update_kernel(const inout_matrix_t& A,
+                                 const in_vector_1_t& x, const in_vector_2_t& y)
+{
+  return make_outer_product_update<void, 1>(A,
+    [&] (std::size_t, std::size_t i) { return x(i); },
+    [&] (std::size_t, std::size_t j) { return y(j); });
+}
+
+template<bool Hermitian, class Triangle, class inout_matrix_t,
+         class in_vector_t, class... Alpha>
+auto symmetric_matrix_rank_1_update_kernel(const inout_matrix_t& A,
+                                           const in_vector_t& x, const Alpha&... alpha)
+{
+  static_assert(sizeof...(Alpha) <= 1);
+  return make_outer_product_update<Triangle, 1>(A,
+    [&] (std::size_t, std::size_t i) { return (alpha * ... * x(i)); },
+    [&] (std::size_t, std::size_t j) {
+      if constexpr (Hermitian) {
+        return conj_if_needed(x(j));
+      }
+      else {
+        return x(j);
+      }
+    });
+}
+
+} // end namespace impl
+
+#ifdef LINALG_ENABLE_BLAS
+namespace impl {
+
+template<class in_vector_1_t, class in_vector_2_t, class inout_matrix_t>
+constexpr bool matrix_rank_1_update_dispatch_to_blas()
+{
+  using scalar_type = typename inout_matrix_t::element_type;
+  return is_blas_writable_v<inout_matrix_t> &&
+    is_blas_readable_v<scalar_type, in_vector_1_t> &&
+    is_blas_readable_v<scalar_type, in_vector_2_t>;
+}
+
+// Computes A = A + alpha*x*y^T with a single ?ger, ?geru or ?gerc
+// call, folding any scaling of x and y into alpha.  Conjugated y
+// (as matrix_rank_1_update_c passes) selects ?gerc.  Returns false
+// without touching A if x, y and A don't fit the BLAS.
+template<class in_vector_1_t, class in_vector_2_t, class inout_matrix_t>
+bool matrix_rank_1_update_via_blas(const in_vector_1_t& x, const in_vector_2_t& y,
+                                   const inout_matrix_t& A)
+{
+  using scalar_type = typename inout_matrix_t::element_type;
+  using x_traits = blas_traits_t<scalar_type, in_vector_1_t>;
+  using y_traits = blas_traits_t<scalar_type, in_vector_2_t>;
+
+  const auto M = A.extent(0);
+  const auto N = A.extent(1);
+  if (M == 0 || N == 0 || ! blas_fits_int(M) || ! blas_fits_int(N)) {
+    return false;
+  }
+
+  bool A_trans = false;
+  int LDA = 0, INCX = 0, INCY = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_vector_inc(x, INCX) || ! blas_vector_inc(y, INCY)) {
+    return false;
+  }
+
+  // If A is row major, the BLAS sees A^T = A^T + alpha*y*x^T.
+  // Either way, it can only conjugate the right-hand vector.
+  const bool conj_left = A_trans ? y_traits::conj : x_traits::conj;
+  const bool conj_right = A_trans ? x_traits::conj : y_traits::conj;
+  const blas_routine routine = conj_right ? blas_routine::gerc : blas_routine::geru;
+  if (conj_left || ! blas_available<scalar_type>(routine)) {
+    return false;
+  }
+
+  const scalar_type alpha =
+    x_traits::scaling_factor(x.accessor()) *
+    y_traits::scaling_factor(y.accessor());
+  if (! A_trans) {
+    if (conj_right) {
+      BlasRoutines<scalar_type>::gerc(int(M), int(N), alpha, x.data_handle(), INCX,
+                                      y.data_handle(), INCY, A.data_handle(), LDA);
+    } else {
+      BlasRoutines<scalar_type>::geru(int(M), int(N), alpha, x.data_handle(), INCX,
+                                      y.data_handle(), INCY, A.data_handle(), LDA);
+    }
+  }
+  else {
+    if (conj_right) {
+      BlasRoutines<scalar_type>::gerc(int(N), int(M), alpha, y.data_handle(), INCY,
+                                      x.data_handle(), INCX, A.data_handle(), LDA);
+    } else {
+      BlasRoutines<scalar_type>::geru(int(N), int(M), alpha, y.data_handle(), INCY,
+                                      x.data_handle(), INCX, A.data_handle(), LDA);
+    }
+  }
+  return true;
+}
+
+} // end namespace impl
+#endif // LINALG_ENABLE_BLAS
+
 // Nonsymmetric non-conjugated rank-1 update
 
 template<class ElementType_x,
@@ -180,11 +397,24 @@ void matrix_rank_1_update(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_rank_1_update_dispatch_to_blas<decltype(x), decltype(y), decltype(A)>()) {
+    if (impl::matrix_rank_1_update_via_blas(x, y, A)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = ::std::common_type_t<SizeType_x, SizeType_y, SizeType_A>;
 
-  for (size_type i = 0; i < A.extent(0); ++i) {
-    for (size_type j = 0; j < A.extent(1); ++j) {
-      A(i,j) += x(i) * y(j);
+  if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::matrix_rank_1_update_kernel(A, x, y).update();
+  }
+  else {
+    for (size_type i = 0; i < A.extent(0); ++i) {
+      for (size_type j = 0; j < A.extent(1); ++j) {
+        A(i,j) += x(i) * y(j);
+      }
     }
   }
 }
@@ -320,7 +550,15 @@ void symmetric_matrix_rank_1_update(
 {
   using size_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangle_update(A, [&](auto i, auto j) {
+      return alpha * x(i) * x(j);
+    });
+  }
+  else if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::symmetric_matrix_rank_1_update_kernel<false, Triangle>(A, x, alpha).update();
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       for (size_type i = j; i < A.extent(0); ++i) {
         A(i,j) += alpha * x(i) * x(j);
@@ -427,7 +665,15 @@ void symmetric_matrix_rank_1_update(
 {
   using size_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangle_update(A, [&](auto i, auto j) {
+      return x(i) * x(j);
+    });
+  }
+  else if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::symmetric_matrix_rank_1_update_kernel<false, Triangle>(A, x).update();
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       for (size_type i = j; i < A.extent(0); ++i) {
         A(i,j) += x(i) * x(j);
@@ -533,7 +779,15 @@ void hermitian_matrix_rank_1_update(
 {
   using size_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangle_update(A, [&](auto i, auto j) {
+      return alpha * x(i) * impl::conj_if_needed(x(j));
+    });
+  }
+  else if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::symmetric_matrix_rank_1_update_kernel<true, Triangle>(A, x, alpha).update();
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       for (size_type i = j; i < A.extent(0); ++i) {
         A(i,j) += alpha * x(i) * impl::conj_if_needed(x(j));
@@ -640,7 +894,15 @@ void hermitian_matrix_rank_1_update(
 {
   using size_type = std::common_type_t<SizeType_x, SizeType_A>;
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangle_update(A, [&](auto i, auto j) {
+      return x(i) * impl::conj_if_needed(x(j));
+    });
+  }
+  else if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::symmetric_matrix_rank_1_update_kernel<true, Triangle>(A, x).update();
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       for (size_type i = j; i < A.extent(0); ++i) {
         A(i,j) += x(i) * impl::conj_if_needed(x(j));
@@ -96,6 +96,37 @@ struct is_custom_hermitian_matrix_rank_2_update_avail<
 
 } // end anonymous namespace
 
+namespace impl {
+
+// Kernel of the rank-2 updates A := A + x y^T + y x^T, or x y^H + y x^H,
+// over a triangle: an outer-product update with the factors [x y] and
+// [y x].
+template<bool Hermitian, class Triangle, class inout_matrix_t,
+         class in_vector_1_t, class in_vector_2_t>
+auto symmetric_matrix_rank_2_update_kernel(const inout_matrix_t& A,
+                                           const in_vector_1_t& x,
+                                           const in_vector_2_t& y)
+{
+  using value_type = typename inout_matrix_t::element_type;
+  auto conj_if_hermitian = [] (const value_type& v) {
+    if constexpr (Hermitian) {
+      return conj_if_needed(v);
+    }
+    else {
+      return v;
+    }
+  };
+  return make_outer_product_update<Triangle, 2>(A,
+    [&] (std::size_t q, std::size_t i) {
+      return q == 0 ? value_type(x(i)) : value_type(y(i));
+    },
+    [&] (std::size_t q, std::size_t j) {
+      return conj_if_hermitian(q == 0 ? value_type(y(j)) : value_type(x(j)));
+    });
+}
+
+} // end namespace impl
+
 // Rank-2 update of a symmetric matrix
 
 template<class ElementType_x,
@@ -121,12 +152,24 @@ void symmetric_matrix_rank_2_update(
   using size_type = std::common_type_t<SizeType_x, SizeType_y, SizeType_A>;
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
-  for (size_type j = 0; j < A.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? A.extent(0) : j+1;
+  const auto x_elements = impl::decompose_accessor(x);
+  const auto y_elements = impl::decompose_accessor(y);
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangle_update(A, [&](auto i, auto j) {
+      return x_elements(i) * y_elements(j) + y_elements(i) * x_elements(j);
+    });
+  }
+  else if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::symmetric_matrix_rank_2_update_kernel<false, Triangle>(A, x, y).update();
+  }
+  else {
+    for (size_type j = 0; j < A.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? A.extent(0) : j+1;
 
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      A(i,j) += x(i) * y(j) + y(i) * x(j);
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        A(i,j) += x_elements(i) * y_elements(j) + y_elements(i) * x_elements(j);
+      }
     }
   }
 }
@@ -213,12 +256,26 @@ void hermitian_matrix_rank_2_update(
 
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
-  for (size_type j = 0; j < A.extent(1); ++j) {
-    const size_type i_lower = lower_tri ? j : size_type(0);
-    const size_type i_upper = lower_tri ? A.extent(0) : j+1;
+  const auto x_elements = impl::decompose_accessor(x);
+  const auto y_elements = impl::decompose_accessor(y);
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangle_update(A, [&](auto i, auto j) {
+      return x_elements(i) * impl::conj_if_needed(y_elements(j)) +
+        y_elements(i) * impl::conj_if_needed(x_elements(j));
+    });
+  }
+  else if constexpr (impl::outer_product_update_eligible<decltype(A)>()) {
+    impl::symmetric_matrix_rank_2_update_kernel<true, Triangle>(A, x, y).update();
+  }
+  else {
+    for (size_type j = 0; j < A.extent(1); ++j) {
+      const size_type i_lower = lower_tri ? j : size_type(0);
+      const size_type i_upper = lower_tri ? A.extent(0) : j+1;
 
-    for (size_type i = i_lower; i < i_upper; ++i) {
-      A(i,j) += x(i) * impl::conj_if_needed(y(j)) + y(i) * impl::conj_if_needed(x(j));
+      for (size_type i = i_lower; i < i_upper; ++i) {
+        A(i,j) += x_elements(i) * impl::conj_if_needed(y_elements(j)) +
+          y_elements(i) * impl::conj_if_needed(x_elements(j));
+      }
     }
   }
 }
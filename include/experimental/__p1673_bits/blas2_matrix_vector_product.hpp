@@ -43,8 +43,11 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_MATRIX_VECTOR_PRODUCT_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_MATRIX_VECTOR_PRODUCT_HPP_
 
+#include <algorithm>
 #include <complex>
+#include <cstddef>
 #include <type_traits>
+#include <vector>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
@@ -227,6 +230,129 @@ struct is_custom_tri_mat_vec_product_with_update_avail<
 
 } // end anonymous namespace
 
+#ifdef LINALG_ENABLE_BLAS
+namespace impl {
+
+template<class in_matrix_t, class in_vector_t, class out_vector_t>
+constexpr bool matrix_vector_product_dispatch_to_blas()
+{
+  using scalar_type = typename out_vector_t::element_type;
+  // ?gemv can conjugate A, but not x.
+  return is_blas_writable_v<out_vector_t> &&
+    is_blas_readable_v<scalar_type, in_matrix_t> &&
+    is_blas_readable_v<scalar_type, in_vector_t> &&
+    ! blas_traits_t<scalar_type, in_vector_t>::conj;
+}
+
+// Computes y = alpha*op(A)*x + beta*y with a single ?gemv call.
+// See matrix_product_via_blas.
+template<class in_matrix_t, class in_vector_t, class out_vector_t,
+         class BetaFunction>
+bool matrix_vector_product_via_blas(const in_matrix_t& A, const in_vector_t& x,
+                                    const out_vector_t& y, BetaFunction get_beta)
+{
+  using scalar_type = typename out_vector_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_t>;
+  using x_traits = blas_traits_t<scalar_type, in_vector_t>;
+
+  const auto M = A.extent(0);
+  const auto N = A.extent(1);
+  if (M == 0 || N == 0 || ! blas_fits_int(M) || ! blas_fits_int(N) ||
+      ! blas_available<scalar_type>(blas_routine::gemv)) {
+    return false;
+  }
+
+  bool A_trans = false;
+  int LDA = 0, INCX = 0, INCY = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_vector_inc(x, INCX) || ! blas_vector_inc(y, INCY)) {
+    return false;
+  }
+  const char TRANS = blas_trans_char(A_trans, A_traits::conj);
+  if (TRANS == '\0') {
+    return false;
+  }
+
+  const scalar_type alpha =
+    A_traits::scaling_factor(A.accessor()) *
+    x_traits::scaling_factor(x.accessor());
+  const scalar_type beta = get_beta();
+  // ?gemv wants the dimensions of the stored matrix, not of op(A).
+  BlasRoutines<scalar_type>::gemv(TRANS,
+                                  A_trans ? int(N) : int(M),
+                                  A_trans ? int(M) : int(N),
+                                  alpha, A.data_handle(), LDA,
+                                  x.data_handle(), INCX,
+                                  beta, y.data_handle(), INCY);
+  return true;
+}
+
+template<bool Hermitian, class in_matrix_t, class in_vector_t, class out_vector_t>
+constexpr bool symmetric_matrix_vector_product_dispatch_to_blas()
+{
+  // The BLAS has no complex symmetric matrix-vector product.
+  using scalar_type = typename out_vector_t::element_type;
+  return matrix_vector_product_dispatch_to_blas<in_matrix_t, in_vector_t, out_vector_t>() &&
+    (Hermitian || ! is_complex_v<scalar_type>);
+}
+
+// Computes y = alpha*A*x + beta*y with a single ?symv or ?hemv call,
+// where A is symmetric (or Hermitian) and only A's triangle t is
+// read.  See matrix_product_via_blas.
+template<bool Hermitian, class in_matrix_t, class Triangle,
+         class in_vector_t, class out_vector_t, class BetaFunction>
+bool symmetric_matrix_vector_product_via_blas(const in_matrix_t& A, Triangle /* t */,
+                                              const in_vector_t& x, const out_vector_t& y,
+                                              BetaFunction get_beta)
+{
+  using scalar_type = typename out_vector_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_t>;
+  using x_traits = blas_traits_t<scalar_type, in_vector_t>;
+
+  const auto N = A.extent(0);
+  constexpr blas_routine routine = Hermitian ? blas_routine::hemv : blas_routine::symv;
+  if (N == 0 || ! blas_fits_int(N) || ! blas_available<scalar_type>(routine)) {
+    return false;
+  }
+
+  bool A_trans = false;
+  int LDA = 0, INCX = 0, INCY = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_vector_inc(x, INCX) || ! blas_vector_inc(y, INCY)) {
+    return false;
+  }
+  const scalar_type A_scaling_factor = A_traits::scaling_factor(A.accessor());
+  if constexpr (is_complex_v<scalar_type>) {
+    // Reading a Hermitian matrix through its transpose gives its
+    // conjugate, so transposition and conjugation must cancel.
+    // Scaling the stored triangle by a complex number doesn't
+    // leave the matrix Hermitian.
+    if (A_trans != A_traits::conj || ! blas_is_real(A_scaling_factor)) {
+      return false;
+    }
+  }
+  // The transpose's lower triangle is the upper triangle.
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  const char UPLO = blas_uplo_char(lower != A_trans);
+
+  const scalar_type alpha = A_scaling_factor * x_traits::scaling_factor(x.accessor());
+  const scalar_type beta = get_beta();
+  if constexpr (Hermitian) {
+    BlasRoutines<scalar_type>::hemv(UPLO, int(N), alpha, A.data_handle(), LDA,
+                                    x.data_handle(), INCX,
+                                    beta, y.data_handle(), INCY);
+  }
+  else {
+    BlasRoutines<scalar_type>::symv(UPLO, int(N), alpha, A.data_handle(), LDA,
+                                    x.data_handle(), INCX,
+                                    beta, y.data_handle(), INCY);
+  }
+  return true;
+}
+
+} // end namespace impl
+#endif // LINALG_ENABLE_BLAS
+
 namespace impl {
 
   template<class T>
@@ -249,6 +375,203 @@ namespace impl {
 
 } // namespace impl
 
+namespace impl {
+
+// Storage order of the matrix layout Layout, if the layout fixes it:
+// column_major_t if columns are contiguous, row_major_t if rows are,
+// and void otherwise (for example, for layout_stride).
+template<class Layout>
+struct static_storage_order {
+  using type = void;
+};
+
+template<>
+struct static_storage_order<layout_left> {
+  using type = column_major_t;
+};
+
+template<>
+struct static_storage_order<layout_right> {
+  using type = row_major_t;
+};
+
+template<class StorageOrder>
+struct static_storage_order<layout_blas_general<StorageOrder>> {
+  using type = StorageOrder;
+};
+
+template<class NestedLayout>
+struct static_storage_order<layout_transpose<NestedLayout>> {
+  using nested_type = typename static_storage_order<NestedLayout>::type;
+  using type = std::conditional_t<std::is_void_v<nested_type>, void,
+                                  opposite_storage_t<nested_type>>;
+};
+
+template<class Layout>
+using static_storage_order_t = typename static_storage_order<Layout>::type;
+
+// Layout-aware matrix-vector product z := init + A * x, for A in a
+// column-major or row-major array of BLAS scalars, possibly scaled or
+// conjugated, and z a strided array of the same scalars.
+//
+// Column-major A is swept column by column: four columns at a time
+// are scaled by their elements of x and added to z, so that each
+// column is read contiguously and z is loaded and stored once every
+// four columns.  Row-major A is swept four rows at a time: each row
+// is dotted with x, so that each element of x is loaded once for four
+// rows.  Real scalars use the SIMD kernels; complex scalars use
+// scalar loops in the same order.
+//
+// A real A may also be stored in a narrower type than z, without
+// scaling: float for double z, or a half-precision type for float or
+// double z.  The kernels then convert A as they load it and sum in
+// z's precision.
+
+template<class Scalar, class in_matrix_t>
+inline constexpr bool is_widening_gemv_matrix_v =
+  std::is_floating_point_v<Scalar> &&
+  std::is_same_v<typename in_matrix_t::accessor_type,
+                 default_accessor<typename in_matrix_t::element_type>> &&
+  is_widening_conversion_v<std::remove_const_t<typename in_matrix_t::element_type>,
+                           Scalar>;
+
+template<class in_matrix_t, class out_vector_t>
+constexpr bool layout_aware_gemv_eligible()
+{
+  using scalar_type = typename out_vector_t::element_type;
+  return is_blas_writable_v<out_vector_t> &&
+    (blas_traits_t<scalar_type, in_matrix_t>::valid ||
+     is_widening_gemv_matrix_v<scalar_type, in_matrix_t>) &&
+    in_matrix_t::is_always_strided() &&
+    ! std::is_void_v<static_storage_order_t<typename in_matrix_t::layout_type>>;
+}
+
+// Pointer to x's elements as a contiguous array of T: x's own data,
+// if x is a contiguous array of T without scaling or conjugation, and
+// otherwise a copy of x in buffer.
+template<class T, class in_vector_t>
+const T* contiguous_vector_data(const in_vector_t& x, std::vector<T>& buffer)
+{
+  const std::size_t n = x.extent(0);
+  if constexpr (std::is_same_v<typename in_vector_t::accessor_type,
+                               default_accessor<const T>> ||
+                std::is_same_v<typename in_vector_t::accessor_type,
+                               default_accessor<T>>) {
+    if constexpr (in_vector_t::is_always_strided()) {
+      if (n != 0 && x.stride(0) == 1) {
+        return x.data_handle() + x.mapping()(0);
+      }
+    }
+  }
+  buffer.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    buffer[i] = T(x(i));
+  }
+  return buffer.data();
+}
+
+// init(i) is the initial value of z(i).  It is read before z(i) is
+// written, so init may read z itself.
+template<class in_matrix_t, class in_vector_t, class out_vector_t, class Init>
+void layout_aware_matrix_vector_product(const in_matrix_t& A, const in_vector_t& x,
+                                        const out_vector_t& z, Init init)
+{
+  using scalar_type = typename out_vector_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_t>;
+  using storage_order = static_storage_order_t<typename in_matrix_t::layout_type>;
+  constexpr bool conj_A = A_traits::conj;
+
+  const std::size_t m = A.extent(0);
+  const std::size_t n = A.extent(1);
+  if (m == 0) {
+    return;
+  }
+  if (n == 0) {
+    for (std::size_t i = 0; i < m; ++i) {
+      z(i) = init(i);
+    }
+    return;
+  }
+
+  using stored_type = std::remove_const_t<typename in_matrix_t::element_type>;
+  const scalar_type alpha = A_traits::scaling_factor(A.accessor());
+  const stored_type* const a = A.data_handle() + A.mapping()(0, 0);
+  auto stored = [] (const scalar_type& s) {
+    if constexpr (conj_A) {
+      return conj_if_needed(s);
+    }
+    else {
+      return s;
+    }
+  };
+
+  if constexpr (std::is_same_v<storage_order, column_major_t>) {
+    const std::size_t lda = A.stride(1);
+    const std::size_t incz = z.stride(0);
+    scalar_type* const zp = z.data_handle() + z.mapping()(0);
+    for (std::size_t i = 0; i < m; ++i) {
+      zp[i * incz] = init(i);
+    }
+    if (incz == 1 && ! conj_A) {
+      scalar_type c[4];
+      std::size_t j = 0;
+      for (; j + 4 <= n; j += 4) {
+        for (std::size_t q = 0; q < 4; ++q) {
+          c[q] = alpha * scalar_type(x(j + q));
+        }
+        simd_gemv_axpy_columns<4>(a + j * lda, lda, c, zp, m);
+      }
+      for (; j < n; ++j) {
+        c[0] = alpha * scalar_type(x(j));
+        simd_gemv_axpy_columns<1>(a + j * lda, lda, c, zp, m);
+      }
+    }
+    else {
+      for (std::size_t j = 0; j < n; ++j) {
+        const scalar_type c = alpha * scalar_type(x(j));
+        const stored_type* const a_j = a + j * lda;
+        for (std::size_t i = 0; i < m; ++i) {
+          zp[i * incz] += stored(a_j[i]) * c;
+        }
+      }
+    }
+  }
+  else {
+    const std::size_t lda = A.stride(0);
+    std::vector<scalar_type> x_copy;
+    const scalar_type* const xp = contiguous_vector_data<scalar_type>(x, x_copy);
+
+    auto dot_rows = [&] (auto num_rows, std::size_t i) {
+      constexpr std::size_t R = decltype(num_rows)::value;
+      scalar_type sum[R];
+      if constexpr (conj_A) {
+        for (std::size_t r = 0; r < R; ++r) {
+          sum[r] = scalar_type{};
+          for (std::size_t j = 0; j < n; ++j) {
+            sum[r] += stored(a[(i + r) * lda + j]) * xp[j];
+          }
+        }
+      }
+      else {
+        simd_gemv_dot_rows<R>(a + i * lda, lda, xp, n, sum);
+      }
+      // init(i + r) is read before z(i + r) is written.
+      for (std::size_t r = 0; r < R; ++r) {
+        z(i + r) = init(i + r) + alpha * sum[r];
+      }
+    };
+    std::size_t i = 0;
+    for (; i + 4 <= m; i += 4) {
+      dot_rows(std::integral_constant<std::size_t, 4>{}, i);
+    }
+    for (; i < m; ++i) {
+      dot_rows(std::integral_constant<std::size_t, 1>{}, i);
+    }
+  }
+}
+
+} // end namespace impl
+
 MDSPAN_TEMPLATE_REQUIRES(
          class ElementType_A,
          class SizeType_A, ::std::size_t numRows_A,
@@ -271,6 +594,25 @@ void matrix_vector_product(
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+  if constexpr (impl::static_matrix_vector_product_eligible<decltype(A), decltype(x), decltype(y)>()) {
+    impl::static_matrix_vector_product(A, x, y, [] (std::size_t) { return ElementType_y{}; });
+    return;
+  }
+
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::matrix_vector_product_via_blas(A, x, y, [] { return ElementType_y{}; })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::layout_aware_gemv_eligible<decltype(A), decltype(y)>()) {
+    impl::layout_aware_matrix_vector_product(A, x, y,
+      [] (std::size_t) { return ElementType_y{}; });
+    return;
+  }
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<SizeType_A, SizeType_x>,
@@ -355,6 +697,267 @@ namespace impl {
 
   template<class Layout, class Extents>
   constexpr bool always_unique_mapping_v = always_unique_mapping<Layout, Extents>::value;
+
+  // Symmetric, Hermitian and triangular algorithms read only one
+  // triangle of A, so they also take packed layouts, even though
+  // those map A(i,j) and A(j,i) to the same element.
+  template<class Layout, class Extents>
+  constexpr bool triangle_readable_mapping_v =
+    always_unique_mapping_v<Layout, Extents> || is_layout_blas_packed_v<Layout>;
+
+  // y := y + A*x, for A symmetric (or Hermitian) in packed storage of
+  // the triangle that the algorithm reads.  This reads each line of
+  // the packed array once, in storage order, and accumulates y's
+  // element for the line in a local.
+  template<bool Hermitian, class in_matrix_t, class in_vector_t, class inout_vector_t>
+  void packed_symmetric_matrix_vector_product(const in_matrix_t& A, const in_vector_t& x,
+                                              const inout_vector_t& y)
+  {
+    using layout_type = typename in_matrix_t::layout_type;
+    using triangle_type = typename layout_type::triangle_type;
+    using storage_order_type = typename layout_type::storage_order_type;
+    using index_type = typename in_matrix_t::index_type;
+    using value_type = typename inout_vector_t::value_type;
+    constexpr bool column_major = std::is_same_v<storage_order_type, column_major_t>;
+
+    auto conj_if_hermitian = [](const auto& A_lk) {
+      if constexpr (Hermitian) {
+        return conj_if_needed(A_lk);
+      }
+      else {
+        return A_lk;
+      }
+    };
+
+    const index_type n = A.extent(0);
+    const auto& acc = A.accessor();
+    const auto p = A.data_handle();
+    for (index_type l = 0; l < n; ++l) {
+      const auto line = packed_line_of<triangle_type, storage_order_type>(n, l);
+      const auto x_l = x(l);
+      value_type y_l = y(l);
+      if constexpr (Hermitian) {
+        y_l += real_part(acc.access(p, line.diagonal)) * x_l;
+      }
+      else {
+        y_l += acc.access(p, line.diagonal) * x_l;
+      }
+      std::size_t offset = line.offset;
+      for (index_type k = line.first; k < line.last; ++k, ++offset) {
+        const auto A_lk = acc.access(p, offset);
+        if constexpr (column_major) {
+          // A_lk is A(k,l).
+          y(k) += A_lk * x_l;
+          y_l += conj_if_hermitian(A_lk) * x(k);
+        }
+        else {
+          // A_lk is A(l,k).
+          y_l += A_lk * x(k);
+          y(k) += conj_if_hermitian(A_lk) * x_l;
+        }
+      }
+      y(l) = y_l;
+    }
+  }
+
+  // Fused symmetric (or Hermitian) matrix-vector product y := y + A*x,
+  // for A's triangle in a column-major or row-major array of BLAS
+  // scalars, possibly scaled or conjugated.  Each stored element A(k,l)
+  // is read once, for both y(k) += A(k,l) * x(l) and y(l) += A(l,k) *
+  // x(k).  Columns are swept four at a time: the four columns' part of
+  // y is accumulated in registers, while one pass over the columns'
+  // elements outside the diagonal block updates the rest of y.  That
+  // pass uses the SIMD kernel for real scalars.
+  //
+  // Row-major A is a column-major array holding A's transpose, with
+  // the opposite triangle.  A symmetric matrix is its own transpose,
+  // and a Hermitian matrix is the conjugate of its transpose.
+
+  // The Triangle of an n x n symmetric (or Hermitian) matrix, with
+  // A(k,l) = alpha * a[k + l * lda], or alpha * conj(a[k + l * lda])
+  // if ConjA.
+  template<bool Hermitian, class Triangle, bool ConjA, class T>
+  struct fused_symv_matrix {
+    using triangle_type = Triangle;
+
+    const T* a;
+    std::size_t lda;
+    T alpha;
+    std::size_t n;
+
+    // A(k,l), for (k,l) in the Triangle.
+    T operator()(std::size_t k, std::size_t l) const
+    {
+      if constexpr (ConjA) {
+        return alpha * conj_if_needed(a[k + l * lda]);
+      }
+      else {
+        return alpha * a[k + l * lda];
+      }
+    }
+
+    // y := y + (the part of A*x from the elements of columns [l_begin,
+    // l_end) of the Triangle, counting each off-diagonal element also
+    // for its mirror image).  x and y are contiguous arrays of n
+    // elements.  Summing this over a partition of [0, n) gives A*x.
+    void add_columns(const T* x, T* y, std::size_t l_begin, std::size_t l_end) const
+    {
+      constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+      constexpr std::size_t C = 4;
+      for (std::size_t l0 = l_begin; l0 < l_end; l0 += C) {
+        const std::size_t nc = std::min(C, l_end - l0);
+        for (std::size_t q = 0; q < nc; ++q) {
+          const std::size_t l = l0 + q;
+          if constexpr (Hermitian) {
+            y[l] += T(real_part((*this)(l, l))) * x[l];
+          }
+          else {
+            y[l] += (*this)(l, l) * x[l];
+          }
+          const std::size_t k_begin = lower ? l + 1 : l0;
+          const std::size_t k_end = lower ? l0 + nc : l;
+          for (std::size_t k = k_begin; k < k_end; ++k) {
+            const T A_kl = (*this)(k, l);
+            y[k] += A_kl * x[l];
+            y[l] += mirror(A_kl) * x[k];
+          }
+        }
+        const std::size_t k_begin = lower ? l0 + nc : 0;
+        const std::size_t k_end = lower ? n : l0;
+        if (nc == C) {
+          off_diagonal_columns<C>(x, y, l0, k_begin, k_end);
+        }
+        else {
+          for (std::size_t q = 0; q < nc; ++q) {
+            off_diagonal_columns<1>(x, y, l0 + q, k_begin, k_end);
+          }
+        }
+      }
+    }
+
+  private:
+    // A(l,k), given A(k,l).
+    static T mirror(const T& A_kl)
+    {
+      if constexpr (Hermitian) {
+        return conj_if_needed(A_kl);
+      }
+      else {
+        return A_kl;
+      }
+    }
+
+    // The elements in rows [k_begin, k_end) of columns [l0, l0 + C).
+    template<std::size_t C>
+    void off_diagonal_columns(const T* x, T* y, std::size_t l0,
+                              std::size_t k_begin, std::size_t k_end) const
+    {
+      if (k_begin >= k_end) {
+        return;
+      }
+      T t[C];
+      // Without conjugation, A(k,l) and A(l,k) are both alpha times
+      // the stored element, so alpha can be applied outside the kernel.
+      if constexpr (! ConjA && ! (Hermitian && is_complex_v<T>)) {
+        T c[C];
+        for (std::size_t q = 0; q < C; ++q) {
+          c[q] = alpha * x[l0 + q];
+        }
+        simd_symv_columns<C>(a + k_begin + l0 * lda, lda, c,
+                             x + k_begin, y + k_begin, k_end - k_begin, t);
+        for (std::size_t q = 0; q < C; ++q) {
+          y[l0 + q] += alpha * t[q];
+        }
+      }
+      else {
+        for (std::size_t q = 0; q < C; ++q) {
+          t[q] = T{};
+        }
+        for (std::size_t k = k_begin; k < k_end; ++k) {
+          const T x_k = x[k];
+          T y_k = y[k];
+          for (std::size_t q = 0; q < C; ++q) {
+            const T A_kl = (*this)(k, l0 + q);
+            y_k += A_kl * x[l0 + q];
+            t[q] += mirror(A_kl) * x_k;
+          }
+          y[k] = y_k;
+        }
+        for (std::size_t q = 0; q < C; ++q) {
+          y[l0 + q] += t[q];
+        }
+      }
+    }
+  };
+
+  // The fused kernels read A in y's own scalar type.
+  template<class in_matrix_t, class inout_vector_t>
+  constexpr bool fused_symv_eligible()
+  {
+    return layout_aware_gemv_eligible<in_matrix_t, inout_vector_t>() &&
+      blas_traits_t<typename inout_vector_t::element_type, in_matrix_t>::valid;
+  }
+
+  // A's Triangle as a column-major fused_symv_matrix of T.
+  template<bool Hermitian, class T, class in_matrix_t, class Triangle>
+  auto make_fused_symv_matrix(const in_matrix_t& A, Triangle /* t */)
+  {
+    using A_traits = blas_traits_t<T, in_matrix_t>;
+    using storage_order = static_storage_order_t<typename in_matrix_t::layout_type>;
+    constexpr bool conj_A = A_traits::conj && is_complex_v<T>;
+
+    const std::size_t n = A.extent(0);
+    const T alpha = A_traits::scaling_factor(A.accessor());
+    const T* const a = n == 0 ? nullptr : A.data_handle() + A.mapping()(0, 0);
+    if constexpr (std::is_same_v<storage_order, column_major_t>) {
+      return fused_symv_matrix<Hermitian, Triangle, conj_A, T>{
+        a, std::size_t(A.stride(1)), alpha, n};
+    }
+    else {
+      using opposite_triangle = std::conditional_t<
+        std::is_same_v<Triangle, lower_triangle_t>, upper_triangle_t, lower_triangle_t>;
+      if constexpr (Hermitian) {
+        // A(k,l) = conj(A(l,k)) = conj(alpha) * conj(conj_A(a[l * lda + k])).
+        return fused_symv_matrix<true, opposite_triangle, is_complex_v<T> && ! conj_A, T>{
+          a, std::size_t(A.stride(0)), conj_if_needed(alpha), n};
+      }
+      else {
+        return fused_symv_matrix<false, opposite_triangle, conj_A, T>{
+          a, std::size_t(A.stride(0)), alpha, n};
+      }
+    }
+  }
+
+  template<bool Hermitian, class in_matrix_t, class Triangle,
+           class in_vector_t, class inout_vector_t>
+  void fused_symmetric_matrix_vector_product(const in_matrix_t& A, Triangle t,
+                                             const in_vector_t& x,
+                                             const inout_vector_t& y)
+  {
+    using T = typename inout_vector_t::element_type;
+    const std::size_t n = A.extent(0);
+    if (n == 0) {
+      return;
+    }
+    const auto A_t = make_fused_symv_matrix<Hermitian, T>(A, t);
+    std::vector<T> x_copy;
+    const T* const xp = contiguous_vector_data<T>(x, x_copy);
+    const std::size_t incy = y.stride(0);
+    T* const yp = y.data_handle() + y.mapping()(0);
+    if (incy == 1) {
+      A_t.add_columns(xp, yp, 0, n);
+    }
+    else {
+      std::vector<T> y_copy(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        y_copy[i] = yp[i * incy];
+      }
+      A_t.add_columns(xp, y_copy.data(), 0, n);
+      for (std::size_t i = 0; i < n; ++i) {
+        yp[i * incy] = y_copy[i];
+      }
+    }
+  }
 } // namespace impl
 
 // Updating general matrix-vector product: z := y + A * x
@@ -390,6 +993,27 @@ void matrix_vector_product(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
 {
+  if constexpr (impl::static_matrix_vector_product_eligible<decltype(A), decltype(x), decltype(z)>() &&
+                impl::small_static_extents_v<typename decltype(y)::extents_type>()) {
+    impl::static_matrix_vector_product(A, x, z, [&] (std::size_t i) { return ElementType_z(y(i)); });
+    return;
+  }
+
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_vector_product_dispatch_to_blas<decltype(A), decltype(x), decltype(z)>()) {
+    // If y is z, possibly scaled, then its scaling factor is beta.
+    if (impl::matrix_vector_product_via_blas(A, x, z, [&] { return impl::blas_update_beta(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::layout_aware_gemv_eligible<decltype(A), decltype(z)>()) {
+    impl::layout_aware_matrix_vector_product(A, x, z,
+      [&] (std::size_t i) { return ElementType_z(y(i)); });
+    return;
+  }
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<typename Extents_A::size_type /* SizeType_A */, SizeType_x>,
@@ -497,7 +1121,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void symmetric_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -506,6 +1130,14 @@ void symmetric_matrix_vector_product(
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<false, decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::symmetric_matrix_vector_product_via_blas<false>(A, t, x, y, [] { return ElementType_y{}; })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<
       std::common_type_t<SizeType_A, SizeType_x>,
     SizeType_y>;
@@ -514,7 +1146,13 @@ void symmetric_matrix_vector_product(
     y(i) = ElementType_y{};
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_symmetric_matrix_vector_product<false>(A, x, y);
+  }
+  else if constexpr (impl::fused_symv_eligible<decltype(A), decltype(y)>()) {
+    impl::fused_symmetric_matrix_vector_product<false>(A, t, x, y);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       y(j) += A(j,j) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -584,7 +1222,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void symmetric_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
@@ -618,7 +1256,7 @@ MDSPAN_TEMPLATE_REQUIRES(
 	 class Extents_z,
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2 && Extents_z::rank() == 1)
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, Extents_A> && Extents_A::rank() == 2 && Extents_z::rank() == 1)
 )
 void symmetric_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -628,6 +1266,15 @@ void symmetric_matrix_vector_product(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, Extents_z, Layout_z, Accessor_z> z)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<false, decltype(A), decltype(x), decltype(z)>()) {
+    // If y is z, possibly scaled, then its scaling factor is beta.
+    if (impl::symmetric_matrix_vector_product_via_blas<false>(A, t, x, z, [&] { return impl::blas_update_beta(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<typename Extents_A::size_type, SizeType_x>,
@@ -638,7 +1285,13 @@ void symmetric_matrix_vector_product(
     z(i) = y(i);
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_symmetric_matrix_vector_product<false>(A, x, z);
+  }
+  else if constexpr (impl::fused_symv_eligible<decltype(A), decltype(z)>()) {
+    impl::fused_symmetric_matrix_vector_product<false>(A, t, x, z);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       z(j) += A(j,j) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -662,8 +1315,7 @@ void symmetric_matrix_vector_product(
 
 template<class ExecutionPolicy,
          class ElementType_A,
-         class SizeType_A, ::std::size_t numRows_A,
-         ::std::size_t numCols_A,
+         class Extents_A,
          class Layout_A,
          class Accessor_A,
          class Triangle,
@@ -676,16 +1328,16 @@ template<class ExecutionPolicy,
          class Layout_y,
          class Accessor_y,
          class ElementType_z,
-         class SizeType_z, ::std::size_t ext_z,
+         class Extents_z,
          class Layout_z,
          class Accessor_z>
 void symmetric_matrix_vector_product(
   ExecutionPolicy&& exec,
-  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_A, Extents_A, Layout_A, Accessor_A> A,
   Triangle t,
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
-  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+  mdspan<ElementType_z, Extents_z, Layout_z, Accessor_z> z)
 {
   constexpr bool use_custom = is_custom_sym_mat_vec_product_with_update_avail<
     decltype(execpolicy_mapper(exec)), decltype(A), Triangle, decltype(x), decltype(y), decltype(z)>::value;
@@ -721,7 +1373,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          /* class SizeType_z, ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2 && Extents_z::rank() == 1)
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2 && Extents_z::rank() == 1)
 )
 void symmetric_matrix_vector_product(
   mdspan<ElementType_A,  Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ , Layout_A, Accessor_A> A,
@@ -752,7 +1404,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void hermitian_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -761,6 +1413,14 @@ void hermitian_matrix_vector_product(
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<true, decltype(A), decltype(x), decltype(y)>()) {
+    if (impl::symmetric_matrix_vector_product_via_blas<true>(A, t, x, y, [] { return ElementType_y{}; })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<
       std::common_type_t<SizeType_A, SizeType_x>,
     SizeType_y>;
@@ -769,7 +1429,13 @@ void hermitian_matrix_vector_product(
     y(i) = ElementType_y{};
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_symmetric_matrix_vector_product<true>(A, x, y);
+  }
+  else if constexpr (impl::fused_symv_eligible<decltype(A), decltype(y)>()) {
+    impl::fused_symmetric_matrix_vector_product<true>(A, t, x, y);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       y(j) += impl::real_part(A(j,j)) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -807,7 +1473,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void hermitian_matrix_vector_product(
   ExecutionPolicy&& exec,
@@ -842,7 +1508,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void hermitian_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
@@ -880,7 +1546,7 @@ MDSPAN_TEMPLATE_REQUIRES(
 	 /* class SizeType_z, ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2 && Extents_z::rank() == 1)
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2 && Extents_z::rank() == 1)
 )
 void hermitian_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -890,6 +1556,15 @@ void hermitian_matrix_vector_product(
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
   mdspan<ElementType_z, Extents_z /* extents<SizeType_z, ext_z> */ , Layout_z, Accessor_z> z)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::symmetric_matrix_vector_product_dispatch_to_blas<true, decltype(A), decltype(x), decltype(z)>()) {
+    // If y is z, possibly scaled, then its scaling factor is beta.
+    if (impl::symmetric_matrix_vector_product_via_blas<true>(A, t, x, z, [&] { return impl::blas_update_beta(y, z); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   using size_type = std::common_type_t<
     std::common_type_t<
       std::common_type_t<typename Extents_A::size_type /* SizeType_A */ , SizeType_x>,
@@ -900,7 +1575,13 @@ void hermitian_matrix_vector_product(
     z(i) = y(i);
   }
 
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_symmetric_matrix_vector_product<true>(A, x, z);
+  }
+  else if constexpr (impl::fused_symv_eligible<decltype(A), decltype(z)>()) {
+    impl::fused_symmetric_matrix_vector_product<true>(A, t, x, z);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     for (size_type j = 0; j < A.extent(1); ++j) {
       z(j) += impl::real_part(A(j,j)) * x(j);
       for (size_type i = j + size_type(1); i < A.extent(0); ++i) {
@@ -924,8 +1605,7 @@ void hermitian_matrix_vector_product(
 
 template<class ExecutionPolicy,
          class ElementType_A,
-         class SizeType_A, ::std::size_t numRows_A,
-         ::std::size_t numCols_A,
+         class Extents_A,
          class Layout_A,
          class Accessor_A,
          class Triangle,
@@ -938,16 +1618,16 @@ template<class ExecutionPolicy,
          class Layout_y,
          class Accessor_y,
          class ElementType_z,
-         class SizeType_z, ::std::size_t ext_z,
+         class Extents_z,
          class Layout_z,
          class Accessor_z>
 void hermitian_matrix_vector_product(
   ExecutionPolicy&& exec,
-  mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_A, Extents_A, Layout_A, Accessor_A> A,
   Triangle t,
   mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
   mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
-  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+  mdspan<ElementType_z, Extents_z, Layout_z, Accessor_z> z)
 {
   constexpr bool use_custom = is_custom_hermitian_mat_vec_product_with_update_avail<
     decltype(execpolicy_mapper(exec)), decltype(A), Triangle, decltype(x), decltype(y), decltype(z)>::value;
@@ -984,7 +1664,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
 )
 void hermitian_matrix_vector_product(
   mdspan<ElementType_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ , Layout_A, Accessor_A> A,
@@ -1015,7 +1695,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void triangular_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -1114,7 +1794,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          class SizeType_y, ::std::size_t ext_y,
          class Layout_y,
          class Accessor_y,
-         /* requires */ (Layout_A::template mapping<extents<SizeType_A, numRows_A, numCols_A>>::is_always_unique())
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, extents<SizeType_A, numRows_A, numCols_A>>)
 )
 void triangular_matrix_vector_product(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
@@ -1155,7 +1835,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
 )
 void triangular_matrix_vector_product(
   impl::inline_exec_t&& /* exec */,
@@ -1272,7 +1952,7 @@ MDSPAN_TEMPLATE_REQUIRES(
          ::std::size_t ext_z, */
          class Layout_z,
          class Accessor_z,
-         /* requires */ (impl::always_unique_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
+         /* requires */ (impl::triangle_readable_mapping_v<Layout_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ > && Extents_A::rank() == 2)
 )
 void triangular_matrix_vector_product(
   mdspan<ElementType_A, Extents_A /* extents<SizeType_A, numRows_A, numCols_A> */ , Layout_A, Accessor_A> A,
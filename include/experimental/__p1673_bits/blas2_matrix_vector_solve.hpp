@@ -43,7 +43,10 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_MATRIX_VECTOR_SOLVE_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS2_MATRIX_VECTOR_SOLVE_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <vector>
 
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
@@ -224,6 +227,300 @@ struct is_custom_tri_mat_vec_solve_avail<
 
 } // end anonymous namespace
 
+namespace impl {
+
+// Solves A*x = b for A triangular in packed storage of triangle t.
+// Column-major lines are columns, so the solve subtracts each solved
+// element's column from the rest of x; row-major lines are rows, so
+// it takes one dot product per element.  Either way, the packed array
+// is read line by line, forward for lower triangles and backward for
+// upper triangles.
+template<class in_matrix_t, class Triangle, class DiagonalStorage,
+         class in_vector_t, class out_vector_t, class BinaryDivideOp>
+void packed_triangular_matrix_vector_solve(const in_matrix_t& A, Triangle /* t */,
+                                           DiagonalStorage /* d */,
+                                           const in_vector_t& b, const out_vector_t& x,
+                                           BinaryDivideOp divide)
+{
+  using layout_type = typename in_matrix_t::layout_type;
+  using storage_order_type = typename layout_type::storage_order_type;
+  using index_type = typename in_matrix_t::index_type;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr bool column_major = std::is_same_v<storage_order_type, column_major_t>;
+
+  const index_type n = A.extent(0);
+  const auto& acc = A.accessor();
+  const auto p = A.data_handle();
+  if constexpr (column_major) {
+    for (index_type i = 0; i < n; ++i) {
+      x(i) = b(i);
+    }
+  }
+  for (index_type step = 0; step < n; ++step) {
+    const index_type l = lower ? step : index_type(n - index_type(1) - step);
+    const auto line = packed_line_of<Triangle, storage_order_type>(n, l);
+    std::size_t offset = line.offset;
+    if constexpr (column_major) {
+      if constexpr (explicit_diagonal) {
+        x(l) = divide(x(l), acc.access(p, line.diagonal));
+      }
+      const auto x_l = x(l);
+      for (index_type k = line.first; k < line.last; ++k, ++offset) {
+        x(k) -= acc.access(p, offset) * x_l;
+      }
+    }
+    else {
+      using sum_type = decltype(b(l) - acc.access(p, offset) * x(l));
+      sum_type t(b(l));
+      for (index_type k = line.first; k < line.last; ++k, ++offset) {
+        t = t - acc.access(p, offset) * x(k);
+      }
+      if constexpr (explicit_diagonal) {
+        x(l) = divide(t, acc.access(p, line.diagonal));
+      }
+      else {
+        x(l) = t;
+      }
+    }
+  }
+}
+
+// Blocked solve of A*x = b for A triangular in a strided array of
+// BLAS scalars, possibly scaled or conjugated.
+//
+// The sweep follows A's storage.  If A's columns are contiguous (as
+// for layout_left), each diagonal block is solved column by column,
+// and the panel below (lower) or above (upper) it is then subtracted
+// from the rest of x with the vectorized GEMV kernel, four columns at
+// a time, so that x is loaded and stored once for every four columns
+// of A.  A strided x is solved in a contiguous copy.  If A's rows are
+// contiguous (as for layout_right), each block first subtracts the
+// panel to its left (lower) or right (upper) with one vectorized dot
+// product per row, and then solves its diagonal block row by row.
+// Either way, A is read along its contiguous dimension only.
+
+inline constexpr std::size_t trsv_block_size = 64;
+
+template<class in_matrix_t, class out_vector_t>
+constexpr bool blocked_trsv_eligible()
+{
+  // b is copied into x, so b may be anything.
+  using scalar_type = typename out_vector_t::element_type;
+  return is_blas_writable_v<out_vector_t> &&
+    blas_traits_t<scalar_type, in_matrix_t>::valid &&
+    in_matrix_t::is_always_strided();
+}
+
+template<class in_matrix_t, class Triangle, class DiagonalStorage,
+         class in_vector_t, class out_vector_t, class BinaryDivideOp>
+void blocked_triangular_matrix_vector_solve(const in_matrix_t& A, Triangle /* t */,
+                                            DiagonalStorage /* d */,
+                                            const in_vector_t& b, const out_vector_t& x,
+                                            BinaryDivideOp divide)
+{
+  using scalar_type = typename out_vector_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_t>;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+
+  const std::size_t n = A.extent(0);
+  if (n == 0) {
+    return;
+  }
+
+  // The solve works on a contiguous x: x's own data if it has unit
+  // stride, and otherwise a copy that is written back at the end.
+  std::vector<scalar_type> x_copy;
+  scalar_type* xp = x.data_handle() + x.mapping()(0);
+  const bool x_contiguous = x.stride(0) == 1;
+  if (! x_contiguous) {
+    x_copy.resize(n);
+    xp = x_copy.data();
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    xp[i] = b(i);
+  }
+
+  // A(i,j) is alpha * conj^c(a[i * rs + j * cs]).  The diagonal goes
+  // through A itself, so divide sees the same values as in the
+  // unblocked solve.
+  const scalar_type alpha = A_traits::scaling_factor(A.accessor());
+  const scalar_type* const a = A.data_handle() + A.mapping()(0, 0);
+  const std::size_t rs = A.stride(0);
+  const std::size_t cs = A.stride(1);
+  auto stored = [] (const scalar_type& s) {
+    if constexpr (A_traits::conj) {
+      return conj_if_needed(s);
+    }
+    else {
+      return s;
+    }
+  };
+  auto solve_diagonal = [&] (std::size_t i) {
+    if constexpr (explicit_diagonal) {
+      xp[i] = divide(xp[i], A(i,i));
+    }
+  };
+
+  // x(k) -= A(k,l) * x(l) for k in [k0, k1), l in [l0, l1): a GEMV
+  // update, four columns of A at a time, if A's columns are contiguous.
+  auto column_panel_update = [&] (std::size_t k0, std::size_t k1,
+                                  std::size_t l0, std::size_t l1) {
+    if (k0 >= k1) {
+      return;
+    }
+    if (rs == 1 && ! A_traits::conj) {
+      scalar_type c[4];
+      std::size_t l = l0;
+      for (; l + 4 <= l1; l += 4) {
+        for (std::size_t q = 0; q < 4; ++q) {
+          c[q] = -(alpha * xp[l + q]);
+        }
+        simd_gemv_axpy_columns<4>(a + k0 + l * cs, cs, c, xp + k0, k1 - k0);
+      }
+      for (; l < l1; ++l) {
+        c[0] = -(alpha * xp[l]);
+        simd_gemv_axpy_columns<1>(a + k0 + l * cs, cs, c, xp + k0, k1 - k0);
+      }
+    }
+    else {
+      for (std::size_t l = l0; l < l1; ++l) {
+        const scalar_type c = alpha * xp[l];
+        const scalar_type* const a_l = a + l * cs;
+        for (std::size_t k = k0; k < k1; ++k) {
+          xp[k] -= stored(a_l[k * rs]) * c;
+        }
+      }
+    }
+  };
+  // x(k) -= sum of A(k,l) * x(l) over l in [l0, l1).
+  auto row_update = [&] (std::size_t k, std::size_t l0, std::size_t l1) {
+    if (l0 < l1) {
+      xp[k] -= alpha * simd_dot<A_traits::conj>(l1 - l0,
+        a + k * rs + l0 * cs, std::ptrdiff_t(cs), xp + l0, std::ptrdiff_t(1));
+    }
+  };
+
+  const std::size_t nb = trsv_block_size;
+  if (rs <= cs) {
+    if constexpr (lower) {
+      for (std::size_t j0 = 0; j0 < n; j0 += nb) {
+        const std::size_t j1 = std::min(n, j0 + nb);
+        for (std::size_t l = j0; l < j1; ++l) {
+          solve_diagonal(l);
+          column_panel_update(l + 1, j1, l, l + 1);
+        }
+        column_panel_update(j1, n, j0, j1);
+      }
+    }
+    else {
+      for (std::size_t j1 = n; j1 > 0; ) {
+        const std::size_t j0 = j1 - std::min(j1, nb);
+        for (std::size_t l = j1; l-- > j0; ) {
+          solve_diagonal(l);
+          column_panel_update(j0, l, l, l + 1);
+        }
+        column_panel_update(0, j0, j0, j1);
+        j1 = j0;
+      }
+    }
+  }
+  else {
+    if constexpr (lower) {
+      for (std::size_t i0 = 0; i0 < n; i0 += nb) {
+        const std::size_t i1 = std::min(n, i0 + nb);
+        for (std::size_t i = i0; i < i1; ++i) {
+          row_update(i, 0, i0);
+        }
+        for (std::size_t i = i0; i < i1; ++i) {
+          row_update(i, i0, i);
+          solve_diagonal(i);
+        }
+      }
+    }
+    else {
+      for (std::size_t i1 = n; i1 > 0; ) {
+        const std::size_t i0 = i1 - std::min(i1, nb);
+        for (std::size_t i = i0; i < i1; ++i) {
+          row_update(i, i1, n);
+        }
+        for (std::size_t i = i1; i-- > i0; ) {
+          row_update(i, i + 1, i1);
+          solve_diagonal(i);
+        }
+        i1 = i0;
+      }
+    }
+  }
+
+  if (! x_contiguous) {
+    for (std::size_t i = 0; i < n; ++i) {
+      x(i) = xp[i];
+    }
+  }
+}
+
+} // end namespace impl
+
+#ifdef LINALG_ENABLE_BLAS
+namespace impl {
+
+template<class in_matrix_t, class in_vector_t, class out_vector_t>
+constexpr bool triangular_matrix_vector_solve_dispatch_to_blas()
+{
+  // b is copied into x, so b may be anything.
+  using scalar_type = typename out_vector_t::element_type;
+  return is_blas_writable_v<out_vector_t> &&
+    is_blas_readable_v<scalar_type, in_matrix_t>;
+}
+
+// Solves op(A)*x = b with a single ?trsv call, after copying b into
+// x.  Returns false without touching x if A or x don't fit the BLAS.
+template<class in_matrix_t, class Triangle, class DiagonalStorage,
+         class in_vector_t, class out_vector_t>
+bool triangular_matrix_vector_solve_via_blas(const in_matrix_t& A, Triangle /* t */,
+                                             DiagonalStorage /* d */,
+                                             const in_vector_t& b, const out_vector_t& x)
+{
+  using scalar_type = typename out_vector_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_t>;
+
+  const auto N = A.extent(0);
+  if (N == 0 || ! blas_fits_int(N) ||
+      ! blas_available<scalar_type>(blas_routine::trsv)) {
+    return false;
+  }
+
+  bool A_trans = false;
+  int LDA = 0, INCX = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) || ! blas_vector_inc(x, INCX)) {
+    return false;
+  }
+  const char TRANS = blas_trans_char(A_trans, A_traits::conj);
+  // ?trsv has no alpha.  Besides, with an implicit unit diagonal,
+  // scaling A would only scale its off-diagonal part.
+  if (TRANS == '\0' || A_traits::scaling_factor(A.accessor()) != scalar_type(1)) {
+    return false;
+  }
+  // The transpose's lower triangle is the upper triangle.
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  const char UPLO = blas_uplo_char(lower != A_trans);
+  const char DIAG =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t> ? 'N' : 'U';
+
+  blas_copy_in(b, x);
+  BlasRoutines<scalar_type>::trsv(UPLO, TRANS, DIAG, int(N),
+                                  A.data_handle(), LDA,
+                                  x.data_handle(), INCX);
+  return true;
+}
+
+} // end namespace impl
+#endif // LINALG_ENABLE_BLAS
+
 // Special case: ExecutionPolicy = inline_exec_t
   
 template<class ElementType_A,
@@ -251,7 +548,19 @@ void triangular_matrix_vector_solve(
   mdspan<ElementType_X, extents<SizeType_X, ext_X>, Layout_X, Accessor_X> x,
   BinaryDivideOp divide)
 {
-  if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+  if constexpr (impl::stores_packed_triangle_v<decltype(A), Triangle>) {
+    impl::packed_triangular_matrix_vector_solve(A, t, d, b, x, divide);
+  }
+  else if constexpr (impl::static_triangular_matrix_vector_solve_eligible<
+                       decltype(A), decltype(b), decltype(x)>()) {
+    impl::static_triangular_matrix_vector_solve<
+      std::is_same_v<Triangle, lower_triangle_t>,
+      std::is_same_v<DiagonalStorage, explicit_diagonal_t>>(A, b, x, divide);
+  }
+  else if constexpr (impl::blocked_trsv_eligible<decltype(A), decltype(x)>()) {
+    impl::blocked_triangular_matrix_vector_solve(A, t, d, b, x, divide);
+  }
+  else if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
     trsv_lower_triangular_left_side(A, d, b, x, divide);
   }
   else {
@@ -282,6 +591,17 @@ void triangular_matrix_vector_solve(
   mdspan<ElementType_B, extents<SizeType_B, ext_B>, Layout_B, Accessor_B> b,
   mdspan<ElementType_X, extents<SizeType_X, ext_X>, Layout_X, Accessor_X> x)
 {
+#ifdef LINALG_ENABLE_BLAS
+  // Small static extents take the unrolled solve instead.
+  if constexpr (impl::triangular_matrix_vector_solve_dispatch_to_blas<decltype(A), decltype(b), decltype(x)>() &&
+                ! impl::static_triangular_matrix_vector_solve_eligible<
+                    decltype(A), decltype(b), decltype(x)>()) {
+    if (impl::triangular_matrix_vector_solve_via_blas(A, t, d, b, x)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
   auto divide = [](const auto& x, const auto& y) { return x / y; };
   triangular_matrix_vector_solve(std::forward<impl::inline_exec_t>(exec), A, t, d, b, x, divide);
 }
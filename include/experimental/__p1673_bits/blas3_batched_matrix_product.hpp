@@ -0,0 +1,574 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_MATRIX_PRODUCT_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_MATRIX_PRODUCT_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Batched matrix-matrix products: C[b] := A[b] * B[b], or C[b] := E[b]
+// + A[b] * B[b], for every item b of a batch of matrices.  A batch is
+// either a rank-3 mdspan with extents (batch, rows, columns), or a
+// range of rank-2 mdspans (anything with std::size and operator[]),
+// whose items may differ in size.  Element types and accessors follow
+// the rules of matrix_product.
+//
+// Rank-3 batches whose batch index has stride 1 in A, B and C (for
+// example, layout_batch_interleaved) store each element (i,j) of all
+// items contiguously.  Their product runs the SIMD lanes across the
+// items, a chunk of items at a time, so even 4 x 4 matrices use full
+// vectors.  Other rank-3 batches of large enough items go through
+// matrix_product item by item (and so through the BLAS or the packed
+// GEMM engine), and batches of small items through plain loops, with
+// all dispatch decisions made once for the batch.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+
+// Layout of a rank-3 batch (batch, rows, columns) that stores the
+// batch index innermost, so that element (i,j) of consecutive items
+// is contiguous.
+using layout_batch_interleaved = layout_left;
+
+namespace impl {
+
+// Item b of the batch X, as a layout_stride view: a matrix of a rank-3
+// batch of matrices, or a vector of a rank-2 batch of vectors.
+template<class ElementType, class Extents, class Layout, class Accessor>
+auto batch_item(const mdspan<ElementType, Extents, Layout, Accessor>& X, std::size_t b)
+{
+  static_assert(Extents::rank() == 2 || Extents::rank() == 3);
+  using index_type = typename Extents::index_type;
+  using extents_type = dextents<index_type, Extents::rank() - 1>;
+  using accessor_type = typename Accessor::offset_policy;
+  using element_type = typename accessor_type::element_type;
+
+  std::size_t offset = 0;
+  std::array<index_type, Extents::rank() - 1> strides{};
+  if constexpr (Extents::rank() == 3) {
+    if (X.extent(1) != 0 && X.extent(2) != 0) {
+      offset = std::size_t(X.mapping()(index_type(b), index_type(0), index_type(0)));
+    }
+    strides = {index_type(X.stride(1)), index_type(X.stride(2))};
+  }
+  else {
+    if (X.extent(1) != 0) {
+      offset = std::size_t(X.mapping()(index_type(b), index_type(0)));
+    }
+    strides = {index_type(X.stride(1))};
+  }
+  std::array<index_type, Extents::rank() - 1> item_extents{};
+  for (std::size_t r = 1; r < Extents::rank(); ++r) {
+    item_extents[r - 1] = X.extent(r);
+  }
+  const typename layout_stride::template mapping<extents_type> map(
+    extents_type(item_extents), strides);
+  return mdspan<element_type, extents_type, layout_stride, accessor_type>(
+    X.accessor().offset(X.data_handle(), offset), map, accessor_type(X.accessor()));
+}
+
+template<class T>
+inline constexpr bool has_default_accessor_v =
+  std::is_same_v<typename T::accessor_type, default_accessor<typename T::element_type>>;
+
+// Whether batches of these types may take the batch-interleaved
+// kernels, when their batch index has stride 1.  Half-precision types
+// are left to the per-item algorithms, which sum them in float.
+template<class out_batch_t, class... in_batch_t>
+constexpr bool interleaved_batch_eligible()
+{
+  using value_type = typename out_batch_t::value_type;
+  return std::is_arithmetic_v<value_type> && ! is_half_precision_v<value_type> &&
+    (std::is_same_v<value_type, typename in_batch_t::value_type> && ...) &&
+    has_default_accessor_v<out_batch_t> && (has_default_accessor_v<in_batch_t> && ...) &&
+    out_batch_t::is_always_strided() && (in_batch_t::is_always_strided() && ...);
+}
+
+template<class... Batches>
+bool unit_batch_stride(const Batches&... X)
+{
+  return ((X.stride(0) == 1) && ...);
+}
+
+template<class in_batch_1_t, class in_batch_2_t, class out_batch_t>
+constexpr bool interleaved_batched_gemm_eligible()
+{
+  return interleaved_batch_eligible<out_batch_t, in_batch_1_t, in_batch_2_t>();
+}
+
+// Number of items that the interleaved product works on at once:
+// enough for long SIMD loops, and few enough that the chunk of A, B
+// and C stays in L2.
+inline std::size_t interleaved_batch_chunk(std::size_t item_elements,
+                                           std::size_t element_size)
+{
+  constexpr std::size_t l2_bytes = 256 * 1024;
+  const std::size_t chunk =
+    l2_bytes / std::max(std::size_t(1), item_elements * element_size);
+  return std::clamp(chunk / 16 * 16, std::size_t(16), std::size_t(1024));
+}
+
+// C(b,:,:) := init(b,:,:) + A(b,:,:) * B(b,:,:) for b in [b_begin,
+// b_end), for batches with unit batch stride.  For each element (i,j)
+// of a chunk of items, C's chunk of element (i,j) stays in L1 while
+// the products A(:,i,l) * B(:,l,j) are added to it elementwise.
+template<class in_batch_1_t, class in_batch_2_t, class out_batch_t, class Init>
+void interleaved_batched_gemm(const in_batch_1_t& A, const in_batch_2_t& B,
+                              const out_batch_t& C, Init init,
+                              std::size_t b_begin, std::size_t b_end)
+{
+  using value_type = typename out_batch_t::value_type;
+  const std::size_t m = C.extent(1);
+  const std::size_t n = C.extent(2);
+  const std::size_t k = A.extent(2);
+  if (b_begin >= b_end || m == 0 || n == 0) {
+    return;
+  }
+  const value_type* const a = A.data_handle();
+  const value_type* const b = B.data_handle();
+  value_type* const c = C.data_handle();
+  const std::size_t a_i = A.stride(1), a_l = A.stride(2);
+  const std::size_t b_l = B.stride(1), b_j = B.stride(2);
+  const std::size_t c_i = C.stride(1), c_j = C.stride(2);
+  const simd_isa isa = active_simd_isa();
+  const std::size_t chunk =
+    interleaved_batch_chunk(m * k + k * n + m * n, sizeof(value_type));
+
+  for (std::size_t b0 = b_begin; b0 < b_end; b0 += chunk) {
+    const std::size_t w = std::min(chunk, b_end - b0);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        value_type* const c_ij = c + b0 + i * c_i + j * c_j;
+        for (std::size_t t = 0; t < w; ++t) {
+          c_ij[t] = init(b0 + t, i, j);
+        }
+        for (std::size_t l = 0; l < k; ++l) {
+          simd_multiply_add(isa, a + b0 + i * a_i + l * a_l,
+                            b + b0 + l * b_l + j * b_j, c_ij, w);
+        }
+      }
+    }
+  }
+}
+
+// The products of items [b_begin, b_end) of a rank-3 batch.  init(b,
+// i, j) is the value that C(b,i,j) starts from; item_product(b)
+// computes item b with matrix_product.
+template<class in_batch_1_t, class in_batch_2_t, class out_batch_t,
+         class Init, class ItemProduct>
+void batched_matrix_product_block(const in_batch_1_t& A, const in_batch_2_t& B,
+                                  const out_batch_t& C, Init init,
+                                  ItemProduct item_product,
+                                  std::size_t b_begin, std::size_t b_end)
+{
+  if constexpr (interleaved_batched_gemm_eligible<in_batch_1_t, in_batch_2_t, out_batch_t>()) {
+    if (unit_batch_stride(A, B, C)) {
+      interleaved_batched_gemm(A, B, C, init, b_begin, b_end);
+      return;
+    }
+  }
+  if constexpr (! std::is_same_v<ItemProduct, std::nullptr_t>) {
+    if (packed_gemm_worthwhile(C.extent(1), C.extent(2), A.extent(2))) {
+      for (std::size_t b = b_begin; b < b_end; ++b) {
+        item_product(b);
+      }
+      return;
+    }
+  }
+  for (std::size_t b = b_begin; b < b_end; ++b) {
+    for (std::size_t i = 0; i < C.extent(1); ++i) {
+      for (std::size_t j = 0; j < C.extent(2); ++j) {
+        C(b,i,j) = init(b, i, j);
+        for (std::size_t l = 0; l < A.extent(2); ++l) {
+          C(b,i,j) += A(b,i,l) * B(b,l,j);
+        }
+      }
+    }
+  }
+}
+
+// C(b,:,:) := A(b,:,:) * B(b,:,:) for b in [b_begin, b_end).
+template<class in_batch_1_t, class in_batch_2_t, class out_batch_t>
+void batched_matrix_product_block(const in_batch_1_t& A, const in_batch_2_t& B,
+                                  const out_batch_t& C,
+                                  std::size_t b_begin, std::size_t b_end)
+{
+  using element_type = typename out_batch_t::element_type;
+  auto init = [] (std::size_t, std::size_t, std::size_t) { return element_type{}; };
+  if constexpr (in_batch_1_t::is_always_strided() && in_batch_2_t::is_always_strided() &&
+                out_batch_t::is_always_strided()) {
+    batched_matrix_product_block(A, B, C, init, [&] (std::size_t b) {
+        linalg::matrix_product(inline_exec_t{}, batch_item(A, b), batch_item(B, b),
+                               batch_item(C, b));
+      }, b_begin, b_end);
+  }
+  else {
+    batched_matrix_product_block(A, B, C, init, nullptr, b_begin, b_end);
+  }
+}
+
+// C(b,:,:) := E(b,:,:) + A(b,:,:) * B(b,:,:) for b in [b_begin, b_end).
+template<class in_batch_1_t, class in_batch_2_t, class in_batch_3_t,
+         class out_batch_t>
+void batched_matrix_product_block(const in_batch_1_t& A, const in_batch_2_t& B,
+                                  const in_batch_3_t& E, const out_batch_t& C,
+                                  std::size_t b_begin, std::size_t b_end)
+{
+  // E may be C itself; each element of E is read before C's element
+  // in the same place is written.
+  auto init = [&] (std::size_t b, std::size_t i, std::size_t j) { return E(b,i,j); };
+  if constexpr (in_batch_1_t::is_always_strided() && in_batch_2_t::is_always_strided() &&
+                in_batch_3_t::is_always_strided() && out_batch_t::is_always_strided()) {
+    batched_matrix_product_block(A, B, C, init, [&] (std::size_t b) {
+        linalg::matrix_product(inline_exec_t{}, batch_item(A, b), batch_item(B, b),
+                               batch_item(E, b), batch_item(C, b));
+      }, b_begin, b_end);
+  }
+  else {
+    batched_matrix_product_block(A, B, C, init, nullptr, b_begin, b_end);
+  }
+}
+
+// Whether Range is a range of rank-2 mdspans, for the batched_matrix_product
+// overloads that take one matrix per item.
+template<class Range, class = void>
+struct is_matrix_batch_range : std::false_type {};
+
+template<class Range>
+struct is_matrix_batch_range<Range, std::void_t<
+  decltype(std::size(std::declval<const Range&>())),
+  decltype(std::declval<const Range&>()[std::size_t{}])>>
+{
+  using item_type = std::decay_t<decltype(std::declval<const Range&>()[std::size_t{}])>;
+  static constexpr bool value = ! is_mdspan_v<Range> && is_mdspan_v<item_type>;
+};
+
+template<class Range>
+inline constexpr bool is_matrix_batch_range_v = is_matrix_batch_range<Range>::value;
+
+} // end namespace impl
+
+namespace {
+
+template <class Exec, class A_t, class B_t, class C_t, class = void>
+struct is_custom_batched_matrix_product_avail : std::false_type {};
+
+template <class Exec, class A_t, class B_t, class C_t>
+struct is_custom_batched_matrix_product_avail<
+  Exec, A_t, B_t, C_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       batched_matrix_product
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<B_t>(),
+		std::declval<C_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+template <class Exec, class A_t, class B_t, class E_t, class C_t, class = void>
+struct is_custom_batched_matrix_product_with_update_avail : std::false_type {};
+
+template <class Exec, class A_t, class B_t, class E_t, class C_t>
+struct is_custom_batched_matrix_product_with_update_avail<
+  Exec, A_t, B_t, E_t, C_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       batched_matrix_product
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<B_t>(),
+		std::declval<E_t>(),
+		std::declval<C_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+} // end anonymous namespace
+
+// Overwriting batched matrix-matrix product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::batched_matrix_product_block(A, B, C, 0, C.extent(0));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  constexpr bool use_custom = is_custom_batched_matrix_product_avail<
+    decltype(execpolicy_mapper(exec)), decltype(A), decltype(B), decltype(C)>::value;
+
+  if constexpr (use_custom) {
+    batched_matrix_product(execpolicy_mapper(exec), A, B, C);
+  }
+  else {
+    batched_matrix_product(impl::inline_exec_t{}, A, B, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  batched_matrix_product(impl::default_exec_t{}, A, B, C);
+}
+
+// Updating batched matrix-matrix product
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t batch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, batch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  impl::batched_matrix_product_block(A, B, E, C, 0, C.extent(0));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t batch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, batch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  constexpr bool use_custom = is_custom_batched_matrix_product_with_update_avail<
+    decltype(execpolicy_mapper(exec)),
+    decltype(A), decltype(B), decltype(E), decltype(C)>::value;
+
+  if constexpr (use_custom) {
+    batched_matrix_product(execpolicy_mapper(exec), A, B, E, C);
+  }
+  else {
+    batched_matrix_product(impl::inline_exec_t{}, A, B, E, C);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t batch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, batch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  batched_matrix_product(impl::default_exec_t{}, A, B, E, C);
+}
+
+// Overwriting batched matrix-matrix product of ranges of matrices:
+// C[b] := A[b] * B[b] for b in [0, std::size(C)).
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class InMatrixRange1,
+  class InMatrixRange2,
+  class OutMatrixRange,
+  /* requires */ (impl::is_matrix_batch_range_v<InMatrixRange1> &&
+                  impl::is_matrix_batch_range_v<InMatrixRange2> &&
+                  impl::is_matrix_batch_range_v<OutMatrixRange>)
+)
+void batched_matrix_product(
+  impl::inline_exec_t&& /* exec */,
+  const InMatrixRange1& A,
+  const InMatrixRange2& B,
+  const OutMatrixRange& C)
+{
+  const std::size_t batch = std::size(C);
+  for (std::size_t b = 0; b < batch; ++b) {
+    matrix_product(impl::inline_exec_t{}, A[b], B[b], C[b]);
+  }
+}
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class ExecutionPolicy,
+  class InMatrixRange1,
+  class InMatrixRange2,
+  class OutMatrixRange,
+  /* requires */ (impl::is_matrix_batch_range_v<InMatrixRange1> &&
+                  impl::is_matrix_batch_range_v<InMatrixRange2> &&
+                  impl::is_matrix_batch_range_v<OutMatrixRange>)
+)
+void batched_matrix_product(
+  ExecutionPolicy&& exec,
+  const InMatrixRange1& A,
+  const InMatrixRange2& B,
+  const OutMatrixRange& C)
+{
+  constexpr bool use_custom = is_custom_batched_matrix_product_avail<
+    decltype(execpolicy_mapper(exec)), const InMatrixRange1&, const InMatrixRange2&,
+    const OutMatrixRange&>::value;
+
+  if constexpr (use_custom) {
+    batched_matrix_product(execpolicy_mapper(exec), A, B, C);
+  }
+  else {
+    batched_matrix_product(impl::inline_exec_t{}, A, B, C);
+  }
+}
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class InMatrixRange1,
+  class InMatrixRange2,
+  class OutMatrixRange,
+  /* requires */ (impl::is_matrix_batch_range_v<InMatrixRange1> &&
+                  impl::is_matrix_batch_range_v<InMatrixRange2> &&
+                  impl::is_matrix_batch_range_v<OutMatrixRange>)
+)
+void batched_matrix_product(
+  const InMatrixRange1& A,
+  const InMatrixRange2& B,
+  const OutMatrixRange& C)
+{
+  batched_matrix_product(impl::default_exec_t{}, A, B, C);
+}
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_MATRIX_PRODUCT_HPP_
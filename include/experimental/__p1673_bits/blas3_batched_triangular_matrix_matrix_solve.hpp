@@ -0,0 +1,283 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_TRIANGULAR_MATRIX_MATRIX_SOLVE_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_TRIANGULAR_MATRIX_MATRIX_SOLVE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+// Batched triangular solves with many right-hand sides: solve
+// A[b] * X[b] = B[b] for X[b], for a rank-3 batch A of square
+// triangular matrices and rank-3 batches B, X (batch, rows, columns).
+// X may be B itself.  When the batch index has stride 1 in all of
+// them (as with layout_batch_interleaved), the substitution runs the
+// SIMD lanes across the items; see blas3_batched_matrix_product.hpp.
+// Otherwise each item goes through triangular_matrix_matrix_left_solve.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+
+namespace impl {
+
+// X(b,:,:) := A(b,:,:) \ B(b,:,:) for b in [b_begin, b_end), for
+// batches with unit batch stride.  Each column of a chunk of items is
+// solved by substitution, row by row; a row of the chunk stays in L1
+// while the rows already solved are subtracted from it.
+template<bool Lower, bool ExplicitDiagonal,
+         class in_batch_1_t, class in_batch_2_t, class out_batch_t>
+void interleaved_batched_trsm_left(const in_batch_1_t& A, const in_batch_2_t& B,
+                                   const out_batch_t& X,
+                                   std::size_t b_begin, std::size_t b_end)
+{
+  using value_type = typename out_batch_t::value_type;
+  const std::size_t m = X.extent(1);
+  const std::size_t n = X.extent(2);
+  if (b_begin >= b_end || m == 0 || n == 0) {
+    return;
+  }
+  const value_type* const a = A.data_handle();
+  const value_type* const bp = B.data_handle();
+  value_type* const x = X.data_handle();
+  const std::size_t a_i = A.stride(1), a_j = A.stride(2);
+  const std::size_t b_i = B.stride(1), b_k = B.stride(2);
+  const std::size_t x_i = X.stride(1), x_k = X.stride(2);
+  const simd_isa isa = active_simd_isa();
+  const std::size_t chunk =
+    interleaved_batch_chunk(m * m / 2 + 2 * m * n, sizeof(value_type));
+
+  for (std::size_t b0 = b_begin; b0 < b_end; b0 += chunk) {
+    const std::size_t w = std::min(chunk, b_end - b0);
+    for (std::size_t k = 0; k < n; ++k) {
+      for (std::size_t step = 0; step < m; ++step) {
+        const std::size_t i = Lower ? step : m - 1 - step;
+        value_type* const x_ik = x + b0 + i * x_i + k * x_k;
+        const value_type* const b_ik = bp + b0 + i * b_i + k * b_k;
+        for (std::size_t t = 0; t < w; ++t) {
+          x_ik[t] = b_ik[t];
+        }
+        const std::size_t j_begin = Lower ? 0 : i + 1;
+        const std::size_t j_end = Lower ? i : m;
+        for (std::size_t j = j_begin; j < j_end; ++j) {
+          simd_multiply_add<true>(isa, a + b0 + i * a_i + j * a_j,
+                                  x + b0 + j * x_i + k * x_k, x_ik, w);
+        }
+        if constexpr (ExplicitDiagonal) {
+          const value_type* const a_ii = a + b0 + i * a_i + i * a_j;
+          for (std::size_t t = 0; t < w; ++t) {
+            x_ik[t] /= a_ii[t];
+          }
+        }
+      }
+    }
+  }
+}
+
+// X(b,:,:) := A(b,:,:) \ B(b,:,:) for b in [b_begin, b_end).
+template<class in_batch_1_t, class Triangle, class DiagonalStorage,
+         class in_batch_2_t, class out_batch_t>
+void batched_triangular_matrix_matrix_left_solve_block(
+  const in_batch_1_t& A, Triangle t, DiagonalStorage d,
+  const in_batch_2_t& B, const out_batch_t& X,
+  std::size_t b_begin, std::size_t b_end)
+{
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr bool explicit_diagonal = std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+
+  if constexpr (interleaved_batch_eligible<out_batch_t, in_batch_1_t, in_batch_2_t>()) {
+    if (unit_batch_stride(A, B, X)) {
+      interleaved_batched_trsm_left<lower, explicit_diagonal>(A, B, X, b_begin, b_end);
+      return;
+    }
+  }
+  if constexpr (in_batch_1_t::is_always_strided() && in_batch_2_t::is_always_strided() &&
+                out_batch_t::is_always_strided()) {
+    for (std::size_t b = b_begin; b < b_end; ++b) {
+      linalg::triangular_matrix_matrix_left_solve(inline_exec_t{}, batch_item(A, b), t, d,
+                                                  batch_item(B, b), batch_item(X, b));
+    }
+  }
+  else {
+    const std::size_t m = X.extent(1);
+    for (std::size_t b = b_begin; b < b_end; ++b) {
+      for (std::size_t k = 0; k < X.extent(2); ++k) {
+        for (std::size_t step = 0; step < m; ++step) {
+          const std::size_t i = lower ? step : m - 1 - step;
+          typename out_batch_t::value_type x_ik(B(b,i,k));
+          for (std::size_t j = lower ? 0 : i + 1; j < (lower ? i : m); ++j) {
+            x_ik = x_ik - A(b,i,j) * X(b,j,k);
+          }
+          if constexpr (explicit_diagonal) {
+            X(b,i,k) = x_ik / A(b,i,i);
+          }
+          else {
+            X(b,i,k) = x_ik;
+          }
+        }
+      }
+    }
+  }
+}
+
+} // end namespace impl
+
+namespace {
+
+template <class Exec, class A_t, class Tri_t, class D_t, class B_t, class X_t, class = void>
+struct is_custom_batched_tri_matrix_matrix_left_solve_avail : std::false_type {};
+
+template <class Exec, class A_t, class Tri_t, class D_t, class B_t, class X_t>
+struct is_custom_batched_tri_matrix_matrix_left_solve_avail<
+  Exec, A_t, Tri_t, D_t, B_t, X_t,
+  std::enable_if_t<
+    std::is_void_v<
+      decltype(
+	       batched_triangular_matrix_matrix_left_solve
+	       (std::declval<Exec>(),
+		std::declval<A_t>(),
+		std::declval<Tri_t>(),
+		std::declval<D_t>(),
+		std::declval<B_t>(),
+		std::declval<X_t>()))
+      >
+    && ! impl::is_inline_exec_v<Exec>
+    >
+  >
+  : std::true_type{};
+
+} // end anonymous namespace
+
+// batched_triangular_matrix_matrix_left_solve
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t batch_X, ::std::size_t numRows_X, ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void batched_triangular_matrix_matrix_left_solve(
+  impl::inline_exec_t&& /* exec */,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, batch_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  impl::batched_triangular_matrix_matrix_left_solve_block(A, t, d, B, X, 0, X.extent(0));
+}
+
+template<class ExecutionPolicy,
+         class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t batch_X, ::std::size_t numRows_X, ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void batched_triangular_matrix_matrix_left_solve(
+  ExecutionPolicy&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, batch_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  constexpr bool use_custom = is_custom_batched_tri_matrix_matrix_left_solve_avail<
+    decltype(execpolicy_mapper(exec)),
+    decltype(A), Triangle, DiagonalStorage, decltype(B), decltype(X)>::value;
+
+  if constexpr (use_custom) {
+    batched_triangular_matrix_matrix_left_solve(execpolicy_mapper(exec), A, t, d, B, X);
+  }
+  else {
+    batched_triangular_matrix_matrix_left_solve(impl::inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t batch_X, ::std::size_t numRows_X, ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void batched_triangular_matrix_matrix_left_solve(
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, batch_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  batched_triangular_matrix_matrix_left_solve(impl::default_exec_t{}, A, t, d, B, X);
+}
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_BATCHED_TRIANGULAR_MATRIX_MATRIX_SOLVE_HPP_
@@ -51,213 +51,8 @@ namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
 namespace linalg {
 
-// FIXME (mfh 2022/06/17) Temporarily disable calling the BLAS,
-// to get PR testing workflow running with mdspan tag.
-#if 0
 #ifdef LINALG_ENABLE_BLAS
-
-// NOTE: I'm only exposing these extern declarations in a header file
-// so that we can keep this a header-only library, for ease of testing
-// and installation.  Exposing them in a real production
-// implementation is really bad form.  This is because users may
-// declare their own extern declarations of BLAS functions, and yours
-// will collide with theirs at build time.
-
-// NOTE: I'm assuming a particular BLAS ABI mangling here.  Typical
-// BLAS C++ wrappers need to account for a variety of manglings that
-// don't necessarily match the system's Fortran compiler (if it has
-// one).  Lowercase with trailing underscore is a common pattern.
-// Watch out for BLAS functions that return something, esp. a complex
-// number.
-
-extern "C" void
-dgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const double* pALPHA,
-        const double* A, const int* pLDA,
-        const double* B, const int* pLDB,
-        const double* pBETA,
-        double* C, const int* pLDC);
-
-extern "C" void
-sgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const float* pALPHA,
-        const float* A, const int* pLDA,
-        const float* B, const int* pLDB,
-        const float* pBETA,
-        float* C, const int* pLDC);
-
-extern "C" void
-cgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const void* pALPHA,
-        const void* A, const int* pLDA,
-        const void* B, const int* pLDB,
-        const void* pBETA,
-        void* C, const int* pLDC);
-
-extern "C" void
-zgemm_ (const char TRANSA[], const char TRANSB[],
-        const int* pM, const int* pN, const int* pK,
-        const void* pALPHA,
-        const void* A, const int* pLDA,
-        const void* B, const int* pLDB,
-        const void* pBETA,
-        void* C, const int* pLDC);
-
-template<class Scalar>
-struct BlasGemm {
-  // static void
-  // gemm (const char TRANSA[], const char TRANSB[],
-  //       const int M, const int N, const int K,
-  //       const Scalar ALPHA,
-  //       const Scalar* A, const int LDA,
-  //       const Scalar* B, const int LDB,
-  //       const Scalar BETA,
-  //       Scalar* C, const int LDC);
-};
-
-template<>
-struct BlasGemm<double> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const double ALPHA,
-        const double* A, const int LDA,
-        const double* B, const int LDB,
-        const double BETA,
-        double* C, const int LDC)
-  {
-    dgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<>
-struct BlasGemm<float> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const float ALPHA,
-        const float* A, const int LDA,
-        const float* B, const int LDB,
-        const float BETA,
-        float* C, const int LDC)
-  {
-    sgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<>
-struct BlasGemm<std::complex<double>> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const std::complex<double> ALPHA,
-        const std::complex<double>* A, const int LDA,
-        const std::complex<double>* B, const int LDB,
-        const std::complex<double> BETA,
-        std::complex<double>* C, const int LDC)
-  {
-    zgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<>
-struct BlasGemm<std::complex<float>> {
-  static void
-  gemm (const char TRANSA[], const char TRANSB[],
-        const int M, const int N, const int K,
-        const std::complex<float> ALPHA,
-        const std::complex<float>* A, const int LDA,
-        const std::complex<float>* B, const int LDB,
-        const std::complex<float> BETA,
-        std::complex<float>* C, const int LDC)
-  {
-    cgemm_ (TRANSA, TRANSB, &M, &N, &K,
-            &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
-  }
-};
-
-template<class in_matrix_t>
-constexpr bool valid_input_blas_accessor()
-{
-  using elt_type = typename in_matrix_t::element_type;
-  using val_type = typename in_matrix_t::value_type;
-  using acc_type = typename in_matrix_t::accessor_type;
-
-  using def_acc_type = default_accessor<elt_type>;
-  using conj_def_acc_type = conjugated_accessor<def_acc_type>;
-  using scal_def_acc_type = accessor_scaled<val_type, def_acc_type>;
-  using scal_conj_acc_type = accessor_scaled<val_type, conj_def_acc_type>;
-  using conj_scal_acc_type = conjugated_accessor<scal_def_acc_type>;
-
-  // The two matrices' accessor types need not be the same.
-  // Input matrices may be scaled or transposed.
-  return std::is_same_v<acc_type, def_acc_type> ||
-    std::is_same_v<acc_type, conj_def_acc_type> ||
-    std::is_same_v<acc_type, scal_def_acc_type> ||
-    std::is_same_v<acc_type, scal_conj_acc_type> ||
-    std::is_same_v<acc_type, conj_scal_acc_type>;
-}
-
-template<class inout_matrix_t>
-constexpr bool valid_output_blas_accessor ()
-{
-  using element_type = typename inout_matrix_t::element_type;
-  using accessor_type = typename inout_matrix_t::accessor_type;
-
-  return std::is_same_v<accessor_type,
-                        default_accessor<element_type>>;
-}
-
-template<class in_matrix_t>
-constexpr bool valid_input_blas_layout()
-{
-  // transposed(A) transforms
-  //
-  // * layout_left into layout_right,
-  // * layout_right into layout_left,
-  // * layout_stride into layout_stride,
-  // * layout_blas_general<column_major_t> into layout_blas_general<row_major_t>, and
-  // * layout_blas_general<row_major_t> into layout_blas_general<column_major_t>.
-  //
-  // Thus, layout_transpose would never occur with a valid BLAS layout.
-  //
-  // For now, we only support column-major layouts.
-  using layout_type = typename in_matrix_t::layout_type;
-  return std::is_same_v<layout_type, layout_left>;
-}
-
-template<class inout_matrix_t>
-constexpr bool valid_output_blas_layout()
-{
-  using layout_type = typename inout_matrix_t::layout_type;
-  return std::is_same_v<layout_type, layout_left>;
-}
-
-template<class in_matrix_1_t,
-         class in_matrix_2_t,
-         class out_matrix_t>
-constexpr bool
-valid_blas_element_types()
-{
-  using element_type = typename out_matrix_t::element_type;
-  constexpr bool elt_types_same =
-    std::is_same_v<element_type,
-                   typename in_matrix_1_t::element_type> &&
-    std::is_same_v<element_type,
-                   typename in_matrix_2_t::element_type>;
-  constexpr bool elt_type_ok =
-    std::is_same_v<element_type, double> ||
-    std::is_same_v<element_type, float> ||
-    std::is_same_v<element_type, std::complex<double>> ||
-    std::is_same_v<element_type, std::complex<float>>;
-  return elt_types_same && elt_type_ok;
-}
+namespace impl {
 
 template<class in_matrix_1_t,
          class in_matrix_2_t,
@@ -265,103 +60,85 @@ template<class in_matrix_1_t,
 constexpr bool
 matrix_product_dispatch_to_blas()
 {
-  // The accessor types need not be the same.
-  // Input matrices may be scaled or transposed.
-  constexpr bool in1_acc_type_ok =
-    valid_input_blas_accessor<in_matrix_1_t>();
-  constexpr bool in2_acc_type_ok =
-    valid_input_blas_accessor<in_matrix_2_t>();
-  constexpr bool out_acc_type_ok =
-    valid_output_blas_accessor<out_matrix_t>();
-
-  constexpr bool in1_layout_ok = valid_input_blas_layout<in_matrix_1_t>();
-  constexpr bool in2_layout_ok = valid_input_blas_layout<in_matrix_2_t>();
-  constexpr bool out_layout_ok = valid_output_blas_layout<out_matrix_t>();
-
-  // If both dimensions are run time, then it's likely that they are
-  // appropriate for the BLAS.  Compile-time dimensions are probably
+  using scalar_type = typename out_matrix_t::element_type;
+
+  // Input matrices may be scaled, conjugated or transposed, and may
+  // have any strided layout; we sort the strides out at run time.
+  //
+  // If both of C's dimensions are compile time, then it's probably
   // small, and BLAS implementations aren't optimized for that case.
-  return out_matrix_t::rank_dynamic() == 2 &&
-    valid_blas_element_types<in_matrix_1_t, in_matrix_2_t, out_matrix_t>() &&
-    in1_acc_type_ok && in2_acc_type_ok && out_acc_type_ok &&
-    in1_layout_ok && in2_layout_ok && out_layout_ok;
+  return out_matrix_t::rank_dynamic() != 0 &&
+    is_blas_writable_v<out_matrix_t> &&
+    is_blas_readable_v<scalar_type, in_matrix_1_t> &&
+    is_blas_readable_v<scalar_type, in_matrix_2_t>;
 }
 
-template<class Accessor, class ValueType>
-static constexpr bool is_compatible_accessor_scaled_v = false;
-
-template<class ScalingFactor, class NestedAccessor, class ValueType>
-static constexpr bool is_compatible_accessor_scaled_v<
-  accessor_scaled<ScalingFactor, NestedAccessor>, ValueType> =
-    std::is_same_v<typename accessor_scaled<ScalingFactor, NestedAccessor>::value_type, ValueType>;
-
-template<class Accessor>
-static constexpr bool is_conjugated_accessor_v = false;
-
-template<class NestedAccessor>
-static constexpr bool is_conjugated_accessor_v<conjugated_accessor<NestedAccessor>> = true;
-
-template<class in_matrix_t>
-typename in_matrix_t::value_type
-extractScalingFactor(in_matrix_t A,
-		     const typename in_matrix_t::value_type defaultValue)
+// Computes C = alpha*op(A)*op(B) + beta*C with a single ?gemm call,
+// folding any scaling of A and B into alpha, and any transposition
+// or conjugation into TRANSA and TRANSB.  get_beta() is called only
+// once the call is certain.  Returns false without touching C if A,
+// B and C's strides or conjugations don't fit the BLAS, or if the
+// problem is empty.
+template<class in_matrix_1_t,
+         class in_matrix_2_t,
+         class out_matrix_t,
+         class BetaFunction>
+bool matrix_product_via_blas(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                             const out_matrix_t& C, BetaFunction get_beta)
 {
-  using acc_t = typename in_matrix_t::accessor_type;
-  using val_t = typename in_matrix_t::value_type;
-
-  if constexpr (is_compatible_accessor_scaled_v<acc_t, val_t>) {
-    return A.accessor.scale_factor();
-  } else if constexpr (is_conjugated_accessor_v<acc_t>) {
-    // conjugated(scaled(alpha, A)) means that both alpha and A are conjugated.
-    using nested_acc_t = decltype(A.accessor().nested_accessor());
-    if constexpr (is_compatible_accessor_scaled_v<nested_acc_t>) {
-      return impl::conj_if_needed(extractScalingFactor(A.accessor.nested_accessor()));
-    } else {
-      return defaultValue;
-    }
-  } else {
-    return defaultValue;
+  using scalar_type = typename out_matrix_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_1_t>;
+  using B_traits = blas_traits_t<scalar_type, in_matrix_2_t>;
+
+  const auto M = C.extent(0);
+  const auto N = C.extent(1);
+  const auto K = A.extent(1);
+  if (M == 0 || N == 0 || K == 0 ||
+      ! blas_fits_int(M) || ! blas_fits_int(N) || ! blas_fits_int(K) ||
+      ! blas_available<scalar_type>(blas_routine::gemm)) {
+    return false;
   }
-}
-
-template<class in_matrix_t>
-constexpr bool extractTrans()
-{
-  using layout_type = typename in_matrix_t::layout_type;
-  using valid_trans_layout_0 = layout_transpose<layout_left>;
-  // using valid_trans_layout_1 =
-  //   layout_transpose<layout_blas_general<column_major_t>>;
-
-  constexpr bool A_trans =
-    std::is_same_v<layout_type, valid_trans_layout_0>;
-  /* || std::is_same_v<layout_type, valid_trans_layout_1>; */
-  return A_trans;
-}
 
-template<class Accessor>
-constexpr bool extractConjImpl(Accessor a)
-{
-  using elt_t = typename Accessor::element_type;
-
-  using def_acc_t = default_accessor<elt_t>;
-  using conj_def_acc_t = conjugated_accessor<def_acc_t>;
-  if constexpr (std::is_same_v<Accessor, def_acc_t>) {
+  bool A_trans = false, B_trans = false, C_trans = false;
+  int LDA = 0, LDB = 0, LDC = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_matrix_storage(B, B_trans, LDB) ||
+      ! blas_matrix_storage(C, C_trans, LDC)) {
     return false;
-  } else if constexpr (std::is_same_v<Accessor, conj_def_acc_t>) {
-    return true;
-  } else {
+  }
+
+  // C is row major, so the BLAS sees C^T = op(B)^T * op(A)^T.
+  const char TRANSA = blas_trans_char(A_trans != C_trans, A_traits::conj);
+  const char TRANSB = blas_trans_char(B_trans != C_trans, B_traits::conj);
+  if (TRANSA == '\0' || TRANSB == '\0') {
     return false;
   }
-}
 
-template<class in_matrix_t>
-constexpr bool extractConj(in_matrix_t A)
-{
-  return extractConjImpl(A.accessor());
+  // We assume here that any extracted scaling factor would commute
+  // with the matrix-matrix multiply.  That's a valid assumption for
+  // any element_type that the BLAS library knows how to handle.
+  const scalar_type alpha =
+    A_traits::scaling_factor(A.accessor()) *
+    B_traits::scaling_factor(B.accessor());
+  const scalar_type beta = get_beta();
+
+  if (! C_trans) {
+    BlasRoutines<scalar_type>::gemm(TRANSA, TRANSB, int(M), int(N), int(K),
+                                    alpha, A.data_handle(), LDA,
+                                    B.data_handle(), LDB,
+                                    beta, C.data_handle(), LDC);
+  }
+  else {
+    BlasRoutines<scalar_type>::gemm(TRANSB, TRANSA, int(N), int(M), int(K),
+                                    alpha, B.data_handle(), LDB,
+                                    A.data_handle(), LDA,
+                                    beta, C.data_handle(), LDC);
+  }
+  return true;
 }
 
+} // end namespace impl
 #endif // LINALG_ENABLE_BLAS
-#endif // 0
 
 template <class Exec, class A_t, class B_t, class C_t, class = void>
 struct is_custom_matrix_product_avail : std::false_type {};
@@ -670,61 +447,42 @@ void matrix_product(
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
 {
-// FIXME (mfh 2022/06/17) Temporarily disable calling the BLAS,
-// to get PR testing workflow running with mdspan tag.
-#if 0
+  if constexpr (impl::static_matrix_product_eligible<decltype(A), decltype(B), decltype(C)>()) {
+    impl::static_matrix_product(A, B, C,
+      [] (std::size_t, std::size_t) { return ElementType_C{}; });
+    return;
+  }
+
 #ifdef LINALG_ENABLE_BLAS
-  using in_matrix_1_t = typename mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A>;
-  using in_matrix_2_t = typename mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B>;
-  using out_matrix_t = typename mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C>;
-
-  constexpr bool blas_able =
-    matrix_product_dispatch_to_blas<in_matrix_1_t, in_matrix_2_t, out_matrix_t>();
-  if constexpr (blas_able) {
-    // Classic BLAS assumes that all matrices' element_type are the
-    // same.  Mixed-precision (X) BLAS would let us generalize.
-    using element_type = typename out_matrix_t::element_type;
-
-    constexpr bool A_trans = extractTrans<in_matrix_1_t>();
-    const bool A_conj = extractConj(A);
-    const char TRANSA = A_trans ? (A_conj ? 'C' : 'T') : 'N';
-
-    constexpr bool B_trans = extractTrans<in_matrix_2_t>();
-    const bool B_conj = extractConj(B);
-    const char TRANSB = B_trans ? (B_conj ? 'C' : 'T') : 'N';
-
-    const int M = C.extent(0);
-    const int N = C.extent(1);
-    const int K = A.extent(1);
-
-    // We assume here that any extracted scaling factor would commute
-    // with the matrix-matrix multiply.  That's a valid assumption for
-    // any element_type that the BLAS library knows how to handle.
-    const element_type alpha_A = extractScalingFactor(A, 1.0);
-    const element_type alpha_B = extractScalingFactor(B, 1.0);
-    const element_type alpha = alpha_A * alpha_B;
-    const element_type beta {};
-
-    static_assert(A.is_strided() && B.is_strided() && C.is_strided());
-    const int LDA = A_trans ? A.stride(0) : A.stride(1);
-    const int LDB = B_trans ? B.stride(0) : B.stride(1);
-    const int LDC = C.stride(1) == 0 ? 1 : int(C.stride(1));
-    BlasGemm<element_type>::gemm(&TRANSA, &TRANSB, M, N, K,
-                                 alpha, A.data_handle(), LDA,
-                                 B.data_handle(), LDB,
-                                 beta, C.data_handle(), LDC);
+  if constexpr (impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::matrix_product_via_blas(A, B, C, [] { return ElementType_C{}; })) {
+      return;
+    }
   }
-  else
 #endif // LINALG_ENABLE_BLAS
-#endif // 0
   {
     using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
 
+    if constexpr (impl::packed_gemm_eligible<decltype(A), decltype(B), decltype(C)>()) {
+      if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(1), A.extent(1))) {
+        impl::packed_gemm(A, B, C, /* accumulate = */ false);
+        return;
+      }
+    }
+    else if constexpr (impl::mixed_precision_gemm_eligible<decltype(A), decltype(B), decltype(C)>()) {
+      // Mixed precision takes the engine whatever the size, so that
+      // it always sums in the accumulation type.
+      impl::packed_gemm(A, B, C, /* accumulate = */ false);
+      return;
+    }
+
+    const auto A_elements = impl::decompose_accessor(A);
+    const auto B_elements = impl::decompose_accessor(B);
     for (size_type i = 0; i < C.extent(0); ++i) {
       for (size_type j = 0; j < C.extent(1); ++j) {
         C(i,j) = ElementType_C{};
         for (size_type k = 0; k < A.extent(1); ++k) {
-          C(i,j) += A(i,k) * B(k,j);
+          C(i,j) += A_elements(i,k) * B_elements(k,j);
         }
       }
     }
@@ -809,11 +567,51 @@ void matrix_product(
 {
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_E, SizeType_C>;
 
+  if constexpr (impl::static_matrix_product_eligible<decltype(A), decltype(B), decltype(C)>() &&
+                impl::small_static_extents_v<typename decltype(E)::extents_type>()) {
+    impl::static_matrix_product(A, B, C,
+      [&] (std::size_t i, std::size_t j) { return ElementType_C(E(i,j)); });
+    return;
+  }
+
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::matrix_product_dispatch_to_blas<decltype(A), decltype(B), decltype(C)>()) {
+    // If E is C, possibly scaled, then its scaling factor is beta.
+    if (impl::matrix_product_via_blas(A, B, C, [&] { return impl::blas_update_beta(E, C); })) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::packed_gemm_eligible<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(1), A.extent(1))) {
+      // E may alias C, so copy it in first and then accumulate.
+      for (size_type j = 0; j < C.extent(1); ++j) {
+        for (size_type i = 0; i < C.extent(0); ++i) {
+          C(i,j) = E(i,j);
+        }
+      }
+      impl::packed_gemm(A, B, C, /* accumulate = */ true);
+      return;
+    }
+  }
+  else if constexpr (impl::mixed_precision_gemm_eligible<decltype(A), decltype(B), decltype(C)>()) {
+    for (size_type j = 0; j < C.extent(1); ++j) {
+      for (size_type i = 0; i < C.extent(0); ++i) {
+        C(i,j) = E(i,j);
+      }
+    }
+    impl::packed_gemm(A, B, C, /* accumulate = */ true);
+    return;
+  }
+
+  const auto A_elements = impl::decompose_accessor(A);
+  const auto B_elements = impl::decompose_accessor(B);
   for (size_type i = 0; i < C.extent(0); ++i) {
     for (size_type j = 0; j < C.extent(1); ++j) {
       C(i,j) = E(i,j);
       for (size_type k = 0; k < A.extent(1); ++k) {
-        C(i,j) += A(i,k) * B(k,j);
+        C(i,j) += A_elements(i,k) * B_elements(k,j);
       }
     }
   }
@@ -2117,7 +1915,10 @@ struct is_custom_matrix_product_avail<
           std::declval<B_t>(),
           std::declval<C_t>()))
       >
-    && ! std::is_same_v< // see #218
+    // The #218 check rejects every policy whose overload is found only
+    // by ADL, as parallel_exec_t's are.  parallel_exec_t itself maps
+    // to inline_exec_t, so its overloads cannot recurse.
+    && (impl::is_parallel_exec_v<Exec> || ! std::is_same_v< // see #218
       decltype(
         :: MDSPAN_IMPL_STANDARD_NAMESPACE :: MDSPAN_IMPL_PROPOSED_NAMESPACE :: linalg::matrix_product(
           std::declval<Exec>(),
@@ -2130,7 +1931,7 @@ struct is_custom_matrix_product_avail<
           std::declval<A_t>(),
           std::declval<B_t>(),
           std::declval<C_t>()))
-      >
+      >)
     && ! impl::is_inline_exec_v<Exec>
     >
   >
@@ -43,6 +43,9 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_MATRIX_RANK_2K_UPDATE_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_MATRIX_RANK_2K_UPDATE_HPP_
 
+#include <cstddef>
+#include <type_traits>
+
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
@@ -90,6 +93,165 @@ struct is_custom_herm_mat_rank_2k_update_avail<
 
 } // end anonym namespace
 
+namespace impl {
+
+// A*B^T + B*A^T is the single product [A B] * [B A]^T with inner
+// dimension 2k.  The two operands below present [A B] and [B A]^T to
+// the packed GEMM engine, which packs each panel of A and B once,
+// and accumulates both terms in the same register tile of C.  For
+// real value types, B^H is B^T, so this serves the Hermitian updates
+// too.
+
+template<class in_matrix_1_t, class in_matrix_2_t>
+struct rank_2k_left_operand {
+  using value_type = typename in_matrix_1_t::value_type;
+
+  // [A B](i, p)
+  value_type operator()(std::size_t i, std::size_t p) const {
+    return p < k ? value_type(A(i, p)) : value_type(B(i, p - k));
+  }
+
+  in_matrix_1_t A;
+  in_matrix_2_t B;
+  std::size_t k;
+};
+
+template<class in_matrix_1_t, class in_matrix_2_t>
+struct rank_2k_right_operand {
+  using value_type = typename in_matrix_1_t::value_type;
+
+  // [B A]^T(p, j)
+  value_type operator()(std::size_t p, std::size_t j) const {
+    return p < k ? value_type(B(j, p)) : value_type(A(j, p - k));
+  }
+
+  in_matrix_1_t A;
+  in_matrix_2_t B;
+  std::size_t k;
+};
+
+template<class in_matrix_1_t, class in_matrix_2_t, class inout_matrix_t>
+constexpr bool fused_rank_2k_update_eligible()
+{
+  return packed_gemm_eligible<in_matrix_1_t, in_matrix_2_t, inout_matrix_t>();
+}
+
+// C := C + A*B^T + B*A^T in C's triangle t.
+template<class in_matrix_1_t, class in_matrix_2_t, class inout_matrix_t, class Triangle>
+void fused_rank_2k_update(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                          const inout_matrix_t& C, Triangle /* t */)
+{
+  using value_type = typename inout_matrix_t::value_type;
+  const std::size_t k = A.extent(1);
+  packed_gemm_triangle_update<Triangle>(
+    rank_2k_left_operand<in_matrix_1_t, in_matrix_2_t>{A, B, k},
+    rank_2k_right_operand<in_matrix_1_t, in_matrix_2_t>{A, B, k},
+    C, value_type(1), 2 * k);
+}
+
+// C(r0:r1, j0:j1) += A(r0:r1, :)*B(j0:j1, :)^T + B(r0:r1, :)*A(j0:j1, :)^T,
+// for the parallel algorithms' blocks of C outside the diagonal.
+template<class in_matrix_1_t, class in_matrix_2_t, class inout_matrix_t>
+void fused_rank_2k_block_update(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                                const inout_matrix_t& C,
+                                std::size_t r0, std::size_t r1,
+                                std::size_t j0, std::size_t j1)
+{
+  using value_type = typename inout_matrix_t::value_type;
+  const std::size_t k = A.extent(1);
+  packed_gemm(rank_2k_left_operand<in_matrix_1_t, in_matrix_2_t>{A, B, k},
+              rank_2k_right_operand<in_matrix_1_t, in_matrix_2_t>{A, B, k},
+              C, value_type(1), /* accumulate = */ true, r0, r1, j0, j1, 0, 2 * k);
+}
+
+} // end namespace impl
+
+#ifdef LINALG_ENABLE_BLAS
+namespace impl {
+
+template<bool Hermitian, class in_matrix_1_t, class in_matrix_2_t, class inout_matrix_t>
+constexpr bool rank_2k_update_dispatch_to_blas()
+{
+  using scalar_type = typename inout_matrix_t::element_type;
+  if constexpr (is_blas_writable_v<inout_matrix_t> &&
+                is_blas_readable_v<scalar_type, in_matrix_1_t> &&
+                is_blas_readable_v<scalar_type, in_matrix_2_t>) {
+    return Hermitian ||
+      (! blas_traits_t<scalar_type, in_matrix_1_t>::conj &&
+       ! blas_traits_t<scalar_type, in_matrix_2_t>::conj);
+  } else {
+    return false;
+  }
+}
+
+// Computes C = C + A*B^T + B*A^T (or A*B^H + B*A^H, if Hermitian) in
+// C's triangle t with a single ?syr2k (or ?her2k) call.  Returns
+// false without touching C if A, B and C don't fit the BLAS.
+template<bool Hermitian, class in_matrix_1_t, class in_matrix_2_t,
+         class inout_matrix_t, class Triangle>
+bool rank_2k_update_via_blas(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                             const inout_matrix_t& C, Triangle /* t */)
+{
+  using scalar_type = typename inout_matrix_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_1_t>;
+  using B_traits = blas_traits_t<scalar_type, in_matrix_2_t>;
+
+  const auto N = C.extent(0);
+  const auto K = A.extent(1);
+  constexpr blas_routine routine = Hermitian ? blas_routine::her2k : blas_routine::syr2k;
+  if (N == 0 || K == 0 || ! blas_fits_int(N) || ! blas_fits_int(K) ||
+      ! blas_available<scalar_type>(routine)) {
+    return false;
+  }
+
+  bool A_trans = false, B_trans = false, C_trans = false;
+  int LDA = 0, LDB = 0, LDC = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_matrix_storage(B, B_trans, LDB) ||
+      ! blas_matrix_storage(C, C_trans, LDC) ||
+      A_trans != B_trans) {
+    return false;
+  }
+  // Updating the lower triangle of C is updating the upper
+  // triangle of C^T.
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  const char UPLO = blas_uplo_char(lower != C_trans);
+  const scalar_type A_scaling_factor = A_traits::scaling_factor(A.accessor());
+  const scalar_type B_scaling_factor = B_traits::scaling_factor(B.accessor());
+
+  if constexpr (Hermitian && is_complex_v<scalar_type>) {
+    using real_type = typename BlasRoutines<scalar_type>::real_type;
+    // (a A)(b B)^H + (b B)(a A)^H = alpha A B^H + conj(alpha) B A^H
+    // with alpha = a conj(b), which is ?her2k's form.  As for ?herk,
+    // C^T sees everything conjugated, and the transposed form needs
+    // A = conj(S_A)^T and B = conj(S_B)^T.
+    const bool A_conj = A_traits::conj != C_trans;
+    const bool B_conj = B_traits::conj != C_trans;
+    if (A_trans != A_conj || B_trans != B_conj) {
+      return false;
+    }
+    scalar_type alpha = A_scaling_factor * std::conj(B_scaling_factor);
+    if (C_trans) {
+      alpha = std::conj(alpha);
+    }
+    BlasRoutines<scalar_type>::her2k(UPLO, A_trans ? 'C' : 'N', int(N), int(K),
+                                     alpha, A.data_handle(), LDA,
+                                     B.data_handle(), LDB,
+                                     real_type(1), C.data_handle(), LDC);
+  }
+  else {
+    BlasRoutines<scalar_type>::syr2k(UPLO, A_trans ? 'T' : 'N', int(N), int(K),
+                                     A_scaling_factor * B_scaling_factor,
+                                     A.data_handle(), LDA,
+                                     B.data_handle(), LDB,
+                                     scalar_type(1), C.data_handle(), LDC);
+  }
+  return true;
+}
+
+} // end namespace impl
+#endif // LINALG_ENABLE_BLAS
+
 // Rank-2k update of a symmetric matrix
 
 template<class ElementType_A,
@@ -110,8 +272,23 @@ void symmetric_matrix_rank_2k_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
-  Triangle /* t */)
+  Triangle t)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::rank_2k_update_dispatch_to_blas<false, decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::rank_2k_update_via_blas<false>(A, B, C, t)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::fused_rank_2k_update_eligible<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(0), 2 * A.extent(1))) {
+      impl::fused_rank_2k_update(A, B, C, t);
+      return;
+    }
+  }
+
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
@@ -203,8 +380,23 @@ void hermitian_matrix_rank_2k_update(
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_B, extents<SizeType_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
-  Triangle /* t */)
+  Triangle t)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::rank_2k_update_dispatch_to_blas<true, decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::rank_2k_update_via_blas<true>(A, B, C, t)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::fused_rank_2k_update_eligible<decltype(A), decltype(B), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(0), 2 * A.extent(1))) {
+      impl::fused_rank_2k_update(A, B, C, t);
+      return;
+    }
+  }
+
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
   using size_type = ::std::common_type_t<SizeType_A, SizeType_B, SizeType_C>;
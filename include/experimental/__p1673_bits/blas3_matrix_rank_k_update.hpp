@@ -43,6 +43,9 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_MATRIX_RANK_K_UPDATE_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_MATRIX_RANK_K_UPDATE_HPP_
 
+#include <cstddef>
+#include <type_traits>
+
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
@@ -122,6 +125,108 @@ struct is_custom_herm_mat_rank_k_update_avail<
 
 } //end anonym namespace
 
+namespace impl {
+
+// Tiled rank-k update C := C + alpha * A * A^T in C's triangle t,
+// through the packed GEMM engine.  For real value types, A^H is A^T,
+// so this serves the Hermitian updates too.
+
+template<class ScaleFactorType, class in_matrix_t, class inout_matrix_t>
+constexpr bool tiled_rank_k_update_eligible()
+{
+  using value_type = typename inout_matrix_t::value_type;
+  return packed_gemm_eligible<in_matrix_t, in_matrix_t, inout_matrix_t>() &&
+    std::is_convertible_v<ScaleFactorType, value_type>;
+}
+
+template<class ScaleFactorType, class in_matrix_t, class inout_matrix_t, class Triangle>
+void tiled_rank_k_update(ScaleFactorType alpha, const in_matrix_t& A,
+                         const inout_matrix_t& C, Triangle /* t */)
+{
+  using value_type = typename inout_matrix_t::value_type;
+  packed_gemm_triangle_update<Triangle>(A, transposed(A), C, value_type(alpha),
+                                        A.extent(1));
+}
+
+} // end namespace impl
+
+#ifdef LINALG_ENABLE_BLAS
+namespace impl {
+
+template<bool Hermitian, class ScaleFactorType, class in_matrix_t, class inout_matrix_t>
+constexpr bool rank_k_update_dispatch_to_blas()
+{
+  // conj(A)*conj(A)^T isn't anything that ?syrk computes.
+  using scalar_type = typename inout_matrix_t::element_type;
+  if constexpr (is_blas_writable_v<inout_matrix_t> &&
+                is_blas_readable_v<scalar_type, in_matrix_t>) {
+    return std::is_convertible_v<ScaleFactorType, scalar_type> &&
+      (Hermitian || ! blas_traits_t<scalar_type, in_matrix_t>::conj);
+  } else {
+    return false;
+  }
+}
+
+// Computes C = C + alpha*A*A^T (or A*A^H, if Hermitian) in C's
+// triangle t with a single ?syrk (or ?herk) call.  Returns false
+// without touching C if A and C don't fit the BLAS.
+template<bool Hermitian, class ScaleFactorType, class in_matrix_t,
+         class inout_matrix_t, class Triangle>
+bool rank_k_update_via_blas(ScaleFactorType alpha, const in_matrix_t& A,
+                            const inout_matrix_t& C, Triangle /* t */)
+{
+  using scalar_type = typename inout_matrix_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_t>;
+
+  const auto N = C.extent(0);
+  const auto K = A.extent(1);
+  constexpr blas_routine routine = Hermitian ? blas_routine::herk : blas_routine::syrk;
+  if (N == 0 || K == 0 || ! blas_fits_int(N) || ! blas_fits_int(K) ||
+      ! blas_available<scalar_type>(routine)) {
+    return false;
+  }
+
+  bool A_trans = false, C_trans = false;
+  int LDA = 0, LDC = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_matrix_storage(C, C_trans, LDC)) {
+    return false;
+  }
+  // Updating the lower triangle of C is updating the upper
+  // triangle of C^T.
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  const char UPLO = blas_uplo_char(lower != C_trans);
+  const scalar_type A_scaling_factor = A_traits::scaling_factor(A.accessor());
+
+  if constexpr (Hermitian && is_complex_v<scalar_type>) {
+    using real_type = typename BlasRoutines<scalar_type>::real_type;
+    // C^T = C + alpha*conj(A)*conj(A)^H, since the update is Hermitian.
+    // ?herk computes S*S^H or S^H*S for stored S; the latter needs
+    // A to be conj(S)^T.
+    const bool A_conj = A_traits::conj != C_trans;
+    if (A_trans != A_conj || ! blas_is_real(scalar_type(alpha))) {
+      return false;
+    }
+    const real_type ALPHA =
+      blas_real_part(scalar_type(alpha)) * std::norm(A_scaling_factor);
+    BlasRoutines<scalar_type>::herk(UPLO, A_trans ? 'C' : 'N', int(N), int(K),
+                                    ALPHA, A.data_handle(), LDA,
+                                    real_type(1), C.data_handle(), LDC);
+  }
+  else {
+    // A row-major A is S^T, and A*A^T = S^T*S.
+    const scalar_type ALPHA =
+      scalar_type(alpha) * A_scaling_factor * A_scaling_factor;
+    BlasRoutines<scalar_type>::syrk(UPLO, A_trans ? 'T' : 'N', int(N), int(K),
+                                    ALPHA, A.data_handle(), LDA,
+                                    scalar_type(1), C.data_handle(), LDC);
+  }
+  return true;
+}
+
+} // end namespace impl
+#endif // LINALG_ENABLE_BLAS
+
 // Rank-k update of a symmetric matrix with scaling factor alpha
 
 MDSPAN_TEMPLATE_REQUIRES(
@@ -145,8 +250,23 @@ void symmetric_matrix_rank_k_update(
   ScaleFactorType alpha,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
-  Triangle /* t */)
+  Triangle t)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::rank_k_update_dispatch_to_blas<false, ScaleFactorType, decltype(A), decltype(C)>()) {
+    if (impl::rank_k_update_via_blas<false>(alpha, A, C, t)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::tiled_rank_k_update_eligible<ScaleFactorType, decltype(A), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(0), A.extent(1))) {
+      impl::tiled_rank_k_update(alpha, A, C, t);
+      return;
+    }
+  }
+
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
   using size_type = std::common_type_t<SizeType_A, SizeType_C>;
@@ -246,8 +366,23 @@ void symmetric_matrix_rank_k_update(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
-  Triangle /* t */)
+  Triangle t)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::rank_k_update_dispatch_to_blas<false, ElementType_C, decltype(A), decltype(C)>()) {
+    if (impl::rank_k_update_via_blas<false>(ElementType_C(1), A, C, t)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::tiled_rank_k_update_eligible<ElementType_C, decltype(A), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(0), A.extent(1))) {
+      impl::tiled_rank_k_update(ElementType_C(1), A, C, t);
+      return;
+    }
+  }
+
   constexpr bool lower_tri =
     std::is_same_v<Triangle, lower_triangle_t>;
   using size_type = std::common_type_t<SizeType_A, SizeType_C>;
@@ -346,8 +481,23 @@ void hermitian_matrix_rank_k_update(
   ScaleFactorType alpha,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
-  Triangle /* t */)
+  Triangle t)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::rank_k_update_dispatch_to_blas<true, ScaleFactorType, decltype(A), decltype(C)>()) {
+    if (impl::rank_k_update_via_blas<true>(alpha, A, C, t)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::tiled_rank_k_update_eligible<ScaleFactorType, decltype(A), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(0), A.extent(1))) {
+      impl::tiled_rank_k_update(alpha, A, C, t);
+      return;
+    }
+  }
+
   using size_type = std::common_type_t<SizeType_A, SizeType_C>;
 
   constexpr bool lower_tri =
@@ -449,8 +599,23 @@ void hermitian_matrix_rank_k_update(
   impl::inline_exec_t&& /* exec */,
   mdspan<ElementType_A, extents<SizeType_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
   mdspan<ElementType_C, extents<SizeType_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C,
-  Triangle /* t */)
+  Triangle t)
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::rank_k_update_dispatch_to_blas<true, ElementType_C, decltype(A), decltype(C)>()) {
+    if (impl::rank_k_update_via_blas<true>(ElementType_C(1), A, C, t)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::tiled_rank_k_update_eligible<ElementType_C, decltype(A), decltype(C)>()) {
+    if (impl::packed_gemm_worthwhile(C.extent(0), C.extent(0), A.extent(1))) {
+      impl::tiled_rank_k_update(ElementType_C(1), A, C, t);
+      return;
+    }
+  }
+
   using size_type = std::common_type_t<SizeType_A, SizeType_C>;
 
   constexpr bool lower_tri =
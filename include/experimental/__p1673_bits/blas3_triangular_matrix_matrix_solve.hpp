@@ -43,6 +43,10 @@
 #ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_TRIANGULAR_MATRIX_MATRIX_SOLVE_HPP_
 #define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS3_TRIANGULAR_MATRIX_MATRIX_SOLVE_HPP_
 
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
@@ -277,6 +281,222 @@ struct is_custom_tri_matrix_matrix_solve_avail<
 
 } // end anonymous namespace
 
+#ifdef LINALG_ENABLE_BLAS
+namespace impl {
+
+template<class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t>
+constexpr bool triangular_matrix_matrix_solve_dispatch_to_blas()
+{
+  // B is copied into X, so B may be anything.
+  using scalar_type = typename out_matrix_t::element_type;
+  return is_blas_writable_v<out_matrix_t> &&
+    is_blas_readable_v<scalar_type, in_matrix_1_t>;
+}
+
+// Solves op(A)*X = B (LeftSide) or X*op(A) = B with a single ?trsm
+// call, after copying B into X.  Returns false without touching X if
+// A or X don't fit the BLAS.
+template<bool LeftSide, class in_matrix_1_t, class Triangle, class DiagonalStorage,
+         class in_matrix_2_t, class out_matrix_t>
+bool triangular_matrix_matrix_solve_via_blas(const in_matrix_1_t& A, Triangle /* t */,
+                                             DiagonalStorage /* d */,
+                                             const in_matrix_2_t& B, const out_matrix_t& X)
+{
+  using scalar_type = typename out_matrix_t::element_type;
+  using A_traits = blas_traits_t<scalar_type, in_matrix_1_t>;
+
+  const auto M = X.extent(0);
+  const auto N = X.extent(1);
+  if (M == 0 || N == 0 || ! blas_fits_int(M) || ! blas_fits_int(N) ||
+      ! blas_available<scalar_type>(blas_routine::trsm)) {
+    return false;
+  }
+
+  bool A_trans = false, X_trans = false;
+  int LDA = 0, LDX = 0;
+  if (! blas_matrix_storage(A, A_trans, LDA) ||
+      ! blas_matrix_storage(X, X_trans, LDX)) {
+    return false;
+  }
+  // If X is row major, the BLAS solves the transposed problem:
+  // A*X = B is X^T*A^T = B^T, and X*A = B is A^T*X^T = B^T.
+  const char TRANSA = blas_trans_char(A_trans != X_trans, A_traits::conj);
+  // ?trsm's alpha scales B, not A.  Besides, with an implicit unit
+  // diagonal, scaling A would only scale its off-diagonal part.
+  if (TRANSA == '\0' || A_traits::scaling_factor(A.accessor()) != scalar_type(1)) {
+    return false;
+  }
+  const char SIDE = LeftSide != X_trans ? 'L' : 'R';
+  // The transpose's lower triangle is the upper triangle.
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  const char UPLO = blas_uplo_char(lower != A_trans);
+  const char DIAG =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t> ? 'N' : 'U';
+
+  blas_copy_in(B, X);
+  BlasRoutines<scalar_type>::trsm(SIDE, UPLO, TRANSA, DIAG,
+                                  X_trans ? int(N) : int(M),
+                                  X_trans ? int(M) : int(N),
+                                  scalar_type(1), A.data_handle(), LDA,
+                                  X.data_handle(), LDX);
+  return true;
+}
+
+} // end namespace impl
+#endif // LINALG_ENABLE_BLAS
+
+namespace impl {
+
+// Recursive triangular solve with many right-hand sides.
+//
+// Splitting A into 2 x 2 blocks turns A*X = B into two half-size
+// solves and one GEMM with the off-diagonal block, which the packed
+// GEMM engine does at Level 3 speed.  The recursion bottoms out in
+// diagonal blocks of at most trsm_block_size rows, which are solved
+// by substitution.  Solving X*A = B is solving A^T*X^T = B^T.
+
+inline constexpr std::size_t trsm_block_size = 64;
+
+template<class in_matrix_t, class out_matrix_t>
+constexpr bool blocked_trsm_eligible()
+{
+  return packed_gemm_eligible<in_matrix_t, out_matrix_t, out_matrix_t>();
+}
+
+// Below one diagonal block there is nothing to split, and a handful
+// of right-hand sides doesn't keep the GEMM micro-kernel busy.
+inline bool blocked_trsm_worthwhile(std::size_t order, std::size_t num_rhs)
+{
+  return order > trsm_block_size && num_rhs >= 4;
+}
+
+// X(r0:r1, :) := A(r0:r1, r0:r1) \ X(r0:r1, :).  The block's triangle
+// is first copied into a dense local buffer, so that the substitution
+// reads contiguous, already converted values whatever A's layout and
+// accessor.  If X's rows are contiguous, whole rows of X are updated
+// at once; otherwise X is solved one column at a time.
+template<bool Lower, bool ExplicitDiagonal, class in_matrix_t, class inout_matrix_t>
+void trsm_left_diagonal_block(const in_matrix_t& A, const inout_matrix_t& X,
+                              std::size_t r0, std::size_t r1)
+{
+  using value_type = typename inout_matrix_t::value_type;
+  const std::size_t nb = r1 - r0;
+  const std::size_t n = X.extent(1);
+
+  // With an implicit unit diagonal, A's diagonal is never accessed.
+  std::vector<value_type> a(nb * nb);
+  for (std::size_t i = 0; i < nb; ++i) {
+    const std::size_t j_begin = Lower ? 0 : (ExplicitDiagonal ? i : i + 1);
+    const std::size_t j_end = Lower ? (ExplicitDiagonal ? i + 1 : i) : nb;
+    for (std::size_t j = j_begin; j < j_end; ++j) {
+      a[i * nb + j] = value_type(A(r0 + i, r0 + j));
+    }
+  }
+
+  bool rows_contiguous = false;
+  if constexpr (inout_matrix_t::is_always_strided()) {
+    rows_contiguous = n > 1 && X.stride(1) == 1;
+  }
+
+  if (rows_contiguous) {
+    for (std::size_t step = 0; step < nb; ++step) {
+      const std::size_t i = Lower ? step : nb - 1 - step;
+      // Rows j_begin, ..., j_end - 1 are already solved.
+      const std::size_t j_begin = Lower ? 0 : i + 1;
+      const std::size_t j_end = Lower ? i : nb;
+      for (std::size_t j = j_begin; j < j_end; ++j) {
+        const value_type a_ij = a[i * nb + j];
+        for (std::size_t c = 0; c < n; ++c) {
+          X(r0 + i, c) -= a_ij * X(r0 + j, c);
+        }
+      }
+      if constexpr (ExplicitDiagonal) {
+        const value_type a_ii = a[i * nb + i];
+        for (std::size_t c = 0; c < n; ++c) {
+          X(r0 + i, c) = X(r0 + i, c) / a_ii;
+        }
+      }
+    }
+    return;
+  }
+
+  for (std::size_t c = 0; c < n; ++c) {
+    for (std::size_t step = 0; step < nb; ++step) {
+      const std::size_t i = Lower ? step : nb - 1 - step;
+      const std::size_t j_begin = Lower ? 0 : i + 1;
+      const std::size_t j_end = Lower ? i : nb;
+      value_type t = X(r0 + i, c);
+      for (std::size_t j = j_begin; j < j_end; ++j) {
+        t -= a[i * nb + j] * X(r0 + j, c);
+      }
+      if constexpr (ExplicitDiagonal) {
+        X(r0 + i, c) = t / a[i * nb + i];
+      }
+      else {
+        X(r0 + i, c) = t;
+      }
+    }
+  }
+}
+
+// X(r0:r1, :) := A(r0:r1, r0:r1) \ X(r0:r1, :), recursively.
+template<bool Lower, bool ExplicitDiagonal, class in_matrix_t, class inout_matrix_t>
+void blocked_trsm_left(const in_matrix_t& A, const inout_matrix_t& X,
+                       std::size_t r0, std::size_t r1)
+{
+  using value_type = typename inout_matrix_t::value_type;
+  if (r1 - r0 <= trsm_block_size) {
+    trsm_left_diagonal_block<Lower, ExplicitDiagonal>(A, X, r0, r1);
+    return;
+  }
+  // Split at a multiple of the block size, so that all diagonal
+  // blocks but the last are full.
+  const std::size_t half = ((r1 - r0) / 2 + trsm_block_size - 1) /
+    trsm_block_size * trsm_block_size;
+  const std::size_t mid = r0 + half;
+  const std::size_t n = X.extent(1);
+  if constexpr (Lower) {
+    // [A11 0; A21 A22]: X1 := A11 \ X1, X2 -= A21*X1, X2 := A22 \ X2
+    blocked_trsm_left<Lower, ExplicitDiagonal>(A, X, r0, mid);
+    packed_gemm(A, X, X, value_type(-1), /* accumulate = */ true,
+                mid, r1, 0, n, r0, mid);
+    blocked_trsm_left<Lower, ExplicitDiagonal>(A, X, mid, r1);
+  }
+  else {
+    // [A11 A12; 0 A22]: X2 := A22 \ X2, X1 -= A12*X2, X1 := A11 \ X1
+    blocked_trsm_left<Lower, ExplicitDiagonal>(A, X, mid, r1);
+    packed_gemm(A, X, X, value_type(-1), /* accumulate = */ true,
+                r0, mid, 0, n, mid, r1);
+    blocked_trsm_left<Lower, ExplicitDiagonal>(A, X, r0, mid);
+  }
+}
+
+template<bool LeftSide, class in_matrix_1_t, class Triangle, class DiagonalStorage,
+         class in_matrix_2_t, class out_matrix_t>
+void blocked_triangular_matrix_matrix_solve(const in_matrix_1_t& A, Triangle /* t */,
+                                            DiagonalStorage /* d */,
+                                            const in_matrix_2_t& B, const out_matrix_t& X)
+{
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+  constexpr bool explicit_diagonal =
+    std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+
+  for (std::size_t j = 0; j < std::size_t(X.extent(1)); ++j) {
+    for (std::size_t i = 0; i < std::size_t(X.extent(0)); ++i) {
+      X(i,j) = B(i,j);
+    }
+  }
+  if constexpr (LeftSide) {
+    blocked_trsm_left<lower, explicit_diagonal>(A, X, 0, A.extent(0));
+  }
+  else {
+    // The transpose's lower triangle is the upper triangle.
+    blocked_trsm_left<! lower, explicit_diagonal>(transposed(A), transposed(X), 0, A.extent(0));
+  }
+}
+
+} // end namespace impl
+
 // triangular_matrix_matrix_left_solve
 
 template<
@@ -289,11 +509,26 @@ template<
 void triangular_matrix_matrix_left_solve(
   impl::inline_exec_t&& /* exec */,
   P1673_MATRIX_PARAMETER( A ),
-  Triangle /* t */,
+  Triangle t,
   DiagonalStorage d,
   P1673_MATRIX_PARAMETER( B ),
   P1673_MATRIX_PARAMETER( X ))
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::triangular_matrix_matrix_solve_dispatch_to_blas<decltype(A), decltype(B), decltype(X)>()) {
+    if (impl::triangular_matrix_matrix_solve_via_blas<true>(A, t, d, B, X)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::blocked_trsm_eligible<decltype(A), decltype(X)>()) {
+    if (impl::blocked_trsm_worthwhile(A.extent(0), X.extent(1))) {
+      impl::blocked_triangular_matrix_matrix_solve<true>(A, t, d, B, X);
+      return;
+    }
+  }
+
   if (std::is_same_v<Triangle, lower_triangle_t>) {
     trsm_lower_triangular_left_side (A, d, B, X);
   }
@@ -359,11 +594,26 @@ template<
 void triangular_matrix_matrix_right_solve(
   impl::inline_exec_t&& /* exec */,
   P1673_MATRIX_PARAMETER( A ),
-  Triangle /* t */,
+  Triangle t,
   DiagonalStorage d,
   P1673_MATRIX_PARAMETER( B ),
   P1673_MATRIX_PARAMETER( X ))
 {
+#ifdef LINALG_ENABLE_BLAS
+  if constexpr (impl::triangular_matrix_matrix_solve_dispatch_to_blas<decltype(A), decltype(B), decltype(X)>()) {
+    if (impl::triangular_matrix_matrix_solve_via_blas<false>(A, t, d, B, X)) {
+      return;
+    }
+  }
+#endif // LINALG_ENABLE_BLAS
+
+  if constexpr (impl::blocked_trsm_eligible<decltype(A), decltype(X)>()) {
+    if (impl::blocked_trsm_worthwhile(A.extent(0), X.extent(0))) {
+      impl::blocked_triangular_matrix_matrix_solve<false>(A, t, d, B, X);
+      return;
+    }
+  }
+
   if (std::is_same_v<Triangle, lower_triangle_t>) {
     trsm_lower_triangular_right_side (A, d, B, X);
   }
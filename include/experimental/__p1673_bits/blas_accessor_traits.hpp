@@ -0,0 +1,218 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_ACCESSOR_TRAITS_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_ACCESSOR_TRAITS_HPP_
+
+#include <complex>
+#include <type_traits>
+
+// How the elements of an object relate to the array behind it, for
+// code that reads that array directly: the BLAS dispatch, the SIMD
+// kernels, and the element loops over scaled and conjugated views.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+template<class T>
+inline constexpr bool is_blas_scalar_v =
+  std::is_same_v<T, double> ||
+  std::is_same_v<T, float> ||
+  std::is_same_v<T, std::complex<double>> ||
+  std::is_same_v<T, std::complex<float>>;
+
+// Peels accessor_scaled and conjugated_accessor layers off Accessor.
+// If default_accessor<Scalar> (or <const Scalar>) is what remains,
+// and every layer's value type is Scalar, then each element of the
+// object is alpha * conj^c(s), where s is the stored element, alpha
+// is scaling_factor(acc), and c is conj.
+template<class Scalar, class Accessor>
+struct blas_accessor_traits {
+  static constexpr bool valid = false;
+  static constexpr bool conj = false;
+};
+
+template<class Scalar, class ElementType>
+struct blas_accessor_traits<Scalar, default_accessor<ElementType>> {
+  static constexpr bool valid =
+    std::is_same_v<std::remove_const_t<ElementType>, Scalar>;
+  static constexpr bool conj = false;
+
+  static Scalar scaling_factor(const default_accessor<ElementType>&) {
+    return Scalar(1);
+  }
+};
+
+template<class Scalar, class ScalingFactor, class NestedAccessor>
+struct blas_accessor_traits<Scalar, accessor_scaled<ScalingFactor, NestedAccessor>> {
+private:
+  using accessor_type = accessor_scaled<ScalingFactor, NestedAccessor>;
+  using nested_traits = blas_accessor_traits<Scalar, NestedAccessor>;
+
+public:
+  static constexpr bool valid = nested_traits::valid &&
+    std::is_convertible_v<ScalingFactor, Scalar> &&
+    std::is_same_v<std::remove_const_t<typename accessor_type::element_type>, Scalar>;
+  static constexpr bool conj = nested_traits::conj;
+
+  static Scalar scaling_factor(const accessor_type& acc) {
+    return Scalar(acc.scaling_factor()) *
+      nested_traits::scaling_factor(acc.nested_accessor());
+  }
+};
+
+template<class Scalar, class NestedAccessor>
+struct blas_accessor_traits<Scalar, conjugated_accessor<NestedAccessor>> {
+private:
+  using accessor_type = conjugated_accessor<NestedAccessor>;
+  using nested_traits = blas_accessor_traits<Scalar, NestedAccessor>;
+
+public:
+  static constexpr bool valid = nested_traits::valid &&
+    std::is_same_v<std::remove_const_t<typename accessor_type::element_type>, Scalar>;
+  // conj(alpha * conj^c(s)) = conj(alpha) * conj^(1-c)(s)
+  static constexpr bool conj = is_complex_v<Scalar> && ! nested_traits::conj;
+
+  static Scalar scaling_factor(const accessor_type& acc) {
+    return conj_if_needed(nested_traits::scaling_factor(acc.nested_accessor()));
+  }
+};
+
+template<class Scalar, class in_object_t>
+using blas_traits_t = blas_accessor_traits<Scalar, typename in_object_t::accessor_type>;
+
+// The BLAS (or the SIMD kernels) can write to out_object_t directly:
+// its elements are BLAS scalars in a strided array with no element
+// stored twice.
+template<class out_object_t>
+inline constexpr bool is_blas_writable_v =
+  is_blas_scalar_v<typename out_object_t::element_type> &&
+  std::is_same_v<typename out_object_t::accessor_type,
+                 default_accessor<typename out_object_t::element_type>> &&
+  out_object_t::is_always_strided() &&
+  out_object_t::is_always_unique();
+
+// An object whose accessor is default_accessor<Scalar> under one or
+// more accessor_scaled and conjugated_accessor layers, taken apart
+// once: x(i...) is alpha * conj^c(data[mapping(i...)]).  Reading
+// elements through it costs a load and a multiply, instead of the
+// proxy references of the scaled and conjugated accessors, so loops
+// over it vectorize.  Loops that can apply alpha once, after a sum,
+// read stored(i...) instead.
+template<class Scalar, class in_object_t>
+struct accessor_decomposition {
+  using traits = blas_traits_t<Scalar, in_object_t>;
+  using mapping_type = typename in_object_t::mapping_type;
+  static constexpr bool conj = traits::conj;
+
+  const Scalar* data;
+  mapping_type mapping;
+  Scalar alpha;
+
+  explicit accessor_decomposition(const in_object_t& x)
+    : data(x.data_handle()), mapping(x.mapping()),
+      alpha(traits::scaling_factor(x.accessor()))
+  {}
+
+  // conj^c of the stored element, without alpha.
+  template<class... Indices>
+  Scalar stored(Indices... i) const
+  {
+    const Scalar& s = data[mapping(i...)];
+    if constexpr (conj) {
+      return conj_if_needed(s);
+    }
+    else {
+      return s;
+    }
+  }
+
+  template<class... Indices>
+  Scalar operator()(Indices... i) const
+  {
+    return alpha * stored(i...);
+  }
+};
+
+// in_object_t is an mdspan that reads its value_type through scaled
+// or conjugated layers that accessor_decomposition can take off.
+// Other objects, such as the operand adaptors of the matrix product
+// engine, are read as they are.
+template<class in_object_t, class = void>
+struct is_decomposable_accessor : std::false_type {};
+
+template<class in_object_t>
+struct is_decomposable_accessor<in_object_t,
+  std::void_t<typename in_object_t::accessor_type, typename in_object_t::mapping_type>>
+  : std::bool_constant<
+      blas_traits_t<typename in_object_t::value_type, in_object_t>::valid &&
+      ! std::is_same_v<typename in_object_t::accessor_type,
+                       default_accessor<typename in_object_t::element_type>>>
+{};
+
+template<class in_object_t>
+inline constexpr bool is_decomposable_accessor_v =
+  is_decomposable_accessor<in_object_t>::value;
+
+// x's elements as a callable x_elements(i...): x's decomposition if
+// it has one, and otherwise x itself.
+template<class in_object_t>
+auto decompose_accessor(const in_object_t& x)
+{
+  if constexpr (is_decomposable_accessor_v<in_object_t>) {
+    return accessor_decomposition<typename in_object_t::value_type, in_object_t>(x);
+  }
+  else {
+    return x;
+  }
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_ACCESSOR_TRAITS_HPP_
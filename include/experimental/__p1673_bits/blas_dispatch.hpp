@@ -0,0 +1,1286 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_DISPATCH_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_DISPATCH_HPP_
+
+#ifdef LINALG_ENABLE_BLAS
+
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+
+// NOTE: I'm only exposing these extern declarations in a header file
+// so that we can keep this a header-only library, for ease of testing
+// and installation.  Exposing them in a real production
+// implementation is really bad form.  This is because users may
+// declare their own extern declarations of BLAS functions, and yours
+// will collide with theirs at build time.
+
+// NOTE: I'm assuming a particular BLAS ABI mangling here.  Typical
+// BLAS C++ wrappers need to account for a variety of manglings that
+// don't necessarily match the system's Fortran compiler (if it has
+// one).  Lowercase with trailing underscore is a common pattern.
+// Watch out for BLAS functions that return something, esp. a complex
+// number.
+
+extern "C" void
+sgemm_ (const char TRANSA[],
+        const char TRANSB[],
+        const int* pM,
+        const int* pN,
+        const int* pK,
+        const float* pALPHA,
+        const float* A,
+        const int* pLDA,
+        const float* B,
+        const int* pLDB,
+        const float* pBETA,
+        float* C,
+        const int* pLDC);
+
+extern "C" void
+dgemm_ (const char TRANSA[],
+        const char TRANSB[],
+        const int* pM,
+        const int* pN,
+        const int* pK,
+        const double* pALPHA,
+        const double* A,
+        const int* pLDA,
+        const double* B,
+        const int* pLDB,
+        const double* pBETA,
+        double* C,
+        const int* pLDC);
+
+extern "C" void
+cgemm_ (const char TRANSA[],
+        const char TRANSB[],
+        const int* pM,
+        const int* pN,
+        const int* pK,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* B,
+        const int* pLDB,
+        const void* pBETA,
+        void* C,
+        const int* pLDC);
+
+extern "C" void
+zgemm_ (const char TRANSA[],
+        const char TRANSB[],
+        const int* pM,
+        const int* pN,
+        const int* pK,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* B,
+        const int* pLDB,
+        const void* pBETA,
+        void* C,
+        const int* pLDC);
+
+extern "C" void
+sgemv_ (const char TRANS[],
+        const int* pM,
+        const int* pN,
+        const float* pALPHA,
+        const float* A,
+        const int* pLDA,
+        const float* X,
+        const int* pINCX,
+        const float* pBETA,
+        float* Y,
+        const int* pINCY);
+
+extern "C" void
+dgemv_ (const char TRANS[],
+        const int* pM,
+        const int* pN,
+        const double* pALPHA,
+        const double* A,
+        const int* pLDA,
+        const double* X,
+        const int* pINCX,
+        const double* pBETA,
+        double* Y,
+        const int* pINCY);
+
+extern "C" void
+cgemv_ (const char TRANS[],
+        const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* X,
+        const int* pINCX,
+        const void* pBETA,
+        void* Y,
+        const int* pINCY);
+
+extern "C" void
+zgemv_ (const char TRANS[],
+        const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* X,
+        const int* pINCX,
+        const void* pBETA,
+        void* Y,
+        const int* pINCY);
+
+extern "C" void
+ssymv_ (const char UPLO[],
+        const int* pN,
+        const float* pALPHA,
+        const float* A,
+        const int* pLDA,
+        const float* X,
+        const int* pINCX,
+        const float* pBETA,
+        float* Y,
+        const int* pINCY);
+
+extern "C" void
+dsymv_ (const char UPLO[],
+        const int* pN,
+        const double* pALPHA,
+        const double* A,
+        const int* pLDA,
+        const double* X,
+        const int* pINCX,
+        const double* pBETA,
+        double* Y,
+        const int* pINCY);
+
+extern "C" void
+chemv_ (const char UPLO[],
+        const int* pN,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* X,
+        const int* pINCX,
+        const void* pBETA,
+        void* Y,
+        const int* pINCY);
+
+extern "C" void
+zhemv_ (const char UPLO[],
+        const int* pN,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* X,
+        const int* pINCX,
+        const void* pBETA,
+        void* Y,
+        const int* pINCY);
+
+extern "C" void
+strsv_ (const char UPLO[],
+        const char TRANS[],
+        const char DIAG[],
+        const int* pN,
+        const float* A,
+        const int* pLDA,
+        float* X,
+        const int* pINCX);
+
+extern "C" void
+dtrsv_ (const char UPLO[],
+        const char TRANS[],
+        const char DIAG[],
+        const int* pN,
+        const double* A,
+        const int* pLDA,
+        double* X,
+        const int* pINCX);
+
+extern "C" void
+ctrsv_ (const char UPLO[],
+        const char TRANS[],
+        const char DIAG[],
+        const int* pN,
+        const void* A,
+        const int* pLDA,
+        void* X,
+        const int* pINCX);
+
+extern "C" void
+ztrsv_ (const char UPLO[],
+        const char TRANS[],
+        const char DIAG[],
+        const int* pN,
+        const void* A,
+        const int* pLDA,
+        void* X,
+        const int* pINCX);
+
+extern "C" void
+sger_ (const int* pM,
+       const int* pN,
+       const float* pALPHA,
+       const float* X,
+       const int* pINCX,
+       const float* Y,
+       const int* pINCY,
+       float* A,
+       const int* pLDA);
+
+extern "C" void
+dger_ (const int* pM,
+       const int* pN,
+       const double* pALPHA,
+       const double* X,
+       const int* pINCX,
+       const double* Y,
+       const int* pINCY,
+       double* A,
+       const int* pLDA);
+
+extern "C" void
+cgeru_ (const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* X,
+        const int* pINCX,
+        const void* Y,
+        const int* pINCY,
+        void* A,
+        const int* pLDA);
+
+extern "C" void
+zgeru_ (const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* X,
+        const int* pINCX,
+        const void* Y,
+        const int* pINCY,
+        void* A,
+        const int* pLDA);
+
+extern "C" void
+cgerc_ (const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* X,
+        const int* pINCX,
+        const void* Y,
+        const int* pINCY,
+        void* A,
+        const int* pLDA);
+
+extern "C" void
+zgerc_ (const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* X,
+        const int* pINCX,
+        const void* Y,
+        const int* pINCY,
+        void* A,
+        const int* pLDA);
+
+extern "C" void
+ssyrk_ (const char UPLO[],
+        const char TRANS[],
+        const int* pN,
+        const int* pK,
+        const float* pALPHA,
+        const float* A,
+        const int* pLDA,
+        const float* pBETA,
+        float* C,
+        const int* pLDC);
+
+extern "C" void
+dsyrk_ (const char UPLO[],
+        const char TRANS[],
+        const int* pN,
+        const int* pK,
+        const double* pALPHA,
+        const double* A,
+        const int* pLDA,
+        const double* pBETA,
+        double* C,
+        const int* pLDC);
+
+extern "C" void
+csyrk_ (const char UPLO[],
+        const char TRANS[],
+        const int* pN,
+        const int* pK,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* pBETA,
+        void* C,
+        const int* pLDC);
+
+extern "C" void
+zsyrk_ (const char UPLO[],
+        const char TRANS[],
+        const int* pN,
+        const int* pK,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const void* pBETA,
+        void* C,
+        const int* pLDC);
+
+extern "C" void
+cherk_ (const char UPLO[],
+        const char TRANS[],
+        const int* pN,
+        const int* pK,
+        const float* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const float* pBETA,
+        void* C,
+        const int* pLDC);
+
+extern "C" void
+zherk_ (const char UPLO[],
+        const char TRANS[],
+        const int* pN,
+        const int* pK,
+        const double* pALPHA,
+        const void* A,
+        const int* pLDA,
+        const double* pBETA,
+        void* C,
+        const int* pLDC);
+
+extern "C" void
+ssyr2k_ (const char UPLO[],
+         const char TRANS[],
+         const int* pN,
+         const int* pK,
+         const float* pALPHA,
+         const float* A,
+         const int* pLDA,
+         const float* B,
+         const int* pLDB,
+         const float* pBETA,
+         float* C,
+         const int* pLDC);
+
+extern "C" void
+dsyr2k_ (const char UPLO[],
+         const char TRANS[],
+         const int* pN,
+         const int* pK,
+         const double* pALPHA,
+         const double* A,
+         const int* pLDA,
+         const double* B,
+         const int* pLDB,
+         const double* pBETA,
+         double* C,
+         const int* pLDC);
+
+extern "C" void
+csyr2k_ (const char UPLO[],
+         const char TRANS[],
+         const int* pN,
+         const int* pK,
+         const void* pALPHA,
+         const void* A,
+         const int* pLDA,
+         const void* B,
+         const int* pLDB,
+         const void* pBETA,
+         void* C,
+         const int* pLDC);
+
+extern "C" void
+zsyr2k_ (const char UPLO[],
+         const char TRANS[],
+         const int* pN,
+         const int* pK,
+         const void* pALPHA,
+         const void* A,
+         const int* pLDA,
+         const void* B,
+         const int* pLDB,
+         const void* pBETA,
+         void* C,
+         const int* pLDC);
+
+extern "C" void
+cher2k_ (const char UPLO[],
+         const char TRANS[],
+         const int* pN,
+         const int* pK,
+         const void* pALPHA,
+         const void* A,
+         const int* pLDA,
+         const void* B,
+         const int* pLDB,
+         const float* pBETA,
+         void* C,
+         const int* pLDC);
+
+extern "C" void
+zher2k_ (const char UPLO[],
+         const char TRANS[],
+         const int* pN,
+         const int* pK,
+         const void* pALPHA,
+         const void* A,
+         const int* pLDA,
+         const void* B,
+         const int* pLDB,
+         const double* pBETA,
+         void* C,
+         const int* pLDC);
+
+extern "C" void
+strsm_ (const char SIDE[],
+        const char UPLO[],
+        const char TRANSA[],
+        const char DIAG[],
+        const int* pM,
+        const int* pN,
+        const float* pALPHA,
+        const float* A,
+        const int* pLDA,
+        float* B,
+        const int* pLDB);
+
+extern "C" void
+dtrsm_ (const char SIDE[],
+        const char UPLO[],
+        const char TRANSA[],
+        const char DIAG[],
+        const int* pM,
+        const int* pN,
+        const double* pALPHA,
+        const double* A,
+        const int* pLDA,
+        double* B,
+        const int* pLDB);
+
+extern "C" void
+ctrsm_ (const char SIDE[],
+        const char UPLO[],
+        const char TRANSA[],
+        const char DIAG[],
+        const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        void* B,
+        const int* pLDB);
+
+extern "C" void
+ztrsm_ (const char SIDE[],
+        const char UPLO[],
+        const char TRANSA[],
+        const char DIAG[],
+        const int* pM,
+        const int* pN,
+        const void* pALPHA,
+        const void* A,
+        const int* pLDA,
+        void* B,
+        const int* pLDB);
+
+// Type-generic wrappers for the above.  For real Scalar, the
+// Hermitian and conjugated routines forward to their symmetric and
+// unconjugated counterparts, so callers need not distinguish.
+// BlasRoutines calls the BLAS through LINALG_BLAS_FUNCTION: directly,
+// or with LINALG_ENABLE_BLAS_RUNTIME, through whatever blas_runtime
+// loaded.  Check blas_available before calling BlasRoutines.
+#ifdef LINALG_ENABLE_BLAS_RUNTIME
+#  define LINALG_BLAS_FUNCTION(Scalar, routine, symbol) \
+  (*impl::blas_runtime_function<decltype(symbol), Scalar>(impl::blas_routine::routine))
+#else
+#  define LINALG_BLAS_FUNCTION(Scalar, routine, symbol) symbol
+#endif
+
+template<class Scalar>
+struct BlasRoutines {};
+
+template<>
+struct BlasRoutines<float> {
+  using real_type = float;
+
+  static void
+  gemm (const char TRANSA, const char TRANSB,
+        const int M, const int N, const int K,
+        const float ALPHA,
+        const float* A, const int LDA,
+        const float* B, const int LDB,
+        const float BETA,
+        float* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(float, gemm, sgemm_)
+      (&TRANSA, &TRANSB, &M, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const float ALPHA,
+        const float* A, const int LDA,
+        const float* X, const int INCX,
+        const float BETA,
+        float* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(float, gemv, sgemv_) (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  static void
+  symv (const char UPLO, const int N,
+        const float ALPHA,
+        const float* A, const int LDA,
+        const float* X, const int INCX,
+        const float BETA,
+        float* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(float, symv, ssymv_) (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  // A real symmetric matrix is Hermitian.
+  static void
+  hemv (const char UPLO, const int N,
+        const float ALPHA,
+        const float* A, const int LDA,
+        const float* X, const int INCX,
+        const float BETA,
+        float* Y, const int INCY)
+  {
+    symv (UPLO, N, ALPHA, A, LDA, X, INCX, BETA, Y, INCY);
+  }
+
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG,
+        const int N,
+        const float* A, const int LDA,
+        float* X, const int INCX)
+  {
+    LINALG_BLAS_FUNCTION(float, trsv, strsv_) (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+
+  static void
+  ger (const int M, const int N,
+        const float ALPHA,
+        const float* X, const int INCX,
+        const float* Y, const int INCY,
+        float* A, const int LDA)
+  {
+    LINALG_BLAS_FUNCTION(float, ger, sger_) (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+
+  // Conjugation does nothing for real numbers.
+  static void
+  geru (const int M, const int N,
+        const float ALPHA,
+        const float* X, const int INCX,
+        const float* Y, const int INCY,
+        float* A, const int LDA)
+  {
+    ger (M, N, ALPHA, X, INCX, Y, INCY, A, LDA);
+  }
+
+  static void
+  gerc (const int M, const int N,
+        const float ALPHA,
+        const float* X, const int INCX,
+        const float* Y, const int INCY,
+        float* A, const int LDA)
+  {
+    ger (M, N, ALPHA, X, INCX, Y, INCY, A, LDA);
+  }
+
+  static void
+  syrk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const float ALPHA,
+        const float* A, const int LDA,
+        const float BETA,
+        float* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(float, syrk, ssyrk_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, &BETA, C, &LDC);
+  }
+
+  static void
+  herk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const real_type ALPHA,
+        const float* A, const int LDA,
+        const real_type BETA,
+        float* C, const int LDC)
+  {
+    syrk (UPLO, TRANS, N, K, ALPHA, A, LDA, BETA, C, LDC);
+  }
+
+  static void
+  syr2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const float ALPHA,
+         const float* A, const int LDA,
+         const float* B, const int LDB,
+         const float BETA,
+         float* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(float, syr2k, ssyr2k_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  her2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const float ALPHA,
+         const float* A, const int LDA,
+         const float* B, const int LDB,
+         const real_type BETA,
+         float* C, const int LDC)
+  {
+    syr2k (UPLO, TRANS, N, K, ALPHA, A, LDA, B, LDB, BETA, C, LDC);
+  }
+
+  static void
+  trsm (const char SIDE, const char UPLO, const char TRANSA, const char DIAG,
+        const int M, const int N,
+        const float ALPHA,
+        const float* A, const int LDA,
+        float* B, const int LDB)
+  {
+    LINALG_BLAS_FUNCTION(float, trsm, strsm_) (&SIDE, &UPLO, &TRANSA, &DIAG, &M, &N, &ALPHA, A, &LDA, B, &LDB);
+  }
+};
+
+template<>
+struct BlasRoutines<double> {
+  using real_type = double;
+
+  static void
+  gemm (const char TRANSA, const char TRANSB,
+        const int M, const int N, const int K,
+        const double ALPHA,
+        const double* A, const int LDA,
+        const double* B, const int LDB,
+        const double BETA,
+        double* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(double, gemm, dgemm_)
+      (&TRANSA, &TRANSB, &M, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const double ALPHA,
+        const double* A, const int LDA,
+        const double* X, const int INCX,
+        const double BETA,
+        double* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(double, gemv, dgemv_) (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  static void
+  symv (const char UPLO, const int N,
+        const double ALPHA,
+        const double* A, const int LDA,
+        const double* X, const int INCX,
+        const double BETA,
+        double* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(double, symv, dsymv_) (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  // A real symmetric matrix is Hermitian.
+  static void
+  hemv (const char UPLO, const int N,
+        const double ALPHA,
+        const double* A, const int LDA,
+        const double* X, const int INCX,
+        const double BETA,
+        double* Y, const int INCY)
+  {
+    symv (UPLO, N, ALPHA, A, LDA, X, INCX, BETA, Y, INCY);
+  }
+
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG,
+        const int N,
+        const double* A, const int LDA,
+        double* X, const int INCX)
+  {
+    LINALG_BLAS_FUNCTION(double, trsv, dtrsv_) (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+
+  static void
+  ger (const int M, const int N,
+        const double ALPHA,
+        const double* X, const int INCX,
+        const double* Y, const int INCY,
+        double* A, const int LDA)
+  {
+    LINALG_BLAS_FUNCTION(double, ger, dger_) (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+
+  // Conjugation does nothing for real numbers.
+  static void
+  geru (const int M, const int N,
+        const double ALPHA,
+        const double* X, const int INCX,
+        const double* Y, const int INCY,
+        double* A, const int LDA)
+  {
+    ger (M, N, ALPHA, X, INCX, Y, INCY, A, LDA);
+  }
+
+  static void
+  gerc (const int M, const int N,
+        const double ALPHA,
+        const double* X, const int INCX,
+        const double* Y, const int INCY,
+        double* A, const int LDA)
+  {
+    ger (M, N, ALPHA, X, INCX, Y, INCY, A, LDA);
+  }
+
+  static void
+  syrk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const double ALPHA,
+        const double* A, const int LDA,
+        const double BETA,
+        double* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(double, syrk, dsyrk_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, &BETA, C, &LDC);
+  }
+
+  static void
+  herk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const real_type ALPHA,
+        const double* A, const int LDA,
+        const real_type BETA,
+        double* C, const int LDC)
+  {
+    syrk (UPLO, TRANS, N, K, ALPHA, A, LDA, BETA, C, LDC);
+  }
+
+  static void
+  syr2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const double ALPHA,
+         const double* A, const int LDA,
+         const double* B, const int LDB,
+         const double BETA,
+         double* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(double, syr2k, dsyr2k_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  her2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const double ALPHA,
+         const double* A, const int LDA,
+         const double* B, const int LDB,
+         const real_type BETA,
+         double* C, const int LDC)
+  {
+    syr2k (UPLO, TRANS, N, K, ALPHA, A, LDA, B, LDB, BETA, C, LDC);
+  }
+
+  static void
+  trsm (const char SIDE, const char UPLO, const char TRANSA, const char DIAG,
+        const int M, const int N,
+        const double ALPHA,
+        const double* A, const int LDA,
+        double* B, const int LDB)
+  {
+    LINALG_BLAS_FUNCTION(double, trsm, dtrsm_) (&SIDE, &UPLO, &TRANSA, &DIAG, &M, &N, &ALPHA, A, &LDA, B, &LDB);
+  }
+};
+
+template<>
+struct BlasRoutines<std::complex<float>> {
+  using real_type = float;
+
+  static void
+  gemm (const char TRANSA, const char TRANSB,
+        const int M, const int N, const int K,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* A, const int LDA,
+        const std::complex<float>* B, const int LDB,
+        const std::complex<float> BETA,
+        std::complex<float>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, gemm, cgemm_)
+      (&TRANSA, &TRANSB, &M, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* A, const int LDA,
+        const std::complex<float>* X, const int INCX,
+        const std::complex<float> BETA,
+        std::complex<float>* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, gemv, cgemv_) (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  static void
+  hemv (const char UPLO, const int N,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* A, const int LDA,
+        const std::complex<float>* X, const int INCX,
+        const std::complex<float> BETA,
+        std::complex<float>* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, hemv, chemv_) (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG,
+        const int N,
+        const std::complex<float>* A, const int LDA,
+        std::complex<float>* X, const int INCX)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, trsv, ctrsv_) (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+
+  static void
+  geru (const int M, const int N,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* X, const int INCX,
+        const std::complex<float>* Y, const int INCY,
+        std::complex<float>* A, const int LDA)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, geru, cgeru_) (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+
+  static void
+  gerc (const int M, const int N,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* X, const int INCX,
+        const std::complex<float>* Y, const int INCY,
+        std::complex<float>* A, const int LDA)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, gerc, cgerc_) (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+
+  static void
+  syrk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* A, const int LDA,
+        const std::complex<float> BETA,
+        std::complex<float>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, syrk, csyrk_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, &BETA, C, &LDC);
+  }
+
+  static void
+  herk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const real_type ALPHA,
+        const std::complex<float>* A, const int LDA,
+        const real_type BETA,
+        std::complex<float>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, herk, cherk_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, &BETA, C, &LDC);
+  }
+
+  static void
+  syr2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const std::complex<float> ALPHA,
+         const std::complex<float>* A, const int LDA,
+         const std::complex<float>* B, const int LDB,
+         const std::complex<float> BETA,
+         std::complex<float>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, syr2k, csyr2k_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  her2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const std::complex<float> ALPHA,
+         const std::complex<float>* A, const int LDA,
+         const std::complex<float>* B, const int LDB,
+         const real_type BETA,
+         std::complex<float>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, her2k, cher2k_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  trsm (const char SIDE, const char UPLO, const char TRANSA, const char DIAG,
+        const int M, const int N,
+        const std::complex<float> ALPHA,
+        const std::complex<float>* A, const int LDA,
+        std::complex<float>* B, const int LDB)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<float>, trsm, ctrsm_) (&SIDE, &UPLO, &TRANSA, &DIAG, &M, &N, &ALPHA, A, &LDA, B, &LDB);
+  }
+};
+
+template<>
+struct BlasRoutines<std::complex<double>> {
+  using real_type = double;
+
+  static void
+  gemm (const char TRANSA, const char TRANSB,
+        const int M, const int N, const int K,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* A, const int LDA,
+        const std::complex<double>* B, const int LDB,
+        const std::complex<double> BETA,
+        std::complex<double>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, gemm, zgemm_)
+      (&TRANSA, &TRANSB, &M, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  gemv (const char TRANS, const int M, const int N,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* A, const int LDA,
+        const std::complex<double>* X, const int INCX,
+        const std::complex<double> BETA,
+        std::complex<double>* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, gemv, zgemv_) (&TRANS, &M, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  static void
+  hemv (const char UPLO, const int N,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* A, const int LDA,
+        const std::complex<double>* X, const int INCX,
+        const std::complex<double> BETA,
+        std::complex<double>* Y, const int INCY)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, hemv, zhemv_) (&UPLO, &N, &ALPHA, A, &LDA, X, &INCX, &BETA, Y, &INCY);
+  }
+
+  static void
+  trsv (const char UPLO, const char TRANS, const char DIAG,
+        const int N,
+        const std::complex<double>* A, const int LDA,
+        std::complex<double>* X, const int INCX)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, trsv, ztrsv_) (&UPLO, &TRANS, &DIAG, &N, A, &LDA, X, &INCX);
+  }
+
+  static void
+  geru (const int M, const int N,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* X, const int INCX,
+        const std::complex<double>* Y, const int INCY,
+        std::complex<double>* A, const int LDA)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, geru, zgeru_) (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+
+  static void
+  gerc (const int M, const int N,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* X, const int INCX,
+        const std::complex<double>* Y, const int INCY,
+        std::complex<double>* A, const int LDA)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, gerc, zgerc_) (&M, &N, &ALPHA, X, &INCX, Y, &INCY, A, &LDA);
+  }
+
+  static void
+  syrk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* A, const int LDA,
+        const std::complex<double> BETA,
+        std::complex<double>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, syrk, zsyrk_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, &BETA, C, &LDC);
+  }
+
+  static void
+  herk (const char UPLO, const char TRANS,
+        const int N, const int K,
+        const real_type ALPHA,
+        const std::complex<double>* A, const int LDA,
+        const real_type BETA,
+        std::complex<double>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, herk, zherk_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, &BETA, C, &LDC);
+  }
+
+  static void
+  syr2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const std::complex<double> ALPHA,
+         const std::complex<double>* A, const int LDA,
+         const std::complex<double>* B, const int LDB,
+         const std::complex<double> BETA,
+         std::complex<double>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, syr2k, zsyr2k_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  her2k (const char UPLO, const char TRANS,
+         const int N, const int K,
+         const std::complex<double> ALPHA,
+         const std::complex<double>* A, const int LDA,
+         const std::complex<double>* B, const int LDB,
+         const real_type BETA,
+         std::complex<double>* C, const int LDC)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, her2k, zher2k_) (&UPLO, &TRANS, &N, &K, &ALPHA, A, &LDA, B, &LDB, &BETA, C, &LDC);
+  }
+
+  static void
+  trsm (const char SIDE, const char UPLO, const char TRANSA, const char DIAG,
+        const int M, const int N,
+        const std::complex<double> ALPHA,
+        const std::complex<double>* A, const int LDA,
+        std::complex<double>* B, const int LDB)
+  {
+    LINALG_BLAS_FUNCTION(std::complex<double>, trsm, ztrsm_) (&SIDE, &UPLO, &TRANSA, &DIAG, &M, &N, &ALPHA, A, &LDA, B, &LDB);
+  }
+};
+
+namespace impl {
+
+// The BLAS can read in_object_t directly, possibly with a scaling
+// factor and conjugation.
+template<class Scalar, class in_object_t>
+inline constexpr bool is_blas_readable_v =
+  is_blas_scalar_v<Scalar> &&
+  blas_traits_t<Scalar, in_object_t>::valid &&
+  in_object_t::is_always_strided();
+
+template<class IndexType>
+bool blas_fits_int(IndexType n)
+{
+  return static_cast<std::size_t>(n) <=
+    static_cast<std::size_t>(std::numeric_limits<int>::max());
+}
+
+// Fits a (rows x cols) matrix with the given strides into a
+// column-major matrix with leading dimension ld, if possible.
+// Strides along an extent of at most one are irrelevant.
+template<class IndexType>
+bool blas_column_major_ld(IndexType rows, IndexType cols,
+                          IndexType row_stride, IndexType col_stride,
+                          int& ld)
+{
+  if (rows > 1 && row_stride != 1) {
+    return false;
+  }
+  const IndexType min_ld = rows > 1 ? rows : IndexType(1);
+  const IndexType the_ld = cols > 1 ? col_stride : min_ld;
+  if (the_ld < min_ld || ! blas_fits_int(the_ld)) {
+    return false;
+  }
+  ld = int(the_ld);
+  return true;
+}
+
+// Describes the stored matrix S behind X as the BLAS sees it: X is S
+// if S is column major, else X is S^T with S column major (which is
+// what a row-major X looks like to a column-major BLAS).
+template<class in_matrix_t>
+bool blas_matrix_storage(const in_matrix_t& X, bool& trans, int& ld)
+{
+  using index_type = typename in_matrix_t::index_type;
+  const index_type rows = X.extent(0);
+  const index_type cols = X.extent(1);
+  const index_type row_stride = X.stride(0);
+  const index_type col_stride = X.stride(1);
+  if (blas_column_major_ld(rows, cols, row_stride, col_stride, ld)) {
+    trans = false;
+    return true;
+  }
+  if (blas_column_major_ld(cols, rows, col_stride, row_stride, ld)) {
+    trans = true;
+    return true;
+  }
+  return false;
+}
+
+// The BLAS INCX for x.  The BLAS ignores INCX if x has at most one
+// element, but still insists that it be nonzero.
+template<class in_vector_t>
+bool blas_vector_inc(const in_vector_t& x, int& inc)
+{
+  if (x.extent(0) <= 1) {
+    inc = 1;
+    return true;
+  }
+  const auto stride = x.stride(0);
+  if (stride < 1 || ! blas_fits_int(stride)) {
+    return false;
+  }
+  inc = int(stride);
+  return true;
+}
+
+// The BLAS TRANS argument for op(S) = conj^conj(S)^trans, or 0 if
+// there isn't one (conjugation without transposition).
+inline char blas_trans_char(bool trans, bool conj)
+{
+  if (! trans) {
+    return conj ? '\0' : 'N';
+  }
+  return conj ? 'C' : 'T';
+}
+
+inline char blas_uplo_char(bool lower)
+{
+  return lower ? 'L' : 'U';
+}
+
+template<class Scalar>
+bool blas_is_real(const Scalar& alpha)
+{
+  if constexpr (is_complex_v<Scalar>) {
+    return alpha.imag() == typename Scalar::value_type{};
+  } else {
+    return true;
+  }
+}
+
+template<class Scalar>
+auto blas_real_part(const Scalar& alpha)
+{
+  if constexpr (is_complex_v<Scalar>) {
+    return alpha.real();
+  } else {
+    return alpha;
+  }
+}
+
+// C = beta*C + ... needs the beta for an updating overload's "E + ..."
+// term.  If E views the same elements as C, possibly scaled (but not
+// conjugated), then beta is E's scaling factor.  Otherwise, this
+// copies E into C (E may still alias C) and returns one.  Only call
+// this once the BLAS call is sure to happen.
+template<class in_object_t, class out_object_t>
+typename out_object_t::element_type
+blas_update_beta(const in_object_t& E, const out_object_t& C)
+{
+  using scalar_type = typename out_object_t::element_type;
+  using E_traits = blas_traits_t<scalar_type, in_object_t>;
+  static_assert(in_object_t::rank() == out_object_t::rank());
+
+  if constexpr (E_traits::valid && ! E_traits::conj &&
+                in_object_t::is_always_strided()) {
+    const scalar_type* E_ptr = E.data_handle();
+    const scalar_type* C_ptr = C.data_handle();
+    bool same = E_ptr == C_ptr;
+    for (std::size_t r = 0; r < out_object_t::rank(); ++r) {
+      same = same && std::size_t(E.stride(r)) == std::size_t(C.stride(r));
+    }
+    if (same) {
+      return E_traits::scaling_factor(E.accessor());
+    }
+  }
+
+  if constexpr (out_object_t::rank() == 1) {
+    for (std::size_t i = 0; i < std::size_t(C.extent(0)); ++i) {
+      C(i) = E(i);
+    }
+  } else {
+    for (std::size_t j = 0; j < std::size_t(C.extent(1)); ++j) {
+      for (std::size_t i = 0; i < std::size_t(C.extent(0)); ++i) {
+        C(i,j) = E(i,j);
+      }
+    }
+  }
+  return scalar_type(1);
+}
+
+// Copies x into y, for BLAS routines that work in place.
+template<class in_object_t, class out_object_t>
+void blas_copy_in(const in_object_t& x, const out_object_t& y)
+{
+  if constexpr (out_object_t::rank() == 1) {
+    for (std::size_t i = 0; i < std::size_t(y.extent(0)); ++i) {
+      y(i) = x(i);
+    }
+  } else {
+    for (std::size_t j = 0; j < std::size_t(y.extent(1)); ++j) {
+      for (std::size_t i = 0; i < std::size_t(y.extent(0)); ++i) {
+        y(i,j) = x(i,j);
+      }
+    }
+  }
+}
+
+} // end namespace impl
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif // LINALG_ENABLE_BLAS
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_DISPATCH_HPP_
@@ -0,0 +1,1678 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_PARALLEL_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_PARALLEL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Overloads of the BLAS algorithms for impl::parallel_exec_t, the
+// policy that std::execution::par and par_unseq map to.  Each BLAS 2
+// and 3 overload cuts the output into independent blocks and runs the
+// inline_exec_t overload on each block on the policy's thread pool, so
+// every block still gets the BLAS or the packed GEMM engine where
+// those apply.  The BLAS 1 reductions cut the input vector instead,
+// and combine the blocks' results in order; the sums among them cut it
+// into fixed-size chunks, so that their results do not depend on the
+// number of threads.  Plane rotations cut their vectors, or the rows
+// of the matrix for sequences of rotations.
+// Symmetric and Hermitian matrix-vector products and rank-1 and rank-2
+// updates of column-major or row-major arrays split the lines of their
+// fused kernels among the tasks instead.  Batched products and
+// solves cut the batch into blocks of items, unless there are too few
+// items, when each item's product or solve is parallel instead.
+//
+// Blocks are layout_stride views, so operands with layouts that are
+// not always strided (for example, packed layouts) run inline.
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+template<class... Objects>
+constexpr bool parallel_sliceable()
+{
+  return (Objects::is_always_strided() && ...);
+}
+
+// Rows [r0, r1) and columns [c0, c1) of A, as a layout_stride view.
+template<class ElementType, class Extents, class Layout, class Accessor>
+auto strided_submatrix(const mdspan<ElementType, Extents, Layout, Accessor>& A,
+  std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1)
+{
+  using index_type = typename Extents::index_type;
+  using extents_type = dextents<index_type, 2>;
+  using accessor_type = typename Accessor::offset_policy;
+  using element_type = typename accessor_type::element_type;
+
+  const std::size_t offset = (r0 < r1 && c0 < c1) ?
+    std::size_t(A.mapping()(index_type(r0), index_type(c0))) : std::size_t(0);
+  const typename layout_stride::template mapping<extents_type> map(
+    extents_type(index_type(r1 - r0), index_type(c1 - c0)),
+    std::array<index_type, 2>{index_type(A.stride(0)), index_type(A.stride(1))});
+  return mdspan<element_type, extents_type, layout_stride, accessor_type>(
+    A.accessor().offset(A.data_handle(), offset), map, accessor_type(A.accessor()));
+}
+
+// Elements [i0, i1) of x, as a layout_stride view.
+template<class ElementType, class Extents, class Layout, class Accessor>
+auto strided_subvector(const mdspan<ElementType, Extents, Layout, Accessor>& x,
+  std::size_t i0, std::size_t i1)
+{
+  using index_type = typename Extents::index_type;
+  using extents_type = dextents<index_type, 1>;
+  using accessor_type = typename Accessor::offset_policy;
+  using element_type = typename accessor_type::element_type;
+
+  const std::size_t offset =
+    i0 < i1 ? std::size_t(x.mapping()(index_type(i0))) : std::size_t(0);
+  const typename layout_stride::template mapping<extents_type> map(
+    extents_type(index_type(i1 - i0)),
+    std::array<index_type, 1>{index_type(x.stride(0))});
+  return mdspan<element_type, extents_type, layout_stride, accessor_type>(
+    x.accessor().offset(x.data_handle(), offset), map, accessor_type(x.accessor()));
+}
+
+// Number of tasks to cut num_units equal units of work into, when
+// each unit costs about unit_work flops: enough to balance the load
+// over the pool, but none so small that handing it to another thread
+// costs more than it saves.
+inline std::size_t parallel_task_count(const thread_pool& pool,
+  std::size_t num_units, double unit_work)
+{
+  constexpr double min_task_work = 65536.0;
+  if (pool.concurrency() == 1) {
+    return 1;
+  }
+  const auto by_work = std::size_t(double(num_units) * unit_work / min_task_work);
+  return std::max(std::size_t(1),
+    std::min({num_units, by_work, 4 * pool.concurrency()}));
+}
+
+// Bounds of part p of [0, n) cut into num_parts nearly equal parts.
+inline std::pair<std::size_t, std::size_t>
+parallel_block(std::size_t n, std::size_t num_parts, std::size_t p)
+{
+  return {n * p / num_parts, n * (p + 1) / num_parts};
+}
+
+// Bounds of part p of the columns [0, n) of the Triangle of an n x n
+// matrix, cut into num_parts parts with about the same number of
+// entries in the triangle.
+template<class Triangle>
+std::pair<std::size_t, std::size_t>
+parallel_triangle_block(std::size_t n, std::size_t num_parts, std::size_t p)
+{
+  auto bound = [=] (std::size_t q) {
+    if (q >= num_parts) {
+      return n;
+    }
+    const double f = double(q) / double(num_parts);
+    const double b = std::is_same_v<Triangle, lower_triangle_t> ?
+      double(n) * (1.0 - std::sqrt(1.0 - f)) : double(n) * std::sqrt(f);
+    return std::min(n, std::size_t(b + 0.5));
+  };
+  return {bound(p), bound(p + 1)};
+}
+
+// Cut the m x n result of a product with inner dimension k along its
+// longer side, and call f(i0, i1, j0, j1) for each block.
+template<class F>
+void parallel_product_blocks(thread_pool& pool,
+  std::size_t m, std::size_t n, std::size_t k, F f)
+{
+  const bool by_columns = n >= m;
+  const std::size_t num_units = by_columns ? n : m;
+  const std::size_t num_tasks = parallel_task_count(pool, num_units,
+    2.0 * double(by_columns ? m : n) * double(k));
+  pool.parallel_for(num_tasks, [&] (std::size_t task) {
+    const auto [b0, b1] = parallel_block(num_units, num_tasks, task);
+    if (by_columns) {
+      f(std::size_t(0), m, b0, b1);
+    }
+    else {
+      f(b0, b1, std::size_t(0), n);
+    }
+  });
+}
+
+// Cut the columns of the Triangle of an n x n matrix into blocks
+// [j0, j1), and call f(j0, j1, r0, r1) for each, where [r0, r1) are
+// the rows of that Triangle outside the diagonal block.
+template<class Triangle, class F>
+void parallel_triangle_blocks(thread_pool& pool,
+  std::size_t n, double entry_work, F f)
+{
+  const std::size_t num_tasks =
+    parallel_task_count(pool, n, double(n) * entry_work / 2.0);
+  pool.parallel_for(num_tasks, [&] (std::size_t task) {
+    const auto [j0, j1] = parallel_triangle_block<Triangle>(n, num_tasks, task);
+    if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+      f(j0, j1, j1, n);
+    }
+    else {
+      f(j0, j1, std::size_t(0), j0);
+    }
+  });
+}
+
+// Conjugate transpose for the Hermitian algorithms, transpose otherwise.
+template<bool Hermitian, class in_matrix_t>
+auto parallel_op(in_matrix_t A)
+{
+  if constexpr (Hermitian) {
+    return conjugate_transposed(A);
+  }
+  else {
+    return transposed(A);
+  }
+}
+
+// C(r0:r1, j0:j1) += A(r0:r1, :) * op(B(j0:j1, :)), for the rows of
+// the triangle of C outside its diagonal block [j0, j1) x [j0, j1).
+template<bool Hermitian, class in_matrix_1_t, class in_matrix_2_t,
+         class inout_matrix_t>
+void parallel_off_diagonal_update(in_matrix_1_t A, in_matrix_2_t B,
+  inout_matrix_t C, std::size_t j0, std::size_t j1,
+  std::size_t r0, std::size_t r1)
+{
+  if (r0 < r1 && j0 < j1) {
+    const std::size_t k = A.extent(1);
+    auto C_rj = strided_submatrix(C, r0, r1, j0, j1);
+    linalg::matrix_product(inline_exec_t{}, strided_submatrix(A, r0, r1, 0, k),
+      parallel_op<Hermitian>(strided_submatrix(B, j0, j1, 0, k)), C_rj, C_rj);
+  }
+}
+
+// Parallel fused symmetric or Hermitian matrix-vector product
+// y := A * x.  Each task sweeps a block of columns of A's triangle,
+// with about as many elements as the others, into its own copy of y,
+// so that each element of the triangle is read once.  The copies are
+// then summed into y in task order, by blocks of rows.
+template<bool Hermitian, class in_matrix_t, class Triangle,
+         class in_vector_t, class out_vector_t>
+void parallel_fused_symmetric_matrix_vector_product(thread_pool& pool,
+  in_matrix_t A, Triangle t, in_vector_t x, out_vector_t y)
+{
+  using value_type = typename out_vector_t::element_type;
+  const std::size_t n = A.extent(0);
+  if (n == 0) {
+    return;
+  }
+  const auto A_t = make_fused_symv_matrix<Hermitian, value_type>(A, t);
+  using triangle_type = typename decltype(A_t)::triangle_type;
+  std::vector<value_type> x_copy;
+  const value_type* const xp = contiguous_vector_data<value_type>(x, x_copy);
+
+  const std::size_t num_tasks = parallel_task_count(pool, n, 2.0 * double(n));
+  std::vector<value_type> y_parts(num_tasks * n);
+  pool.parallel_for(num_tasks, [&] (std::size_t task) {
+    const auto [l0, l1] = parallel_triangle_block<triangle_type>(n, num_tasks, task);
+    A_t.add_columns(xp, y_parts.data() + task * n, l0, l1);
+  });
+  const std::size_t num_sum_tasks =
+    parallel_task_count(pool, n, double(num_tasks));
+  pool.parallel_for(num_sum_tasks, [&] (std::size_t task) {
+    const auto [i0, i1] = parallel_block(n, num_sum_tasks, task);
+    for (std::size_t i = i0; i < i1; ++i) {
+      value_type sum{};
+      for (std::size_t p = 0; p < num_tasks; ++p) {
+        sum += y_parts[p * n + i];
+      }
+      y(i) = sum;
+    }
+  });
+}
+
+// Parallel symmetric or Hermitian matrix-vector product y := A * x.
+// A in a column-major or row-major array takes the fused product.
+// Otherwise, each block of rows of y gets the diagonal block of A from
+// the inline algorithm, and the rest of its rows of A from the
+// triangle as two general matrix-vector products.
+template<bool Hermitian, class in_matrix_t, class Triangle,
+         class in_vector_t, class out_vector_t>
+void parallel_symmetric_matrix_vector_product(thread_pool& pool,
+  in_matrix_t A, Triangle t, in_vector_t x, out_vector_t y)
+{
+  if constexpr (fused_symv_eligible<in_matrix_t, out_vector_t>()) {
+    parallel_fused_symmetric_matrix_vector_product<Hermitian>(pool, A, t, x, y);
+    return;
+  }
+  const std::size_t n = A.extent(0);
+  const std::size_t num_tasks = parallel_task_count(pool, n, 2.0 * double(n));
+  pool.parallel_for(num_tasks, [&] (std::size_t task) {
+    const auto [i0, i1] = parallel_block(n, num_tasks, task);
+    auto y_i = strided_subvector(y, i0, i1);
+    auto A_ii = strided_submatrix(A, i0, i1, i0, i1);
+    auto x_i = strided_subvector(x, i0, i1);
+    if constexpr (Hermitian) {
+      linalg::hermitian_matrix_vector_product(inline_exec_t{}, A_ii, t, x_i, y_i);
+    }
+    else {
+      linalg::symmetric_matrix_vector_product(inline_exec_t{}, A_ii, t, x_i, y_i);
+    }
+    auto update = [&] (auto A_block, std::size_t c0, std::size_t c1) {
+      if (c0 < c1) {
+        linalg::matrix_vector_product(inline_exec_t{}, A_block,
+          strided_subvector(x, c0, c1), y_i, y_i);
+      }
+    };
+    if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+      update(strided_submatrix(A, i0, i1, 0, i0), 0, i0);
+      update(parallel_op<Hermitian>(strided_submatrix(A, i1, n, i0, i1)), i1, n);
+    }
+    else {
+      update(parallel_op<Hermitian>(strided_submatrix(A, 0, i0, i0, i1)), 0, i0);
+      update(strided_submatrix(A, i0, i1, i1, n), i1, n);
+    }
+  });
+}
+
+// Parallel outer-product update (see outer_product_update): each task
+// updates a block of A's lines, with about as many elements in the
+// triangle as the other blocks.
+template<class Update>
+void parallel_outer_product_update(thread_pool& pool, const Update& update)
+{
+  using line_triangle_type = typename Update::line_triangle_type;
+  const std::size_t n = update.num_lines();
+  const double line_work = 2.0 * double(Update::rank) * double(update.line_length());
+  if constexpr (std::is_void_v<line_triangle_type>) {
+    const std::size_t num_tasks = parallel_task_count(pool, n, line_work);
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [l0, l1] = parallel_block(n, num_tasks, task);
+      update.update_lines(l0, l1);
+    });
+  }
+  else {
+    const std::size_t num_tasks = parallel_task_count(pool, n, line_work / 2.0);
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [l0, l1] =
+        parallel_triangle_block<line_triangle_type>(n, num_tasks, task);
+      update.update_lines(l0, l1);
+    });
+  }
+}
+
+// Index of the first element of largest magnitude.  Each block finds
+// its own (index, magnitude) with the SIMD or generic kernel; taking
+// the first block with the largest magnitude keeps the first index
+// among equal magnitudes.
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Magnitude,
+         std::enable_if_t<is_idx_abs_max_magnitude_v<Magnitude>, bool> = true>
+SizeType idx_abs_max(
+  parallel_exec_t&& exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Magnitude magnitude)
+{
+  const std::size_t n = v.extent(0);
+  if constexpr (parallel_sliceable<decltype(v)>()) {
+    if (n == 0) {
+      return std::numeric_limits<SizeType>::max();
+    }
+    auto& pool = exec.pool();
+    const std::size_t num_tasks = parallel_task_count(pool, n, 1.0);
+    using result_type = decltype(idx_abs_max_search(v, magnitude));
+    std::vector<result_type> results(num_tasks);
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(n, num_tasks, task);
+      results[task] = idx_abs_max_search(strided_subvector(v, i0, i1), magnitude);
+      results[task].index += SizeType(i0);
+    });
+    result_type best = results[0];
+    for (std::size_t task = 1; task < num_tasks; ++task) {
+      const result_type& r = results[task];
+      if (r.found && (! best.found || best.magnitude < r.magnitude)) {
+        best = r;
+      }
+    }
+    return idx_abs_max_index(v, magnitude, best);
+  }
+  else {
+    return linalg::idx_abs_max(inline_exec_t{}, v, magnitude);
+  }
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor>
+SizeType idx_abs_max(
+  parallel_exec_t&& exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v)
+{
+  return idx_abs_max(std::move(exec), v, idx_abs_max_modulus);
+}
+
+// Sums: dot products, sums of absolute values, sums of squares, and
+// the norms built on them.  These are reproducible: the input is cut
+// into chunks of reduction_chunk_size elements, so the chunks depend
+// only on its length, each chunk is reduced by the inline algorithm,
+// and the chunks' results are combined by the same pairwise tree,
+// whatever the number of threads.  So the results are bitwise
+// identical from run to run and for any number of threads, including
+// one.  Inputs of at most one chunk are reduced inline, and give the
+// inline algorithm's result.
+
+inline constexpr std::size_t reduction_chunk_size = 8192;
+
+// Reduce [0, n), with n > 0, cut into chunks of chunk_size units that
+// cost about unit_work flops each: reduce_chunk(i0, i1) reduces the
+// chunk [i0, i1) to a T, and combine(a, b) combines the results of
+// two neighboring runs of chunks.
+template<class T, class ReduceChunk, class Combine>
+T parallel_reproducible_reduce(thread_pool& pool,
+  std::size_t n, std::size_t chunk_size, double unit_work,
+  ReduceChunk reduce_chunk, Combine combine)
+{
+  const std::size_t num_chunks = (n + chunk_size - 1) / chunk_size;
+  std::vector<T> results(num_chunks);
+  const std::size_t num_tasks =
+    parallel_task_count(pool, num_chunks, double(chunk_size) * unit_work);
+  pool.parallel_for(num_tasks, [&] (std::size_t task) {
+    const auto [c0, c1] = parallel_block(num_chunks, num_tasks, task);
+    for (std::size_t c = c0; c < c1; ++c) {
+      results[c] = reduce_chunk(c * chunk_size, std::min(n, (c + 1) * chunk_size));
+    }
+  });
+  for (std::size_t width = 1; width < num_chunks; width *= 2) {
+    for (std::size_t c = 0; c + width < num_chunks; c += 2 * width) {
+      results[c] = combine(results[c], results[c + width]);
+    }
+  }
+  return results[0];
+}
+
+template<class ElementType1,
+         class SizeType1, ::std::size_t ext1,
+         class Layout1,
+         class Accessor1,
+         class ElementType2,
+         class SizeType2, ::std::size_t ext2,
+         class Layout2,
+         class Accessor2,
+         class Scalar>
+Scalar dot(
+  parallel_exec_t&& exec,
+  mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> v1,
+  mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> v2,
+  Scalar init)
+{
+  const std::size_t n = v1.extent(0);
+  if constexpr (parallel_sliceable<decltype(v1), decltype(v2)>()) {
+    if (n > reduction_chunk_size) {
+      return init + parallel_reproducible_reduce<Scalar>(exec.pool(),
+        n, reduction_chunk_size, 2.0,
+        [&] (std::size_t i0, std::size_t i1) {
+          return linalg::dot(inline_exec_t{}, strided_subvector(v1, i0, i1),
+                             strided_subvector(v2, i0, i1), Scalar{});
+        },
+        [] (const Scalar& a, const Scalar& b) { return a + b; });
+    }
+  }
+  return linalg::dot(inline_exec_t{}, v1, v2, init);
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar vector_abs_sum(
+  parallel_exec_t&& exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> v,
+  Scalar init)
+{
+  const std::size_t n = v.extent(0);
+  if constexpr (parallel_sliceable<decltype(v)>()) {
+    if (n > reduction_chunk_size) {
+      return init + parallel_reproducible_reduce<Scalar>(exec.pool(),
+        n, reduction_chunk_size, 1.0,
+        [&] (std::size_t i0, std::size_t i1) {
+          return linalg::vector_abs_sum(inline_exec_t{},
+                                        strided_subvector(v, i0, i1), Scalar{});
+        },
+        [] (const Scalar& a, const Scalar& b) { return a + b; });
+    }
+  }
+  return linalg::vector_abs_sum(inline_exec_t{}, v, init);
+}
+
+// Each chunk's sum of squares starts from zero; sum_of_squares_merge
+// combines them, and then adds the total to init.
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+sum_of_squares_result<Scalar> vector_sum_of_squares(
+  parallel_exec_t&& exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  sum_of_squares_result<Scalar> init)
+{
+  using result_type = sum_of_squares_result<Scalar>;
+  const std::size_t n = x.extent(0);
+  if constexpr (parallel_sliceable<decltype(x)>()) {
+    if (n > reduction_chunk_size) {
+      const result_type total = parallel_reproducible_reduce<result_type>(exec.pool(),
+        n, reduction_chunk_size, 2.0,
+        [&] (std::size_t i0, std::size_t i1) {
+          return linalg::vector_sum_of_squares(inline_exec_t{},
+            strided_subvector(x, i0, i1), result_type{Scalar(0), Scalar(0)});
+        },
+        [] (const result_type& a, const result_type& b) {
+          return sum_of_squares_merge(a, b.scaling_factor, b.scaled_sum_of_squares);
+        });
+      return sum_of_squares_merge(init, total.scaling_factor, total.scaled_sum_of_squares);
+    }
+  }
+  return linalg::vector_sum_of_squares(inline_exec_t{}, x, init);
+}
+
+template<class ElementType,
+         class SizeType, ::std::size_t ext0,
+         class Layout,
+         class Accessor,
+         class Scalar>
+Scalar vector_norm2(
+  parallel_exec_t&& exec,
+  mdspan<ElementType, extents<SizeType, ext0>, Layout, Accessor> x,
+  Scalar init)
+{
+  const auto ssq = vector_sum_of_squares(std::move(exec), x,
+    sum_of_squares_result<Scalar>{Scalar{}, Scalar(1.0)});
+  using std::sqrt;
+  return init + ssq.scaling_factor * sqrt(ssq.scaled_sum_of_squares);
+}
+
+// Frobenius norm: cut A into chunks of whole rows, with about
+// reduction_chunk_size elements each.
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Scalar>
+Scalar matrix_frob_norm(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Scalar init)
+{
+  using result_type = sum_of_squares_result<Scalar>;
+  const std::size_t m = A.extent(0);
+  const std::size_t n = A.extent(1);
+  if constexpr (parallel_sliceable<decltype(A)>()) {
+    if (m > 1 && m * n > reduction_chunk_size) {
+      const std::size_t rows_per_chunk =
+        std::max(std::size_t(1), reduction_chunk_size / n);
+      const result_type total = parallel_reproducible_reduce<result_type>(exec.pool(),
+        m, rows_per_chunk, 2.0 * double(n),
+        [&] (std::size_t i0, std::size_t i1) {
+          result_type r{Scalar(0), Scalar(0)};
+          matrix_sum_of_squares_update(strided_submatrix(A, i0, i1, 0, n),
+                                       r.scaling_factor, r.scaled_sum_of_squares);
+          return r;
+        },
+        [] (const result_type& a, const result_type& b) {
+          return sum_of_squares_merge(a, b.scaling_factor, b.scaled_sum_of_squares);
+        });
+      using std::sqrt;
+      return init + total.scaling_factor * sqrt(total.scaled_sum_of_squares);
+    }
+  }
+  return linalg::matrix_frob_norm(inline_exec_t{}, A, init);
+}
+
+// Plane rotations: cut x and y into blocks of elements.
+
+template<class inout_vector_1_t, class inout_vector_2_t, class Real, class S>
+void parallel_givens_rotation_apply(thread_pool& pool,
+  inout_vector_1_t x, inout_vector_2_t y, const Real c, const S s)
+{
+  if constexpr (parallel_sliceable<inout_vector_1_t, inout_vector_2_t>()) {
+    const std::size_t n = x.extent(0);
+    const std::size_t num_tasks = parallel_task_count(pool, n, 6.0);
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(n, num_tasks, task);
+      linalg::givens_rotation_apply(inline_exec_t{},
+        strided_subvector(x, i0, i1), strided_subvector(y, i0, i1), c, s);
+    });
+  }
+  else {
+    linalg::givens_rotation_apply(inline_exec_t{}, x, y, c, s);
+  }
+}
+
+MDSPAN_TEMPLATE_REQUIRES(
+         class ElementType1,
+         class SizeType1,
+         ::std::size_t ext1,
+         class Layout1,
+         class Accessor1,
+         class ElementType2,
+         class SizeType2,
+         ::std::size_t ext2,
+         class Layout2,
+         class Accessor2,
+         class Real,
+         /* requires */ (_MDSPAN_TRAIT(std::is_floating_point, Real))
+)
+void givens_rotation_apply(
+  parallel_exec_t&& exec,
+  mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> x,
+  mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> y,
+  const Real c,
+  const Real s)
+{
+  parallel_givens_rotation_apply(exec.pool(), x, y, c, s);
+}
+
+MDSPAN_TEMPLATE_REQUIRES(
+         class ElementType1,
+         class SizeType1,
+         ::std::size_t ext1,
+         class Layout1,
+         class Accessor1,
+         class ElementType2,
+         class SizeType2,
+         ::std::size_t ext2,
+         class Layout2,
+         class Accessor2,
+         class Real,
+         /* requires */ (_MDSPAN_TRAIT(std::is_floating_point, Real))
+)
+void givens_rotation_apply(
+  parallel_exec_t&& exec,
+  mdspan<ElementType1, extents<SizeType1, ext1>, Layout1, Accessor1> x,
+  mdspan<ElementType2, extents<SizeType2, ext2>, Layout2, Accessor2> y,
+  const Real c,
+  const std::complex<Real> s)
+{
+  parallel_givens_rotation_apply(exec.pool(), x, y, c, s);
+}
+
+// Sequences of plane rotations: the rows of A are independent, so cut
+// A into blocks of rows.
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class ElementType_c, class SizeType_c, ::std::size_t... ext_c,
+         class Layout_c, class Accessor_c,
+         class ElementType_s, class SizeType_s, ::std::size_t... ext_s,
+         class Layout_s, class Accessor_s>
+void givens_rotation_sequence_apply(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  mdspan<ElementType_c, extents<SizeType_c, ext_c...>, Layout_c, Accessor_c> c,
+  mdspan<ElementType_s, extents<SizeType_s, ext_s...>, Layout_s, Accessor_s> s)
+{
+  if constexpr (parallel_sliceable<decltype(A)>()) {
+    const std::size_t m = A.extent(0);
+    const std::size_t n = A.extent(1);
+    const std::size_t num_sequences = c.rank() == 1 ?
+      std::size_t(1) : std::size_t(c.extent(c.rank() - 1));
+    const std::size_t num_rotations = n == 0 ? 0 : n - 1;
+    auto& pool = exec.pool();
+    const std::size_t num_tasks = parallel_task_count(pool, m,
+      6.0 * double(num_rotations) * double(num_sequences));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(m, num_tasks, task);
+      linalg::givens_rotation_sequence_apply(inline_exec_t{},
+        strided_submatrix(A, i0, i1, 0, n), c, s);
+    });
+  }
+  else {
+    linalg::givens_rotation_sequence_apply(inline_exec_t{}, A, c, s);
+  }
+}
+
+// Overwriting general matrix-matrix product: C := A * B
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C )>
+void matrix_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( C ))
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_product_blocks(exec.pool(), C.extent(0), C.extent(1), k,
+      [&] (std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+        linalg::matrix_product(inline_exec_t{},
+          strided_submatrix(A, i0, i1, 0, k),
+          strided_submatrix(B, 0, k, j0, j1),
+          strided_submatrix(C, i0, i1, j0, j1));
+      });
+  }
+  else {
+    linalg::matrix_product(inline_exec_t{}, A, B, C);
+  }
+}
+
+// Updating general matrix-matrix product: C := E + A * B
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( E ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C )>
+void matrix_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( E ),
+  P1673_MATRIX_PARAMETER( C ))
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(E), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_product_blocks(exec.pool(), C.extent(0), C.extent(1), k,
+      [&] (std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+        linalg::matrix_product(inline_exec_t{},
+          strided_submatrix(A, i0, i1, 0, k),
+          strided_submatrix(B, 0, k, j0, j1),
+          strided_submatrix(E, i0, i1, j0, j1),
+          strided_submatrix(C, i0, i1, j0, j1));
+      });
+  }
+  else {
+    linalg::matrix_product(inline_exec_t{}, A, B, E, C);
+  }
+}
+
+// Overwriting general matrix-vector product: y := A * x
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void matrix_vector_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(y)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = A.extent(0);
+    const std::size_t n = A.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, m, 2.0 * double(n));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(m, num_tasks, task);
+      linalg::matrix_vector_product(inline_exec_t{},
+        strided_submatrix(A, i0, i1, 0, n), x, strided_subvector(y, i0, i1));
+    });
+  }
+  else {
+    linalg::matrix_vector_product(inline_exec_t{}, A, x, y);
+  }
+}
+
+// Updating general matrix-vector product: z := y + A * x
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void matrix_vector_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, ext_z>, Layout_z, Accessor_z> z)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(y), decltype(z)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = A.extent(0);
+    const std::size_t n = A.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, m, 2.0 * double(n));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(m, num_tasks, task);
+      linalg::matrix_vector_product(inline_exec_t{},
+        strided_submatrix(A, i0, i1, 0, n), x,
+        strided_subvector(y, i0, i1), strided_subvector(z, i0, i1));
+    });
+  }
+  else {
+    linalg::matrix_vector_product(inline_exec_t{}, A, x, y, z);
+  }
+}
+
+// Overwriting symmetric matrix-vector product: y := A * x
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void symmetric_matrix_vector_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(x), decltype(y)>()) {
+    parallel_symmetric_matrix_vector_product<false>(exec.pool(), A, t, x, y);
+  }
+  else {
+    linalg::symmetric_matrix_vector_product(inline_exec_t{}, A, t, x, y);
+  }
+}
+
+// Overwriting Hermitian matrix-vector product: y := A * x
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void hermitian_matrix_vector_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(x), decltype(y)>()) {
+    parallel_symmetric_matrix_vector_product<true>(exec.pool(), A, t, x, y);
+  }
+  else {
+    linalg::hermitian_matrix_vector_product(inline_exec_t{}, A, t, x, y);
+  }
+}
+
+// Nonsymmetric rank-1 matrix update: A := A + x * y^T
+
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A )>
+void matrix_rank_1_update(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  P1673_MATRIX_PARAMETER( A ))
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(), matrix_rank_1_update_kernel(A, x, y));
+  }
+  else if constexpr (parallel_sliceable<decltype(x), decltype(y), decltype(A)>()) {
+    parallel_product_blocks(exec.pool(), A.extent(0), A.extent(1), 1,
+      [&] (std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+        linalg::matrix_rank_1_update(inline_exec_t{},
+          strided_subvector(x, i0, i1), strided_subvector(y, j0, j1),
+          strided_submatrix(A, i0, i1, j0, j1));
+      });
+  }
+  else {
+    linalg::matrix_rank_1_update(inline_exec_t{}, x, y, A);
+  }
+}
+
+// Rank-1 symmetric matrix update: A := A + alpha * x * x^T
+
+template<class ScaleFactorType,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle>
+void symmetric_matrix_rank_1_update(
+  parallel_exec_t&& exec,
+  ScaleFactorType alpha,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t)
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(),
+      symmetric_matrix_rank_1_update_kernel<false, Triangle>(A, x, alpha));
+  }
+  else {
+    linalg::symmetric_matrix_rank_1_update(inline_exec_t{}, alpha, x, A, t);
+  }
+}
+
+// Rank-1 symmetric matrix update: A := A + x * x^T
+
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle>
+void symmetric_matrix_rank_1_update(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t)
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(),
+      symmetric_matrix_rank_1_update_kernel<false, Triangle>(A, x));
+  }
+  else {
+    linalg::symmetric_matrix_rank_1_update(inline_exec_t{}, x, A, t);
+  }
+}
+
+// Rank-1 Hermitian matrix update: A := A + alpha * x * x^H
+
+template<class ScaleFactorType,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle>
+void hermitian_matrix_rank_1_update(
+  parallel_exec_t&& exec,
+  ScaleFactorType alpha,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t)
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(),
+      symmetric_matrix_rank_1_update_kernel<true, Triangle>(A, x, alpha));
+  }
+  else {
+    linalg::hermitian_matrix_rank_1_update(inline_exec_t{}, alpha, x, A, t);
+  }
+}
+
+// Rank-1 Hermitian matrix update: A := A + x * x^H
+
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle>
+void hermitian_matrix_rank_1_update(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t)
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(),
+      symmetric_matrix_rank_1_update_kernel<true, Triangle>(A, x));
+  }
+  else {
+    linalg::hermitian_matrix_rank_1_update(inline_exec_t{}, x, A, t);
+  }
+}
+
+// Rank-2 symmetric matrix update: A := A + x * y^T + y * x^T
+
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle>
+void symmetric_matrix_rank_2_update(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t)
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(),
+      symmetric_matrix_rank_2_update_kernel<false, Triangle>(A, x, y));
+  }
+  else {
+    linalg::symmetric_matrix_rank_2_update(inline_exec_t{}, x, y, A, t);
+  }
+}
+
+// Rank-2 Hermitian matrix update: A := A + x * y^H + y * x^H
+
+template<class ElementType_x,
+         class SizeType_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle>
+void hermitian_matrix_rank_2_update(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_x, extents<SizeType_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, ext_y>, Layout_y, Accessor_y> y,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t)
+{
+  if constexpr (outer_product_update_eligible<decltype(A)>()) {
+    parallel_outer_product_update(exec.pool(),
+      symmetric_matrix_rank_2_update_kernel<true, Triangle>(A, x, y));
+  }
+  else {
+    linalg::hermitian_matrix_rank_2_update(inline_exec_t{}, x, y, A, t);
+  }
+}
+
+// Rank-k symmetric matrix update: C := C + alpha * A * A^T
+
+template<class ScaleFactorType,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C ),
+         class Triangle>
+void symmetric_matrix_rank_k_update(
+  parallel_exec_t&& exec,
+  ScaleFactorType alpha,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( C ),
+  Triangle t)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_triangle_blocks<Triangle>(exec.pool(), C.extent(0),
+      2.0 * double(k),
+      [&] (std::size_t j0, std::size_t j1, std::size_t r0, std::size_t r1) {
+        linalg::symmetric_matrix_rank_k_update(inline_exec_t{}, alpha,
+          strided_submatrix(A, j0, j1, 0, k),
+          strided_submatrix(C, j0, j1, j0, j1), t);
+        parallel_off_diagonal_update<false>(linalg::scaled(alpha, A), A, C,
+          j0, j1, r0, r1);
+      });
+  }
+  else {
+    linalg::symmetric_matrix_rank_k_update(inline_exec_t{}, alpha, A, C, t);
+  }
+}
+
+// Rank-k symmetric matrix update: C := C + A * A^T
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C ),
+         class Triangle>
+void symmetric_matrix_rank_k_update(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( C ),
+  Triangle t)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_triangle_blocks<Triangle>(exec.pool(), C.extent(0),
+      2.0 * double(k),
+      [&] (std::size_t j0, std::size_t j1, std::size_t r0, std::size_t r1) {
+        linalg::symmetric_matrix_rank_k_update(inline_exec_t{},
+          strided_submatrix(A, j0, j1, 0, k),
+          strided_submatrix(C, j0, j1, j0, j1), t);
+        parallel_off_diagonal_update<false>(A, A, C, j0, j1, r0, r1);
+      });
+  }
+  else {
+    linalg::symmetric_matrix_rank_k_update(inline_exec_t{}, A, C, t);
+  }
+}
+
+// Rank-k Hermitian matrix update: C := C + alpha * A * A^H
+
+template<class ScaleFactorType,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C ),
+         class Triangle>
+void hermitian_matrix_rank_k_update(
+  parallel_exec_t&& exec,
+  ScaleFactorType alpha,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( C ),
+  Triangle t)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_triangle_blocks<Triangle>(exec.pool(), C.extent(0),
+      2.0 * double(k),
+      [&] (std::size_t j0, std::size_t j1, std::size_t r0, std::size_t r1) {
+        linalg::hermitian_matrix_rank_k_update(inline_exec_t{}, alpha,
+          strided_submatrix(A, j0, j1, 0, k),
+          strided_submatrix(C, j0, j1, j0, j1), t);
+        parallel_off_diagonal_update<true>(linalg::scaled(alpha, A), A, C,
+          j0, j1, r0, r1);
+      });
+  }
+  else {
+    linalg::hermitian_matrix_rank_k_update(inline_exec_t{}, alpha, A, C, t);
+  }
+}
+
+// Rank-k Hermitian matrix update: C := C + A * A^H
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C ),
+         class Triangle>
+void hermitian_matrix_rank_k_update(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( C ),
+  Triangle t)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_triangle_blocks<Triangle>(exec.pool(), C.extent(0),
+      2.0 * double(k),
+      [&] (std::size_t j0, std::size_t j1, std::size_t r0, std::size_t r1) {
+        linalg::hermitian_matrix_rank_k_update(inline_exec_t{},
+          strided_submatrix(A, j0, j1, 0, k),
+          strided_submatrix(C, j0, j1, j0, j1), t);
+        parallel_off_diagonal_update<true>(A, A, C, j0, j1, r0, r1);
+      });
+  }
+  else {
+    linalg::hermitian_matrix_rank_k_update(inline_exec_t{}, A, C, t);
+  }
+}
+
+// Rank-2k symmetric matrix update: C := C + A * B^T + B * A^T
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C ),
+         class Triangle>
+void symmetric_matrix_rank_2k_update(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( C ),
+  Triangle t)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_triangle_blocks<Triangle>(exec.pool(), C.extent(0),
+      4.0 * double(k),
+      [&] (std::size_t j0, std::size_t j1, std::size_t r0, std::size_t r1) {
+        linalg::symmetric_matrix_rank_2k_update(inline_exec_t{},
+          strided_submatrix(A, j0, j1, 0, k),
+          strided_submatrix(B, j0, j1, 0, k),
+          strided_submatrix(C, j0, j1, j0, j1), t);
+        if constexpr (fused_rank_2k_update_eligible<decltype(A), decltype(B), decltype(C)>()) {
+          fused_rank_2k_block_update(A, B, C, r0, r1, j0, j1);
+        }
+        else {
+          parallel_off_diagonal_update<false>(A, B, C, j0, j1, r0, r1);
+          parallel_off_diagonal_update<false>(B, A, C, j0, j1, r0, r1);
+        }
+      });
+  }
+  else {
+    linalg::symmetric_matrix_rank_2k_update(inline_exec_t{}, A, B, C, t);
+  }
+}
+
+// Rank-2k Hermitian matrix update: C := C + A * B^H + B * A^H
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C ),
+         class Triangle>
+void hermitian_matrix_rank_2k_update(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( C ),
+  Triangle t)
+{
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(C)>()) {
+    const std::size_t k = A.extent(1);
+    parallel_triangle_blocks<Triangle>(exec.pool(), C.extent(0),
+      4.0 * double(k),
+      [&] (std::size_t j0, std::size_t j1, std::size_t r0, std::size_t r1) {
+        linalg::hermitian_matrix_rank_2k_update(inline_exec_t{},
+          strided_submatrix(A, j0, j1, 0, k),
+          strided_submatrix(B, j0, j1, 0, k),
+          strided_submatrix(C, j0, j1, j0, j1), t);
+        if constexpr (fused_rank_2k_update_eligible<decltype(A), decltype(B), decltype(C)>()) {
+          fused_rank_2k_block_update(A, B, C, r0, r1, j0, j1);
+        }
+        else {
+          parallel_off_diagonal_update<true>(A, B, C, j0, j1, r0, r1);
+          parallel_off_diagonal_update<true>(B, A, C, j0, j1, r0, r1);
+        }
+      });
+  }
+  else {
+    linalg::hermitian_matrix_rank_2k_update(inline_exec_t{}, A, B, C, t);
+  }
+}
+
+// Overwriting triangular matrix-matrix left product: C := A * B;
+// the columns of C are independent.
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C )>
+void triangular_matrix_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( C ))
+{
+  if constexpr (parallel_sliceable<decltype(B), decltype(C)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = C.extent(0);
+    const std::size_t n = C.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, n, double(m) * double(m));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [j0, j1] = parallel_block(n, num_tasks, task);
+      linalg::triangular_matrix_product(inline_exec_t{}, A, t, d,
+        strided_submatrix(B, 0, m, j0, j1), strided_submatrix(C, 0, m, j0, j1));
+    });
+  }
+  else {
+    linalg::triangular_matrix_product(inline_exec_t{}, A, t, d, B, C);
+  }
+}
+
+// Overwriting triangular matrix-matrix right product: C := B * A;
+// the rows of C are independent.
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C )>
+void triangular_matrix_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  P1673_MATRIX_PARAMETER( C ))
+{
+  if constexpr (parallel_sliceable<decltype(B), decltype(C)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = C.extent(0);
+    const std::size_t n = C.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, m, double(n) * double(n));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(m, num_tasks, task);
+      linalg::triangular_matrix_product(inline_exec_t{},
+        strided_submatrix(B, i0, i1, 0, n), A, t, d,
+        strided_submatrix(C, i0, i1, 0, n));
+    });
+  }
+  else {
+    linalg::triangular_matrix_product(inline_exec_t{}, B, A, t, d, C);
+  }
+}
+
+// In-place triangular matrix-matrix left product: C := A * C
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C )>
+void triangular_matrix_left_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  P1673_MATRIX_PARAMETER( C ))
+{
+  if constexpr (parallel_sliceable<decltype(C)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = C.extent(0);
+    const std::size_t n = C.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, n, double(m) * double(m));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [j0, j1] = parallel_block(n, num_tasks, task);
+      linalg::triangular_matrix_left_product(inline_exec_t{}, A, t, d,
+        strided_submatrix(C, 0, m, j0, j1));
+    });
+  }
+  else {
+    linalg::triangular_matrix_left_product(inline_exec_t{}, A, t, d, C);
+  }
+}
+
+// In-place triangular matrix-matrix right product: C := C * A
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( C )>
+void triangular_matrix_right_product(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  P1673_MATRIX_PARAMETER( C ))
+{
+  if constexpr (parallel_sliceable<decltype(C)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = C.extent(0);
+    const std::size_t n = C.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, m, double(n) * double(n));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(m, num_tasks, task);
+      linalg::triangular_matrix_right_product(inline_exec_t{}, A, t, d,
+        strided_submatrix(C, i0, i1, 0, n));
+    });
+  }
+  else {
+    linalg::triangular_matrix_right_product(inline_exec_t{}, A, t, d, C);
+  }
+}
+
+// Solve A X = B for X; the columns of X are independent.
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( X )>
+void triangular_matrix_matrix_left_solve(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( X ))
+{
+  if constexpr (parallel_sliceable<decltype(B), decltype(X)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = X.extent(0);
+    const std::size_t n = X.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, n, double(m) * double(m));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [j0, j1] = parallel_block(n, num_tasks, task);
+      linalg::triangular_matrix_matrix_left_solve(inline_exec_t{}, A, t, d,
+        strided_submatrix(B, 0, m, j0, j1), strided_submatrix(X, 0, m, j0, j1));
+    });
+  }
+  else {
+    linalg::triangular_matrix_matrix_left_solve(inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+// Solve X A = B for X; the rows of X are independent.
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( X )>
+void triangular_matrix_matrix_right_solve(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( X ))
+{
+  if constexpr (parallel_sliceable<decltype(B), decltype(X)>()) {
+    auto& pool = exec.pool();
+    const std::size_t m = X.extent(0);
+    const std::size_t n = X.extent(1);
+    const std::size_t num_tasks = parallel_task_count(pool, m, double(n) * double(n));
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      const auto [i0, i1] = parallel_block(m, num_tasks, task);
+      linalg::triangular_matrix_matrix_right_solve(inline_exec_t{}, A, t, d,
+        strided_submatrix(B, i0, i1, 0, n), strided_submatrix(X, i0, i1, 0, n));
+    });
+  }
+  else {
+    linalg::triangular_matrix_matrix_right_solve(inline_exec_t{}, A, t, d, B, X);
+  }
+}
+
+template<P1673_MATRIX_TEMPLATE_PARAMETERS( A ),
+         class Triangle,
+         class DiagonalStorage,
+         class Side,
+         P1673_MATRIX_TEMPLATE_PARAMETERS( B ),
+         P1673_MATRIX_TEMPLATE_PARAMETERS( X )>
+void triangular_matrix_matrix_solve(
+  parallel_exec_t&& exec,
+  P1673_MATRIX_PARAMETER( A ),
+  Triangle t,
+  DiagonalStorage d,
+  Side /* s */,
+  P1673_MATRIX_PARAMETER( B ),
+  P1673_MATRIX_PARAMETER( X ))
+{
+  if constexpr (std::is_same_v<Side, left_side_t>) {
+    triangular_matrix_matrix_left_solve(std::move(exec), A, t, d, B, X);
+  }
+  else {
+    triangular_matrix_matrix_right_solve(std::move(exec), A, t, d, B, X);
+  }
+}
+
+
+// Cut a batch of num_items matrix-matrix products, each m x n with
+// inner dimension k, into blocks of items, and call f(b0, b1) for each
+// block.  When there are too few items to keep the pool busy and each
+// is large enough for the packed GEMM engine, call item(b) for each
+// item in turn instead, so the product of each item is parallel.
+template<class F, class Item>
+void parallel_batch_blocks(thread_pool& pool, std::size_t num_items,
+  std::size_t m, std::size_t n, std::size_t k, F f, Item item)
+{
+  if constexpr (! std::is_same_v<Item, std::nullptr_t>) {
+    if (num_items < pool.concurrency() && packed_gemm_worthwhile(m, n, k)) {
+      for (std::size_t b = 0; b < num_items; ++b) {
+        item(b);
+      }
+      return;
+    }
+  }
+  const std::size_t num_tasks = parallel_task_count(pool, num_items,
+    2.0 * double(m) * double(n) * double(k));
+  pool.parallel_for(num_tasks, [&] (std::size_t task) {
+    const auto [b0, b1] = parallel_block(num_items, num_tasks, task);
+    f(b0, b1);
+  });
+}
+
+// Overwriting batched matrix-matrix product: C[b] := A[b] * B[b]
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  auto block = [&] (std::size_t b0, std::size_t b1) {
+    batched_matrix_product_block(A, B, C, b0, b1);
+  };
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(C)>()) {
+    parallel_batch_blocks(exec.pool(), C.extent(0), C.extent(1), C.extent(2), A.extent(2),
+      block, [&] (std::size_t b) {
+        linalg::matrix_product(parallel_exec_t(exec), batch_item(A, b),
+                               batch_item(B, b), batch_item(C, b));
+      });
+  }
+  else {
+    parallel_batch_blocks(exec.pool(), C.extent(0), C.extent(1), C.extent(2), A.extent(2),
+      block, nullptr);
+  }
+}
+
+// Updating batched matrix-matrix product: C[b] := E[b] + A[b] * B[b]
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_E,
+         class SizeType_E, ::std::size_t batch_E, ::std::size_t numRows_E, ::std::size_t numCols_E,
+         class Layout_E,
+         class Accessor_E,
+         class ElementType_C,
+         class SizeType_C, ::std::size_t batch_C, ::std::size_t numRows_C, ::std::size_t numCols_C,
+         class Layout_C,
+         class Accessor_C>
+void batched_matrix_product(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_E, extents<SizeType_E, batch_E, numRows_E, numCols_E>, Layout_E, Accessor_E> E,
+  mdspan<ElementType_C, extents<SizeType_C, batch_C, numRows_C, numCols_C>, Layout_C, Accessor_C> C)
+{
+  auto block = [&] (std::size_t b0, std::size_t b1) {
+    batched_matrix_product_block(A, B, E, C, b0, b1);
+  };
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(E), decltype(C)>()) {
+    parallel_batch_blocks(exec.pool(), C.extent(0), C.extent(1), C.extent(2), A.extent(2),
+      block, [&] (std::size_t b) {
+        linalg::matrix_product(parallel_exec_t(exec), batch_item(A, b),
+                               batch_item(B, b), batch_item(E, b), batch_item(C, b));
+      });
+  }
+  else {
+    parallel_batch_blocks(exec.pool(), C.extent(0), C.extent(1), C.extent(2), A.extent(2),
+      block, nullptr);
+  }
+}
+
+// Overwriting batched matrix-matrix product of ranges of matrices.
+// The items may differ in size; the first item's size stands for all
+// of them when choosing the number of tasks.
+
+MDSPAN_TEMPLATE_REQUIRES(
+  class InMatrixRange1,
+  class InMatrixRange2,
+  class OutMatrixRange,
+  /* requires */ (is_matrix_batch_range_v<InMatrixRange1> &&
+                  is_matrix_batch_range_v<InMatrixRange2> &&
+                  is_matrix_batch_range_v<OutMatrixRange>)
+)
+void batched_matrix_product(
+  parallel_exec_t&& exec,
+  const InMatrixRange1& A,
+  const InMatrixRange2& B,
+  const OutMatrixRange& C)
+{
+  const std::size_t batch = std::size(C);
+  if (batch == 0) {
+    return;
+  }
+  parallel_batch_blocks(exec.pool(), batch, C[0].extent(0), C[0].extent(1), A[0].extent(1),
+    [&] (std::size_t b0, std::size_t b1) {
+      for (std::size_t b = b0; b < b1; ++b) {
+        linalg::matrix_product(inline_exec_t{}, A[b], B[b], C[b]);
+      }
+    },
+    [&] (std::size_t b) {
+      linalg::matrix_product(parallel_exec_t(exec), A[b], B[b], C[b]);
+    });
+}
+
+// Overwriting batched matrix-vector product: y[b] := A[b] * x[b]
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y>
+void batched_matrix_vector_product(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y)
+{
+  parallel_batch_blocks(exec.pool(), A.extent(0), A.extent(1), A.extent(2), 1,
+    [&] (std::size_t b0, std::size_t b1) {
+      batched_matrix_vector_product_block(A, x, y, b0, b1);
+    }, nullptr);
+}
+
+// Updating batched matrix-vector product: z[b] := y[b] + A[b] * x[b]
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class ElementType_x,
+         class SizeType_x, ::std::size_t batch_x, ::std::size_t ext_x,
+         class Layout_x,
+         class Accessor_x,
+         class ElementType_y,
+         class SizeType_y, ::std::size_t batch_y, ::std::size_t ext_y,
+         class Layout_y,
+         class Accessor_y,
+         class ElementType_z,
+         class SizeType_z, ::std::size_t batch_z, ::std::size_t ext_z,
+         class Layout_z,
+         class Accessor_z>
+void batched_matrix_vector_product(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  mdspan<ElementType_x, extents<SizeType_x, batch_x, ext_x>, Layout_x, Accessor_x> x,
+  mdspan<ElementType_y, extents<SizeType_y, batch_y, ext_y>, Layout_y, Accessor_y> y,
+  mdspan<ElementType_z, extents<SizeType_z, batch_z, ext_z>, Layout_z, Accessor_z> z)
+{
+  parallel_batch_blocks(exec.pool(), A.extent(0), A.extent(1), A.extent(2), 1,
+    [&] (std::size_t b0, std::size_t b1) {
+      batched_matrix_vector_product_block(A, x, y, z, b0, b1);
+    }, nullptr);
+}
+
+// Batched triangular solve: A[b] * X[b] = B[b]
+
+template<class ElementType_A,
+         class SizeType_A, ::std::size_t batch_A, ::std::size_t numRows_A, ::std::size_t numCols_A,
+         class Layout_A,
+         class Accessor_A,
+         class Triangle,
+         class DiagonalStorage,
+         class ElementType_B,
+         class SizeType_B, ::std::size_t batch_B, ::std::size_t numRows_B, ::std::size_t numCols_B,
+         class Layout_B,
+         class Accessor_B,
+         class ElementType_X,
+         class SizeType_X, ::std::size_t batch_X, ::std::size_t numRows_X, ::std::size_t numCols_X,
+         class Layout_X,
+         class Accessor_X>
+void batched_triangular_matrix_matrix_left_solve(
+  parallel_exec_t&& exec,
+  mdspan<ElementType_A, extents<SizeType_A, batch_A, numRows_A, numCols_A>, Layout_A, Accessor_A> A,
+  Triangle t,
+  DiagonalStorage d,
+  mdspan<ElementType_B, extents<SizeType_B, batch_B, numRows_B, numCols_B>, Layout_B, Accessor_B> B,
+  mdspan<ElementType_X, extents<SizeType_X, batch_X, numRows_X, numCols_X>, Layout_X, Accessor_X> X)
+{
+  // A solve costs about m^2 n flops, half of a product with inner
+  // dimension m.
+  const std::size_t m = X.extent(1);
+  auto block = [&] (std::size_t b0, std::size_t b1) {
+    batched_triangular_matrix_matrix_left_solve_block(A, t, d, B, X, b0, b1);
+  };
+  if constexpr (parallel_sliceable<decltype(A), decltype(B), decltype(X)>()) {
+    parallel_batch_blocks(exec.pool(), X.extent(0), m, X.extent(2), m / 2, block,
+      [&] (std::size_t b) {
+        linalg::triangular_matrix_matrix_left_solve(parallel_exec_t(exec),
+          batch_item(A, b), t, d, batch_item(B, b), batch_item(X, b));
+      });
+  }
+  else {
+    parallel_batch_blocks(exec.pool(), X.extent(0), m, X.extent(2), m / 2, block, nullptr);
+  }
+}
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_PARALLEL_HPP_
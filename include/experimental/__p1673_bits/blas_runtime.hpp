@@ -0,0 +1,289 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_RUNTIME_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_RUNTIME_HPP_
+
+#ifdef LINALG_ENABLE_BLAS
+
+#include <complex>
+#include <cstddef>
+
+#ifdef LINALG_ENABLE_BLAS_RUNTIME
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <dlfcn.h>
+#endif // LINALG_ENABLE_BLAS_RUNTIME
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// The BLAS routines that BlasRoutines wraps.
+enum class blas_routine : std::size_t {
+  gemm, gemv, symv, hemv, trsv, ger, geru, gerc,
+  syrk, herk, syr2k, her2k, trsm, count
+};
+
+} // end namespace impl
+
+#ifndef LINALG_ENABLE_BLAS_RUNTIME
+
+namespace impl {
+
+// The BLAS is linked in, so every routine is there.
+template<class Scalar>
+constexpr bool blas_available(blas_routine /* routine */)
+{
+  return true;
+}
+
+} // end namespace impl
+
+#else
+
+// With LINALG_ENABLE_BLAS_RUNTIME, this library doesn't link with a
+// BLAS.  Instead, the first BLAS call loads one or more BLAS shared
+// libraries with dlopen, and resolves each routine that BlasRoutines
+// uses from the first library (in order of preference) that has it.
+// Routines that no library has fall back to the generic
+// implementations.
+//
+// The libraries are, in order of preference,
+//
+// 1. the colon-separated list in the LINALG_BLAS_LIBRARY environment
+//    variable, if it is set (if it is empty, no BLAS gets loaded);
+// 2. otherwise, the first of a list of common BLAS implementations
+//    that dlopen finds.
+//
+// load_blas_library replaces the libraries at run time.
+
+namespace impl {
+
+inline constexpr std::size_t blas_routine_count =
+  static_cast<std::size_t>(blas_routine::count);
+
+template<class Scalar>
+inline constexpr std::size_t blas_scalar_index = 4;
+template<>
+inline constexpr std::size_t blas_scalar_index<float> = 0;
+template<>
+inline constexpr std::size_t blas_scalar_index<double> = 1;
+template<>
+inline constexpr std::size_t blas_scalar_index<std::complex<float>> = 2;
+template<>
+inline constexpr std::size_t blas_scalar_index<std::complex<double>> = 3;
+
+// The Fortran symbol of each routine, for float, double,
+// std::complex<float> and std::complex<double>.  As in BlasRoutines,
+// the real Hermitian routines are the symmetric ones, and the real
+// geru and gerc are ger.  The BLAS has no complex symv or ger.
+inline constexpr const char* blas_symbol_names[blas_routine_count][4] = {
+  {"sgemm_",  "dgemm_",  "cgemm_",  "zgemm_"},
+  {"sgemv_",  "dgemv_",  "cgemv_",  "zgemv_"},
+  {"ssymv_",  "dsymv_",  nullptr,   nullptr},
+  {"ssymv_",  "dsymv_",  "chemv_",  "zhemv_"},
+  {"strsv_",  "dtrsv_",  "ctrsv_",  "ztrsv_"},
+  {"sger_",   "dger_",   nullptr,   nullptr},
+  {"sger_",   "dger_",   "cgeru_",  "zgeru_"},
+  {"sger_",   "dger_",   "cgerc_",  "zgerc_"},
+  {"ssyrk_",  "dsyrk_",  "csyrk_",  "zsyrk_"},
+  {"ssyrk_",  "dsyrk_",  "cherk_",  "zherk_"},
+  {"ssyr2k_", "dsyr2k_", "csyr2k_", "zsyr2k_"},
+  {"ssyr2k_", "dsyr2k_", "cher2k_", "zher2k_"},
+  {"strsm_",  "dtrsm_",  "ctrsm_",  "ztrsm_"}
+};
+
+// Tried in this order if LINALG_BLAS_LIBRARY is not set.
+inline constexpr const char* blas_default_libraries[] = {
+  "libmkl_rt.so.2",
+  "libmkl_rt.so",
+  "libopenblas.so.0",
+  "libopenblas.so",
+  "libblis.so.4",
+  "libblis.so",
+  "libblas.so.3",
+  "libblas.so"
+};
+
+class blas_runtime {
+public:
+  static blas_runtime& instance() {
+    static blas_runtime runtime;
+    return runtime;
+  }
+
+  blas_runtime(const blas_runtime&) = delete;
+  blas_runtime& operator=(const blas_runtime&) = delete;
+
+  ~blas_runtime() {
+    unload();
+  }
+
+  void* function(blas_routine routine, std::size_t scalar_index) const {
+    return functions_[static_cast<std::size_t>(routine)][scalar_index];
+  }
+
+  // Loads the libraries in the colon-separated list paths, in order
+  // of preference.  Returns whether any routine was found.
+  bool load(std::string_view paths) {
+    unload();
+    while (! paths.empty()) {
+      const auto colon = paths.find(':');
+      const std::string path(paths.substr(0, colon));
+      paths = colon == std::string_view::npos ?
+        std::string_view{} : paths.substr(colon + 1);
+      if (! path.empty()) {
+        if (void* handle = ::dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL)) {
+          handles_.push_back(handle);
+        }
+      }
+    }
+    return resolve();
+  }
+
+  // Loads from LINALG_BLAS_LIBRARY, or else the first of
+  // blas_default_libraries that exists.
+  bool load_default() {
+    if (const char* paths = std::getenv("LINALG_BLAS_LIBRARY")) {
+      return load(paths);
+    }
+    for (const char* path : blas_default_libraries) {
+      if (load(path)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void unload() {
+    for (auto& row : functions_) {
+      for (auto& f : row) {
+        f = nullptr;
+      }
+    }
+    for (void* handle : handles_) {
+      ::dlclose(handle);
+    }
+    handles_.clear();
+  }
+
+private:
+  blas_runtime() {
+    load_default();
+  }
+
+  bool resolve() {
+    bool found = false;
+    for (std::size_t r = 0; r < blas_routine_count; ++r) {
+      for (std::size_t s = 0; s < 4; ++s) {
+        const char* name = blas_symbol_names[r][s];
+        void* f = nullptr;
+        for (std::size_t h = 0; name != nullptr && f == nullptr && h < handles_.size(); ++h) {
+          f = ::dlsym(handles_[h], name);
+        }
+        functions_[r][s] = f;
+        found = found || f != nullptr;
+      }
+    }
+    return found;
+  }
+
+  void* functions_[blas_routine_count][4] = {};
+  std::vector<void*> handles_;
+};
+
+template<class Scalar>
+bool blas_available(blas_routine routine)
+{
+  return blas_runtime::instance().function(routine, blas_scalar_index<Scalar>) != nullptr;
+}
+
+template<class Function, class Scalar>
+Function* blas_runtime_function(blas_routine routine)
+{
+  return reinterpret_cast<Function*>(
+    blas_runtime::instance().function(routine, blas_scalar_index<Scalar>));
+}
+
+} // end namespace impl
+
+// Replaces the runtime BLAS with the shared libraries in paths, a
+// colon-separated list in order of preference.  Returns whether they
+// have any of the BLAS routines that this library uses.  An empty
+// list unloads the BLAS.  This must not run concurrently with any
+// linear algebra function.
+inline bool load_blas_library(std::string_view paths)
+{
+  return impl::blas_runtime::instance().load(paths);
+}
+
+// Loads the BLAS as on first use: from LINALG_BLAS_LIBRARY if it is
+// set, else from the first common BLAS library found.
+inline bool load_default_blas_library()
+{
+  return impl::blas_runtime::instance().load_default();
+}
+
+// Unloads the runtime BLAS, so that all functions use their generic
+// implementations.  This must not run concurrently with any linear
+// algebra function.
+inline void unload_blas_library()
+{
+  impl::blas_runtime::instance().unload();
+}
+
+#endif // LINALG_ENABLE_BLAS_RUNTIME
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif // LINALG_ENABLE_BLAS
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_BLAS_RUNTIME_HPP_
@@ -0,0 +1,425 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_GEMM_ENGINE_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_GEMM_ENGINE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Goto / BLIS style matrix-matrix product engine.
+//
+// The product is computed by three nested cache-blocking loops.  A
+// KC x NC panel of B is packed once per (jc, pc) iteration so that it
+// stays in L3, an MC x KC block of A is packed so that it stays in L2,
+// and an MR x NR register tile of C is accumulated by the micro-kernel
+// from one MR-row sliver of the packed A and one NR-column sliver of
+// the packed B.  Packing reads the input matrices only through their
+// mdspan interface, so any layout and accessor works (scaled() and
+// conjugated() are applied for free while packing, straight from the
+// arrays behind them by decompose_accessor); the micro-kernel only
+// ever sees contiguous, zero-padded buffers.
+//
+// The block sizes follow the BLIS Haswell configuration for float and
+// double.  They are only tuning parameters: every value is correct.
+
+template<class T>
+struct gemm_blocking {
+  static constexpr std::size_t mr = 4;
+  static constexpr std::size_t nr = 4;
+  static constexpr std::size_t mc = 64;
+  static constexpr std::size_t kc = 256;
+  static constexpr std::size_t nc = 2048;
+};
+
+template<>
+struct gemm_blocking<double> {
+  static constexpr std::size_t mr = 6;
+  static constexpr std::size_t nr = 8;
+  static constexpr std::size_t mc = 72;
+  static constexpr std::size_t kc = 256;
+  static constexpr std::size_t nc = 4080;
+};
+
+template<>
+struct gemm_blocking<float> {
+  static constexpr std::size_t mr = 6;
+  static constexpr std::size_t nr = 16;
+  static constexpr std::size_t mc = 144;
+  static constexpr std::size_t kc = 256;
+  static constexpr std::size_t nc = 4080;
+};
+
+// The engine handles matrices whose value_type is one and the same
+// arithmetic type.  Everything else (complex, mixed precision, custom
+// number types) keeps the straightforward loops.  Half-precision types
+// may count as arithmetic (they are floating-point types under P1467),
+// but they are summed in float, by mixed_precision_gemm_eligible's
+// branch, whatever the size.
+template<class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t>
+constexpr bool packed_gemm_eligible()
+{
+  using value_type = typename out_matrix_t::value_type;
+  return std::is_arithmetic_v<value_type> && ! is_half_precision_v<value_type> &&
+    std::is_same_v<value_type, typename in_matrix_1_t::value_type> &&
+    std::is_same_v<value_type, typename in_matrix_2_t::value_type>;
+}
+
+// matrix_product also takes the engine for mixed precision: float or
+// double sums of inputs that widen to them exactly (float inputs for
+// a double C, half-precision inputs for a float or double C), and
+// half-precision C summed in float.  The inputs are converted once,
+// while packing, so the micro-kernel runs on the accumulation type
+// alone.
+template<class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t>
+constexpr bool mixed_precision_gemm_eligible()
+{
+  using accumulator_type = gemm_accumulator_t<typename out_matrix_t::value_type>;
+  return std::is_floating_point_v<accumulator_type> &&
+    is_widening_conversion_v<typename in_matrix_1_t::value_type, accumulator_type> &&
+    is_widening_conversion_v<typename in_matrix_2_t::value_type, accumulator_type>;
+}
+
+// Packing costs O(MK + KN) extra memory traffic; below roughly 24^3
+// multiply-adds the plain triple loop wins.
+inline bool packed_gemm_worthwhile(std::size_t m, std::size_t n, std::size_t k)
+{
+  return m >= 4 && n >= 4 && k >= 4 && m * n * k >= std::size_t(16384);
+}
+
+// Copy A(i_begin:i_end, k_begin:k_end) into MR-row slivers, each
+// stored k-major: buf[(sliver * kc + p) * MR + i].  Rows past i_end
+// are zero-filled so the micro-kernel never needs a remainder loop.
+template<class T, std::size_t MR, class in_matrix_t>
+void gemm_pack_a(const in_matrix_t& A,
+                 std::size_t i_begin, std::size_t i_end,
+                 std::size_t k_begin, std::size_t k_end,
+                 T* buf)
+{
+  const std::size_t kc = k_end - k_begin;
+  const auto A_elements = decompose_accessor(A);
+  for (std::size_t ir = i_begin; ir < i_end; ir += MR) {
+    const std::size_t mr = std::min(MR, i_end - ir);
+    for (std::size_t p = 0; p < kc; ++p) {
+      for (std::size_t i = 0; i < mr; ++i) {
+        buf[p * MR + i] = T(A_elements(ir + i, k_begin + p));
+      }
+      for (std::size_t i = mr; i < MR; ++i) {
+        buf[p * MR + i] = T{};
+      }
+    }
+    buf += kc * MR;
+  }
+}
+
+// Copy B(k_begin:k_end, j_begin:j_end) into NR-column slivers, each
+// stored k-major: buf[(sliver * kc + p) * NR + j].
+template<class T, std::size_t NR, class in_matrix_t>
+void gemm_pack_b(const in_matrix_t& B,
+                 std::size_t k_begin, std::size_t k_end,
+                 std::size_t j_begin, std::size_t j_end,
+                 T* buf)
+{
+  const std::size_t kc = k_end - k_begin;
+  const auto B_elements = decompose_accessor(B);
+  for (std::size_t jr = j_begin; jr < j_end; jr += NR) {
+    const std::size_t nr = std::min(NR, j_end - jr);
+    for (std::size_t p = 0; p < kc; ++p) {
+      for (std::size_t j = 0; j < nr; ++j) {
+        buf[p * NR + j] = T(B_elements(k_begin + p, jr + j));
+      }
+      for (std::size_t j = nr; j < NR; ++j) {
+        buf[p * NR + j] = T{};
+      }
+    }
+    buf += kc * NR;
+  }
+}
+
+// ab := a_sliver * b_sliver, for one MR x kc sliver of packed A and
+// one kc x NR sliver of packed B.  The fixed trip counts of the two
+// inner loops let the compiler keep ab in vector registers and unroll
+// the rank-1 updates into fused multiply-adds.
+template<class T, std::size_t MR, std::size_t NR>
+void gemm_micro_kernel(std::size_t kc, const T* a, const T* b, T (&ab)[MR][NR])
+{
+  for (std::size_t i = 0; i < MR; ++i) {
+    for (std::size_t j = 0; j < NR; ++j) {
+      ab[i][j] = T{};
+    }
+  }
+  for (std::size_t p = 0; p < kc; ++p) {
+    for (std::size_t i = 0; i < MR; ++i) {
+      const T a_ip = a[i];
+      for (std::size_t j = 0; j < NR; ++j) {
+        ab[i][j] += a_ip * b[j];
+      }
+    }
+    a += MR;
+    b += NR;
+  }
+}
+
+// Multiply one packed MC x KC block of A by one packed KC x NC panel
+// of B, and write the result into C(ic:ic+mc, jc:jc+nc).
+template<class T, std::size_t MR, std::size_t NR, class out_matrix_t>
+void gemm_macro_kernel(const T* a_packed, const T* b_packed,
+                       std::size_t kc,
+                       std::size_t ic, std::size_t mc,
+                       std::size_t jc, std::size_t nc,
+                       const out_matrix_t& C, T alpha, bool accumulate)
+{
+  T ab[MR][NR];
+  for (std::size_t jr = 0; jr < nc; jr += NR) {
+    const std::size_t nr = std::min(NR, nc - jr);
+    const T* b_sliver = b_packed + (jr / NR) * kc * NR;
+    for (std::size_t ir = 0; ir < mc; ir += MR) {
+      const std::size_t mr = std::min(MR, mc - ir);
+      const T* a_sliver = a_packed + (ir / MR) * kc * MR;
+      gemm_micro_kernel<T, MR, NR>(kc, a_sliver, b_sliver, ab);
+      if (accumulate) {
+        for (std::size_t j = 0; j < nr; ++j) {
+          for (std::size_t i = 0; i < mr; ++i) {
+            C(ic + ir + i, jc + jr + j) += alpha * ab[i][j];
+          }
+        }
+      }
+      else {
+        for (std::size_t j = 0; j < nr; ++j) {
+          for (std::size_t i = 0; i < mr; ++i) {
+            C(ic + ir + i, jc + jr + j) = alpha * ab[i][j];
+          }
+        }
+      }
+    }
+  }
+}
+
+// C(i, j) := (accumulate ? C(i, j) : 0) + alpha * sum_k A(i, k) * B(k, j)
+// for i in [i_begin, i_end), j in [j_begin, j_end), k in [k_begin, k_end).
+//
+// Row and column indices of C are the same as those of A and B
+// respectively, so callers can hand in sub-blocks of one larger
+// problem (as blocked triangular and rank-k algorithms do) without
+// making submdspans.
+template<class T, class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t>
+void packed_gemm(const in_matrix_1_t& A, const in_matrix_2_t& B, const out_matrix_t& C,
+                 T alpha, bool accumulate,
+                 std::size_t i_begin, std::size_t i_end,
+                 std::size_t j_begin, std::size_t j_end,
+                 std::size_t k_begin, std::size_t k_end)
+{
+  using blocking = gemm_blocking<T>;
+  constexpr std::size_t MR = blocking::mr;
+  constexpr std::size_t NR = blocking::nr;
+
+  if (i_begin >= i_end || j_begin >= j_end) {
+    return;
+  }
+  if (k_begin >= k_end) {
+    if (! accumulate) {
+      for (std::size_t j = j_begin; j < j_end; ++j) {
+        for (std::size_t i = i_begin; i < i_end; ++i) {
+          C(i,j) = T{};
+        }
+      }
+    }
+    return;
+  }
+
+  const std::size_t m = i_end - i_begin;
+  const std::size_t n = j_end - j_begin;
+  const std::size_t k = k_end - k_begin;
+  const std::size_t mc_max = std::min(blocking::mc, (m + MR - 1) / MR * MR);
+  const std::size_t nc_max = std::min(blocking::nc, (n + NR - 1) / NR * NR);
+  const std::size_t kc_max = std::min(blocking::kc, k);
+
+  std::vector<T> a_packed(mc_max * kc_max);
+  std::vector<T> b_packed(kc_max * nc_max);
+
+  for (std::size_t jc = j_begin; jc < j_end; jc += blocking::nc) {
+    const std::size_t nc = std::min(blocking::nc, j_end - jc);
+    for (std::size_t pc = k_begin; pc < k_end; pc += blocking::kc) {
+      const std::size_t kc = std::min(blocking::kc, k_end - pc);
+      gemm_pack_b<T, NR>(B, pc, pc + kc, jc, jc + nc, b_packed.data());
+      // Only the first KC panel may overwrite C.
+      const bool acc = accumulate || pc != k_begin;
+      for (std::size_t ic = i_begin; ic < i_end; ic += blocking::mc) {
+        const std::size_t mc = std::min(blocking::mc, i_end - ic);
+        gemm_pack_a<T, MR>(A, ic, ic + mc, pc, pc + kc, a_packed.data());
+        gemm_macro_kernel<T, MR, NR>(a_packed.data(), b_packed.data(), kc,
+                                     ic, mc, jc, nc, C, alpha, acc);
+      }
+    }
+  }
+}
+
+// C(i, j) += alpha * sum_k A(i, k) * B(k, j) for (i, j) in the
+// Triangle of the diagonal block [j_begin, j_end) x [j_begin, j_end)
+// of C, and k in [k_begin, k_end).  This is the diagonal-block kernel
+// of the symmetric and Hermitian rank-k and rank-2k updates.  Register
+// tiles entirely outside the triangle are skipped, and tiles that
+// straddle the diagonal only write their part inside it.
+template<class Triangle, class T, class in_matrix_1_t, class in_matrix_2_t,
+         class out_matrix_t>
+void packed_gemm_triangle(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                          const out_matrix_t& C, T alpha,
+                          std::size_t j_begin, std::size_t j_end,
+                          std::size_t k_begin, std::size_t k_end)
+{
+  using blocking = gemm_blocking<T>;
+  constexpr std::size_t MR = blocking::mr;
+  constexpr std::size_t NR = blocking::nr;
+  constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+
+  if (j_begin >= j_end || k_begin >= k_end) {
+    return;
+  }
+  const std::size_t n = j_end - j_begin;
+  const std::size_t kc_max = std::min(blocking::kc, k_end - k_begin);
+  std::vector<T> a_packed((n + MR - 1) / MR * MR * kc_max);
+  std::vector<T> b_packed((n + NR - 1) / NR * NR * kc_max);
+
+  T ab[MR][NR];
+  for (std::size_t pc = k_begin; pc < k_end; pc += blocking::kc) {
+    const std::size_t kc = std::min(blocking::kc, k_end - pc);
+    gemm_pack_a<T, MR>(A, j_begin, j_end, pc, pc + kc, a_packed.data());
+    gemm_pack_b<T, NR>(B, pc, pc + kc, j_begin, j_end, b_packed.data());
+    for (std::size_t jr = 0; jr < n; jr += NR) {
+      const std::size_t nr = std::min(NR, n - jr);
+      const T* b_sliver = b_packed.data() + (jr / NR) * kc * NR;
+      // Row slivers that reach the triangle in columns [jr, jr + nr)
+      const std::size_t ir_begin = lower ? jr / MR * MR : 0;
+      const std::size_t ir_end = lower ? n : std::min(n, jr + nr);
+      for (std::size_t ir = ir_begin; ir < ir_end; ir += MR) {
+        const std::size_t mr = std::min(MR, n - ir);
+        const T* a_sliver = a_packed.data() + (ir / MR) * kc * MR;
+        gemm_micro_kernel<T, MR, NR>(kc, a_sliver, b_sliver, ab);
+        for (std::size_t j = 0; j < nr; ++j) {
+          const std::size_t jj = jr + j;
+          const std::size_t i_begin = lower ? std::max(ir, jj) : ir;
+          const std::size_t i_end = lower ? ir + mr : std::min(ir + mr, jj + 1);
+          for (std::size_t ii = i_begin; ii < i_end; ++ii) {
+            C(j_begin + ii, j_begin + jj) += alpha * ab[ii - ir][j];
+          }
+        }
+      }
+    }
+  }
+}
+
+// C(i, j) += alpha * sum_k A(i, k) * B(k, j) for (i, j) in the
+// Triangle of the n x n matrix C, and k in [0, k_end).  C is cut into
+// column panels of gemm_triangle_panel_size.  Each panel's diagonal
+// tile goes through packed_gemm_triangle, and the rest of the panel's
+// triangle (below the tile for lower, above it for upper) through
+// packed_gemm.
+inline constexpr std::size_t gemm_triangle_panel_size = 256;
+
+template<class Triangle, class T, class in_matrix_1_t, class in_matrix_2_t,
+         class out_matrix_t>
+void packed_gemm_triangle_update(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                                 const out_matrix_t& C, T alpha, std::size_t k_end)
+{
+  const std::size_t n = C.extent(0);
+  for (std::size_t j0 = 0; j0 < n; j0 += gemm_triangle_panel_size) {
+    const std::size_t j1 = std::min(n, j0 + gemm_triangle_panel_size);
+    packed_gemm_triangle<Triangle>(A, B, C, alpha, j0, j1, 0, k_end);
+    if constexpr (std::is_same_v<Triangle, lower_triangle_t>) {
+      packed_gemm(A, B, C, alpha, /* accumulate = */ true, j1, n, j0, j1, 0, k_end);
+    }
+    else {
+      packed_gemm(A, B, C, alpha, /* accumulate = */ true, 0, j0, j0, j1, 0, k_end);
+    }
+  }
+}
+
+// Whole-matrix convenience form: C := (accumulate ? C : 0) + A * B.
+// A C narrower than its accumulation type is summed in a column-major
+// copy in that type, so that each element of C is rounded once rather
+// than once per KC panel.
+template<class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t>
+void packed_gemm(const in_matrix_1_t& A, const in_matrix_2_t& B, const out_matrix_t& C,
+                 bool accumulate)
+{
+  using value_type = typename out_matrix_t::value_type;
+  using accumulator_type = gemm_accumulator_t<value_type>;
+  const std::size_t m = C.extent(0);
+  const std::size_t n = C.extent(1);
+  if constexpr (std::is_same_v<accumulator_type, value_type>) {
+    packed_gemm(A, B, C, value_type(1), accumulate, 0, m, 0, n, 0, A.extent(1));
+  }
+  else {
+    std::vector<accumulator_type> buffer(m * n);
+    mdspan<accumulator_type, dextents<std::size_t, 2>, layout_left>
+      C_sum(buffer.data(), m, n);
+    if (accumulate) {
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          C_sum(i,j) = accumulator_type(C(i,j));
+        }
+      }
+    }
+    packed_gemm(A, B, C_sum, accumulator_type(1), accumulate, 0, m, 0, n, 0, A.extent(1));
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        C(i,j) = value_type(C_sum(i,j));
+      }
+    }
+  }
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_GEMM_ENGINE_HPP_
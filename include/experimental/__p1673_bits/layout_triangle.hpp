@@ -56,52 +56,45 @@ namespace linalg {
 
 namespace __triangular_layouts_impl {
 
-template <class, class, class, class, class, class>
-struct __lower_triangle_layout_impl;
-
-// FIXME work-around for #4.
-#if 0
-
-// lower triangular offsets are triangular numbers (n*(n+1)/2)
-template <
-  ptrdiff_t ExtLast, ptrdiff_t... Exts, class BaseMap, class LastTwoMap,
-  size_t... ExtIdxs, size_t... ExtMinus2Idxs
->
-struct __lower_triangle_layout_impl<
-  extents<Exts..., ExtLast, ExtLast>,
-  BaseMap, LastTwoMap,
-  std::integer_sequence<size_t, ExtIdxs...>,
-  std::integer_sequence<size_t, ExtMinus2Idxs...>
-> {
-
-private:
-
-  static constexpr auto __rank = sizeof...(Exts) + 2;
-
-  _MDSPAN_NO_UNIQUE_ADDRESS LastTwoMap _trimap;
-  _MDSPAN_NO_UNIQUE_ADDRESS BaseMap _base_map;
-
-public:
-
-
-  template <class... Integral>
-  MDSPAN_FORCE_INLINE_FUNCTION
-  constexpr ptrdiff_t operator()(Integral... idxs) const noexcept {
-    auto base_val = _base_map(
-      [&](size_t N) {
-        _MDSPAN_FOLD_PLUS_RIGHT(((ExtIdxs == N) ? idx : 0), /* + ... + */ 0)
-      }(ExtMinus2Idxs)...
-    );
-    auto triang_val = _trimap(
-      _MDSPAN_FOLD_PLUS_RIGHT(((ExtIdxs == __rank - 2) ? idx : 0), /* + ... + */ 0),
-      _MDSPAN_FOLD_PLUS_RIGHT(((ExtIdxs == __rank - 1) ? idx : 0), /* + ... + */ 0)
-    );
-    return base_val * triang_val;
+// Packed storage keeps one triangle of an n x n matrix as n "lines"
+// laid end to end: its columns if column major, or its rows if row
+// major.  Lines are "trailing" if they start at the diagonal (the
+// lower triangle in column-major order, or the upper triangle in
+// row-major order), and "leading" if they end at the diagonal.
+template <class Triangle, class StorageOrder>
+_MDSPAN_INLINE_VARIABLE constexpr bool __packed_lines_are_trailing =
+  std::is_same_v<Triangle, lower_triangle_t> ==
+  std::is_same_v<StorageOrder, column_major_t>;
+
+// Offset of the first element of line l.
+template <class Triangle, class StorageOrder, class IndexType>
+MDSPAN_INLINE_FUNCTION
+constexpr IndexType __packed_line_offset(IndexType n, IndexType l) noexcept {
+  if constexpr (__packed_lines_are_trailing<Triangle, StorageOrder>) {
+    // Lines 0, 1, ..., l-1 have lengths n, n-1, ..., n-l+1.
+    return l * n - (l * (l - IndexType(1))) / IndexType(2);
   }
-
-};
-
-#endif // 0  
+  else {
+    // Lines 0, 1, ..., l-1 have lengths 1, 2, ..., l.
+    return (l * (l + IndexType(1))) / IndexType(2);
+  }
+}
+
+// Offset of element (i, j) of the stored triangle.
+template <class Triangle, class StorageOrder, class IndexType>
+MDSPAN_INLINE_FUNCTION
+constexpr IndexType __packed_offset(IndexType n, IndexType i, IndexType j) noexcept {
+  constexpr bool column_major = std::is_same_v<StorageOrder, column_major_t>;
+  const IndexType line = column_major ? j : i;
+  const IndexType k = column_major ? i : j;
+  const IndexType start = __packed_line_offset<Triangle, StorageOrder>(n, line);
+  if constexpr (__packed_lines_are_trailing<Triangle, StorageOrder>) {
+    return start + (k - line);
+  }
+  else {
+    return start + k;
+  }
+}
 
 } // end namespace __triangular_layouts_impl
 
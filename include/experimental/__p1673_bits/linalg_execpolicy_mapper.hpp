@@ -41,7 +41,7 @@ inline constexpr bool is_custom_linalg_execution_policy_v =
 // unconstrained template parameters like ScaleFactorType in
 // algorithms like symmetric_matrix_rank_k_update.
 template<class T>
-inline constexpr bool is_linalg_execution_policy_other_than_inline_v =
+inline constexpr bool is_linalg_execution_policy_other_than_inline_value_v =
   ! is_inline_exec_v<T> &&
   (
 #if (! defined(__GNUC__)) || (__GNUC__ > 9)
@@ -50,6 +50,13 @@ inline constexpr bool is_linalg_execution_policy_other_than_inline_v =
     is_custom_linalg_execution_policy_v<T>
   );
 
+// ExecutionPolicy&& deduces a reference type for lvalue policies
+// like std::execution::par, so look through references and cv.
+template<class T>
+inline constexpr bool is_linalg_execution_policy_other_than_inline_v =
+  is_linalg_execution_policy_other_than_inline_value_v<
+    std::remove_cv_t<std::remove_reference_t<T>>>;
+
 } // namespace impl
 } // namespace linalg
 } // inline namespace __p1673_version_0
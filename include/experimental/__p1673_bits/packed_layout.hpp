@@ -46,32 +46,255 @@
 #include <mdspan/mdspan.hpp>
 #include "layout_triangle.hpp"
 
+#include <cstddef>
+#include <type_traits>
+
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
 inline namespace __p1673_version_0 {
 namespace linalg {
 
-// TODO declarations need extents-see-returns-below defined
+// Layout of a square matrix that stores only one triangle, in the
+// BLAS' packed format.  A(i,j) and A(j,i) both map to the one stored
+// element, so the mapping is not unique unless the matrix is 0 x 0
+// or 1 x 1.
+template <class Triangle, class StorageOrder>
+class layout_blas_packed {
+public:
+  using triangle_type = Triangle;
+  using storage_order_type = StorageOrder;
+
+  template <class Extents>
+  struct mapping {
+  public:
+    using extents_type = Extents;
+    using index_type = typename extents_type::index_type;
+    using size_type = typename extents_type::size_type;
+    using rank_type = typename extents_type::rank_type;
+    using layout_type = layout_blas_packed;
+
+    static_assert(extents_type::rank() == 2,
+      "layout_blas_packed only maps rank-2 extents.");
+    static_assert(extents_type::static_extent(0) == dynamic_extent ||
+                  extents_type::static_extent(1) == dynamic_extent ||
+                  extents_type::static_extent(0) == extents_type::static_extent(1),
+      "layout_blas_packed only maps square extents.");
+
+  private:
+    _MDSPAN_NO_UNIQUE_ADDRESS extents_type _extents{};
+
+    static constexpr bool __static_size_at_most_one() noexcept {
+      return (extents_type::static_extent(0) != dynamic_extent &&
+              extents_type::static_extent(0) < 2) ||
+             (extents_type::static_extent(1) != dynamic_extent &&
+              extents_type::static_extent(1) < 2);
+    }
+
+  public:
+    MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+    MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+    MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping& operator=(mapping const&) noexcept = default;
+
+    // Precondition: e.extent(0) == e.extent(1).
+    MDSPAN_INLINE_FUNCTION
+    constexpr mapping(extents_type const& e) noexcept // NOLINT(google-explicit-constructor)
+      : _extents(e)
+    { }
+
+    MDSPAN_TEMPLATE_REQUIRES(
+      class OtherExtents,
+      /* requires */ (_MDSPAN_TRAIT(std::is_convertible, OtherExtents, extents_type))
+    )
+    MDSPAN_INLINE_FUNCTION
+    constexpr mapping(mapping<OtherExtents> const& other) noexcept // NOLINT(google-explicit-constructor)
+      : _extents(other.extents())
+    { }
+
+    MDSPAN_TEMPLATE_REQUIRES(
+      class OtherExtents,
+      /* requires */ (
+        _MDSPAN_TRAIT(std::is_constructible, extents_type, OtherExtents) &&
+        ! _MDSPAN_TRAIT(std::is_convertible, OtherExtents, extents_type)
+      )
+    )
+    MDSPAN_INLINE_FUNCTION
+    constexpr explicit mapping(mapping<OtherExtents> const& other) noexcept
+      : _extents(other.extents())
+    { }
+
+    MDSPAN_INLINE_FUNCTION constexpr extents_type const& extents() const noexcept { return _extents; }
+
+    MDSPAN_INLINE_FUNCTION
+    constexpr index_type required_span_size() const noexcept {
+      const index_type n = _extents.extent(0);
+      return (n * (n + index_type(1))) / index_type(2);
+    }
+
+    // Indices outside the stored triangle map to their transpose.
+    MDSPAN_TEMPLATE_REQUIRES(
+      class Index0, class Index1,
+      /* requires */ (
+        _MDSPAN_TRAIT(std::is_convertible, Index0, index_type) &&
+        _MDSPAN_TRAIT(std::is_convertible, Index1, index_type)
+      )
+    )
+    MDSPAN_FORCE_INLINE_FUNCTION
+    constexpr index_type operator()(Index0 i_in, Index1 j_in) const noexcept {
+      const index_type i = static_cast<index_type>(i_in);
+      const index_type j = static_cast<index_type>(j_in);
+      constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+      const bool stored = lower ? i >= j : i <= j;
+      return __triangular_layouts_impl::__packed_offset<Triangle, StorageOrder>(
+        _extents.extent(0), stored ? i : j, stored ? j : i);
+    }
+
+    MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return __static_size_at_most_one(); }
+    MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept { return true; }
+    MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return __static_size_at_most_one(); }
+
+    MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return _extents.extent(0) < index_type(2); }
+    MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept { return true; }
+    MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return _extents.extent(0) < index_type(2); }
+
+    // Precondition: is_strided() is true.
+    MDSPAN_INLINE_FUNCTION
+    constexpr index_type stride(rank_type /* r */) const noexcept {
+      return index_type(1);
+    }
 
-#if 0
-template<class EltType,
-         class Extents,
-         class Layout,
-         class Accessor,
-         class Triangle,
-         class StorageOrder>
+    template<class OtherExtents>
+    MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator==(mapping const& a, mapping<OtherExtents> const& b) noexcept {
+      return a.extents() == b.extents();
+    }
+
+    template<class OtherExtents>
+    MDSPAN_INLINE_FUNCTION
+    friend constexpr bool operator!=(mapping const& a, mapping<OtherExtents> const& b) noexcept {
+      return ! (a.extents() == b.extents());
+    }
+  };
+};
+
+namespace impl {
+
+template<class Layout>
+struct is_layout_blas_packed : std::false_type {};
+
+template<class Triangle, class StorageOrder>
+struct is_layout_blas_packed<layout_blas_packed<Triangle, StorageOrder>> : std::true_type {};
+
+template<class Layout>
+inline constexpr bool is_layout_blas_packed_v = is_layout_blas_packed<Layout>::value;
+
+// True if in_matrix_t has a packed layout that stores Triangle, so
+// that an algorithm reading only that triangle can walk the packed
+// array directly.
+template<class in_matrix_t, class Triangle, class = void>
+struct stores_packed_triangle : std::false_type {};
+
+template<class in_matrix_t, class Triangle>
+struct stores_packed_triangle<in_matrix_t, Triangle,
+  std::enable_if_t<is_layout_blas_packed_v<typename in_matrix_t::layout_type>>>
+  : std::is_same<typename in_matrix_t::layout_type::triangle_type, Triangle> {};
+
+template<class in_matrix_t, class Triangle>
+inline constexpr bool stores_packed_triangle_v = stores_packed_triangle<in_matrix_t, Triangle>::value;
+
+// Line l of a packed n x n triangle (see __packed_lines_are_trailing):
+// the off-diagonal elements with "other" index k in [first, last)
+// sit at offset + (k - first), and the diagonal element at diagonal.
+// In a column-major line, k is the row index; in a row-major line, it
+// is the column index.
+template<class IndexType>
+struct packed_line {
+  IndexType first;
+  IndexType last;
+  std::size_t offset;
+  std::size_t diagonal;
+};
+
+template<class Triangle, class StorageOrder, class IndexType>
+constexpr packed_line<IndexType> packed_line_of(IndexType n, IndexType l) noexcept
+{
+  const std::size_t start = static_cast<std::size_t>(
+    __triangular_layouts_impl::__packed_line_offset<Triangle, StorageOrder>(n, l));
+  if constexpr (__triangular_layouts_impl::__packed_lines_are_trailing<Triangle, StorageOrder>) {
+    return {IndexType(l + IndexType(1)), n, start + std::size_t(1), start};
+  }
+  else {
+    return {IndexType(0), l, start, start + static_cast<std::size_t>(l)};
+  }
+}
+
+// A(i,j) += f(i,j) over A's stored triangle, walking A's packed array
+// from start to end.
+template<class inout_matrix_t, class Function>
+void packed_triangle_update(const inout_matrix_t& A, Function f)
+{
+  using layout_type = typename inout_matrix_t::layout_type;
+  using triangle_type = typename layout_type::triangle_type;
+  using storage_order_type = typename layout_type::storage_order_type;
+  using index_type = typename inout_matrix_t::index_type;
+  constexpr bool column_major = std::is_same_v<storage_order_type, column_major_t>;
+  constexpr bool trailing =
+    __triangular_layouts_impl::__packed_lines_are_trailing<triangle_type, storage_order_type>;
+
+  const index_type n = A.extent(0);
+  const auto& acc = A.accessor();
+  const auto p = A.data_handle();
+  for (index_type l = 0; l < n; ++l) {
+    const auto line = packed_line_of<triangle_type, storage_order_type>(n, l);
+    if constexpr (trailing) {
+      acc.access(p, line.diagonal) += f(l, l);
+    }
+    std::size_t offset = line.offset;
+    for (index_type k = line.first; k < line.last; ++k, ++offset) {
+      if constexpr (column_major) {
+        acc.access(p, offset) += f(k, l);
+      }
+      else {
+        acc.access(p, offset) += f(l, k);
+      }
+    }
+    if constexpr (! trailing) {
+      acc.access(p, line.diagonal) += f(l, l);
+    }
+  }
+}
+
+} // end namespace impl
+
+// View m's first num_rows * (num_rows + 1) / 2 elements as a
+// num_rows x num_rows matrix in packed storage.
+//
+// Preconditions: m.extent(0) >= num_rows * (num_rows + 1) / 2.
+MDSPAN_TEMPLATE_REQUIRES(
+  class EltType,
+  class Extents,
+  class Layout,
+  class Accessor,
+  class Triangle,
+  class StorageOrder,
+  /* requires */ (
+    Extents::rank() == 1 &&
+    (std::is_same_v<Layout, layout_left> || std::is_same_v<Layout, layout_right>)
+  )
+)
 constexpr mdspan<EltType,
-  <i>extents-see-returns-below</i>,
-  layout_blas_packed<
-    Triangle,
-    StorageOrder>,
+  dextents<typename Extents::index_type, 2>,
+  layout_blas_packed<Triangle, StorageOrder>,
   Accessor>
 packed(
   const mdspan<EltType, Extents, Layout, Accessor>& m,
   typename mdspan<EltType, Extents, Layout, Accessor>::index_type num_rows,
   Triangle,
-  StorageOrder);
-#endif // 0
+  StorageOrder)
+{
+  using extents_type = dextents<typename Extents::index_type, 2>;
+  using mapping_type = typename layout_blas_packed<Triangle, StorageOrder>::template mapping<extents_type>;
+  return {m.data_handle(), mapping_type(extents_type(num_rows, num_rows)), m.accessor()};
+}
 
 } // end namespace linalg
 } // end inline namespace __p1673_version_0
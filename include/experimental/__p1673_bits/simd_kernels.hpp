@@ -0,0 +1,1403 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_SIMD_KERNELS_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_SIMD_KERNELS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#if defined(__has_include) && __cplusplus > 202002L
+#  if __has_include(<stdfloat>)
+#    include <stdfloat>
+#  endif
+#endif
+
+// Explicitly vectorized kernels for the BLAS 1 algorithms, for
+// contiguous arrays of float, double, and their complex types, and
+// for the inner loops of the general and symmetric matrix-vector
+// products and the batched products and solves on float and double.
+// The general matrix-vector kernels also read matrices stored in a
+// narrower type (float for double sums, and the half-precision types
+// for float or double sums), converting each vector as it is loaded.
+//
+// The kernels are written once with the GCC / Clang vector extensions
+// and compiled for several instruction sets: the baseline of the
+// target (SSE2 on x86-64, NEON on AArch64), and on x86 also AVX2 and
+// AVX-512 through target attributes.  active_simd_isa() picks the
+// widest one that the CPU supports, once, at run time, so the library
+// needs no special compiler flags.  Other compilers get scalar loops
+// with the same independent accumulators.
+
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 12))
+#  define LINALG_SIMD_VECTOR_EXTENSIONS
+#  define LINALG_SIMD_ALWAYS_INLINE inline __attribute__((always_inline))
+#  if defined(__x86_64__) || defined(__i386__)
+#    define LINALG_SIMD_X86
+#    define LINALG_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#    define LINALG_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,f16c")))
+#  endif
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+enum class simd_isa { generic, avx2, avx512 };
+
+// The widest instruction set that the CPU supports.  Setting the
+// environment variable LINALG_SIMD to generic or avx2 caps it, for
+// testing and for comparing kernels.
+inline simd_isa detect_simd_isa() noexcept
+{
+  simd_isa isa = simd_isa::generic;
+#if defined(LINALG_SIMD_X86)
+  __builtin_cpu_init();
+  // Every CPU with AVX2 has F16C, but check anyway: the AVX2 and
+  // AVX-512 kernels use it to convert half-precision matrices.
+  const bool f16c = __builtin_cpu_supports("f16c");
+  if (f16c && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+    isa = simd_isa::avx512;
+  }
+  else if (f16c && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    isa = simd_isa::avx2;
+  }
+#endif
+  if (const char* env = std::getenv("LINALG_SIMD")) {
+    if (std::strcmp(env, "generic") == 0) {
+      isa = simd_isa::generic;
+    }
+    else if (std::strcmp(env, "avx2") == 0 && isa == simd_isa::avx512) {
+      isa = simd_isa::avx2;
+    }
+  }
+  return isa;
+}
+
+inline simd_isa active_simd_isa() noexcept
+{
+  static const simd_isa isa = detect_simd_isa();
+  return isa;
+}
+
+// The kernels take float or double arrays; complex arrays are read as
+// interleaved (real, imaginary) pairs, as [complex.numbers] allows.
+template<class T>
+struct simd_real { using type = T; };
+
+template<class T>
+struct simd_real<std::complex<T>> { using type = T; };
+
+template<class T>
+using simd_real_t = typename simd_real<T>::type;
+
+template<class T>
+const simd_real_t<T>* simd_real_data(const T* x) noexcept
+{
+  return reinterpret_cast<const simd_real_t<T>*>(x);
+}
+
+// The half-precision storage types that the compiler provides:
+// _Float16, and std::bfloat16_t where the standard library has it.
+template<class T>
+inline constexpr bool is_half_precision_v =
+#if defined(__FLT16_MAX__)
+  std::is_same_v<T, _Float16> ||
+#endif
+#if defined(__STDCPP_BFLOAT16_T__) && __cplusplus > 202002L
+  std::is_same_v<T, std::bfloat16_t> ||
+#endif
+  false;
+
+// Converting From to To is exact, and the kernels may do it: From is
+// To, float widening to double, or a half-precision type widening to
+// float or double.
+template<class From, class To>
+inline constexpr bool is_widening_conversion_v =
+  std::is_same_v<From, To> ||
+  (std::is_same_v<From, float> && std::is_same_v<To, double>) ||
+  (is_half_precision_v<From> &&
+   (std::is_same_v<To, float> || std::is_same_v<To, double>));
+
+// The type in which the GEMM engine and the static-extent kernels sum
+// for an output of type T: T itself, except that half-precision
+// outputs are summed in float and only rounded to T when written.
+template<class T>
+struct gemm_accumulator {
+  using type = std::conditional_t<is_half_precision_v<T>, float, T>;
+};
+
+template<class T>
+using gemm_accumulator_t = typename gemm_accumulator<T>::type;
+
+// Scalar version of the dot product kernels, for strided arrays and
+// for compilers without vector extensions: sum of conj^Conj(x_i) * y_i.
+// Four independent accumulators keep the loop from waiting on the
+// latency of each addition.
+template<bool Conj, class T>
+T strided_dot(std::size_t n, const T* x, std::ptrdiff_t incx,
+  const T* y, std::ptrdiff_t incy)
+{
+  auto term = [&] (std::size_t i) {
+    const T x_i = x[std::ptrdiff_t(i) * incx];
+    if constexpr (Conj) {
+      return T(conj_if_needed(x_i)) * y[std::ptrdiff_t(i) * incy];
+    }
+    else {
+      return x_i * y[std::ptrdiff_t(i) * incy];
+    }
+  };
+  T s0{}, s1{}, s2{}, s3{};
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += term(i);
+    s1 += term(i + 1);
+    s2 += term(i + 2);
+    s3 += term(i + 3);
+  }
+  for (; i < n; ++i) {
+    s0 += term(i);
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+
+// Blue's algorithm for the sum of squares, as in the LAPACK 3.10
+// xNRM2: magnitudes above tbig are scaled down by sbig and magnitudes
+// below tsml are scaled up by ssml before squaring, each class into
+// its own accumulator, so nothing overflows or underflows and no
+// element needs a division.  The thresholds and scaling factors are
+// powers of the radix, so scaling is exact.
+template<class T>
+struct blue_constants {
+private:
+  static constexpr T radix_power(int e)
+  {
+    T r(1);
+    const T b = e < 0 ? T(1) / T(std::numeric_limits<T>::radix) :
+      T(std::numeric_limits<T>::radix);
+    for (int k = 0; k < (e < 0 ? -e : e); ++k) {
+      r *= b;
+    }
+    return r;
+  }
+  static constexpr int floor_half(int e) { return e >= 0 ? e / 2 : -((1 - e) / 2); }
+  static constexpr int ceil_half(int e) { return -floor_half(-e); }
+
+  static constexpr int min_exp = std::numeric_limits<T>::min_exponent;
+  static constexpr int max_exp = std::numeric_limits<T>::max_exponent;
+  static constexpr int digits = std::numeric_limits<T>::digits;
+
+public:
+  static constexpr T tsml = radix_power(ceil_half(min_exp - 1));
+  static constexpr T tbig = radix_power(floor_half(max_exp - digits + 1));
+  static constexpr T ssml = radix_power(-floor_half(min_exp - digits));
+  static constexpr T sbig = radix_power(-ceil_half(max_exp + digits - 1));
+};
+
+// Sums of the squares of the small magnitudes (times ssml), medium
+// magnitudes, and big magnitudes (times sbig).
+template<class T>
+struct blue_sums {
+  T small{};
+  T medium{};
+  T big{};
+};
+
+template<class T>
+void blue_accumulate(blue_sums<T>& sums, T x)
+{
+  using c = blue_constants<T>;
+  const T a = x < T(0) ? -x : x;
+  if (a > c::tbig) {
+    sums.big += (a * c::sbig) * (a * c::sbig);
+  }
+  else if (a < c::tsml) {
+    sums.small += (a * c::ssml) * (a * c::ssml);
+  }
+  else {
+    sums.medium += a * a;
+  }
+}
+
+// The scaled sum of squares that sums stands for, as the pair
+// (scale, ssq) with scale^2 * ssq the sum of squares.  NaN and
+// infinity propagate.
+template<class T>
+std::pair<T, T> blue_combine(blue_sums<T> sums)
+{
+  using c = blue_constants<T>;
+  using std::sqrt;
+  const bool medium_counts = sums.medium > T(0) || sums.medium != sums.medium;
+  if (sums.big > T(0)) {
+    if (medium_counts) {
+      sums.big += (sums.medium * c::sbig) * c::sbig;
+    }
+    return {T(1) / c::sbig, sums.big};
+  }
+  if (sums.small > T(0)) {
+    if (! medium_counts) {
+      return {T(1) / c::ssml, sums.small};
+    }
+    const T medium = sqrt(sums.medium);
+    const T small = sqrt(sums.small) / c::ssml;
+    const T y_min = medium < small ? medium : small;
+    const T y_max = medium < small ? small : medium;
+    return {T(1), y_max * y_max * (T(1) + (y_min / y_max) * (y_min / y_max))};
+  }
+  return {T(1), sums.medium};
+}
+
+// Blue's sums for the n reals x[i * incx].
+template<class T>
+blue_sums<T> strided_blue_sums(std::size_t n, const T* x, std::ptrdiff_t incx)
+{
+  blue_sums<T> sums;
+  for (std::size_t i = 0; i < n; ++i) {
+    blue_accumulate(sums, x[std::ptrdiff_t(i) * incx]);
+  }
+  return sums;
+}
+
+// Index and magnitude of the first element of largest magnitude, as
+// found by the idx_abs_max kernels.  The magnitude is -1 if no
+// element compared greater than -1, which happens only if every
+// element is NaN (or there are none).
+template<class T>
+struct iamax_result {
+  std::size_t index;
+  T magnitude;
+};
+
+// Magnitude of the element that starts at x: scale * |x[0]| for
+// reals, or scale * (|x[0]| + |x[1]|) for complex numbers stored as
+// (real, imaginary) pairs, as in the BLAS ICAMAX and IZAMAX.  scale is
+// the absolute value of the accessor's scaling factor.  Scaling after
+// the sum leaves the compiler nothing to contract into an FMA, so
+// every kernel rounds each magnitude the same way.
+template<bool Complex, class T>
+T iamax_magnitude(const T* x, T scale)
+{
+  const T re = x[0] < T(0) ? -x[0] : x[0];
+  if constexpr (Complex) {
+    const T im = x[1] < T(0) ? -x[1] : x[1];
+    return scale * (re + im);
+  }
+  else {
+    return scale * re;
+  }
+}
+
+// First element of largest magnitude among the n elements that start
+// at x[i * incx * (Complex ? 2 : 1)].  NaN never compares greater, so
+// NaN elements are skipped.
+template<bool Complex, class T>
+iamax_result<T> strided_iamax(std::size_t n, const T* x, std::ptrdiff_t incx, T scale)
+{
+  constexpr std::ptrdiff_t reals = Complex ? 2 : 1;
+  iamax_result<T> best{0, T(-1)};
+  for (std::size_t i = 0; i < n; ++i) {
+    const T a = iamax_magnitude<Complex>(x + std::ptrdiff_t(i) * incx * reals, scale);
+    if (a > best.magnitude) {
+      best = {i, a};
+    }
+  }
+  return best;
+}
+
+// Scalar version of the plane rotation kernels, for strided arrays
+// and for compilers without vector extensions: for i in [0, n),
+// (x_i, y_i) := (c x_i + s y_i, c y_i - conj(s) x_i), where x_i is
+// x[i * incx] and y_i is y[i * incy].  s is real, or complex if T is.
+template<class T, class S>
+void strided_rot(std::size_t n, T* x, std::ptrdiff_t incx,
+  T* y, std::ptrdiff_t incy, simd_real_t<T> c, S s)
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    T& x_i = x[std::ptrdiff_t(i) * incx];
+    T& y_i = y[std::ptrdiff_t(i) * incy];
+    const T t = c * x_i + s * y_i;
+    y_i = c * y_i - conj_if_needed(s) * x_i;
+    x_i = t;
+  }
+}
+
+// Scalar versions of the matrix-vector product kernels, for complex
+// arrays and for compilers without vector extensions.  Rows (or
+// columns) r in [0, R) of the matrix start at a + r * lda, and their n
+// elements are contiguous.  The matrix elements are of type S, which
+// is T or converts to T without rounding (is_widening_conversion_v);
+// all arithmetic is in T.
+
+// s[r] = sum of a[r * lda + j] * x[j] over j in [0, n), for R rows.
+template<std::size_t R, class T, class S>
+void scalar_gemv_dot_rows(const S* a, std::size_t lda, const T* x,
+  std::size_t n, T* s)
+{
+  T acc[R] = {};
+  for (std::size_t j = 0; j < n; ++j) {
+    const T x_j = x[j];
+    for (std::size_t r = 0; r < R; ++r) {
+      acc[r] += T(a[r * lda + j]) * x_j;
+    }
+  }
+  for (std::size_t r = 0; r < R; ++r) {
+    s[r] = acc[r];
+  }
+}
+
+// y[i] += sum of c[q] * a[q * lda + i] over q in [0, C), for i in
+// [0, n): C columns at once, so that y is loaded and stored once.
+template<std::size_t C, class T, class S>
+void scalar_gemv_axpy_columns(const S* a, std::size_t lda, const T* c,
+  T* y, std::size_t n)
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    T t = y[i];
+    for (std::size_t q = 0; q < C; ++q) {
+      t += c[q] * T(a[q * lda + i]);
+    }
+    y[i] = t;
+  }
+}
+
+// y[i] += sum of c[q] * a[q * lda + i] over q in [0, C), and
+// t[q] = sum of a[q * lda + i] * x[i], for i in [0, n): the two halves
+// of the symmetric matrix-vector product for C columns of a symmetric
+// matrix's triangle, with each element read once.
+template<std::size_t C, class T>
+void scalar_symv_columns(const T* a, std::size_t lda, const T* c,
+  const T* x, T* y, std::size_t n, T* t)
+{
+  T acc[C] = {};
+  for (std::size_t i = 0; i < n; ++i) {
+    const T x_i = x[i];
+    T y_i = y[i];
+    for (std::size_t q = 0; q < C; ++q) {
+      const T a_qi = a[q * lda + i];
+      y_i += c[q] * a_qi;
+      acc[q] += a_qi * x_i;
+    }
+    y[i] = y_i;
+  }
+  for (std::size_t q = 0; q < C; ++q) {
+    t[q] = acc[q];
+  }
+}
+
+// c[i] += a[i] * b[i], or c[i] -= a[i] * b[i] if Subtract, for i in
+// [0, n): the inner loop of the batched products and solves of
+// batch-interleaved matrices.
+template<bool Subtract = false, class T>
+void scalar_multiply_add(const T* a, const T* b, T* c, std::size_t n)
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    if constexpr (Subtract) {
+      c[i] -= a[i] * b[i];
+    }
+    else {
+      c[i] += a[i] * b[i];
+    }
+  }
+}
+
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+
+// T vectors of the given size in bytes.  unaligned_type is for loading
+// straight from the arrays, which need only be aligned for T.
+template<class T, std::size_t Bytes>
+struct simd_vector {
+  typedef T type __attribute__((vector_size(Bytes)));
+  typedef T unaligned_type
+    __attribute__((vector_size(Bytes), aligned(alignof(T)), may_alias));
+};
+
+// v := Bytes / sizeof(T) contiguous elements of S from p, converted
+// to T.  v is an out parameter so that no vector is ever returned.
+template<class T, std::size_t Bytes, class S>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_load_converted(typename simd_vector<T, Bytes>::type& v, const S* p)
+{
+  if constexpr (std::is_same_v<S, T>) {
+    v = *reinterpret_cast<const typename simd_vector<T, Bytes>::unaligned_type*>(p);
+  }
+  else {
+    using narrow_type =
+      typename simd_vector<S, Bytes / sizeof(T) * sizeof(S)>::unaligned_type;
+    v = __builtin_convertvector(*reinterpret_cast<const narrow_type*>(p),
+                                typename simd_vector<T, Bytes>::type);
+  }
+}
+
+// The kernel bodies below are always inlined into the per-ISA entry
+// points, which compile them for that ISA.  They never pass vectors
+// across a function call, whose ABI would depend on the ISA.
+
+// Sum of x_i * y_i over n contiguous reals.
+template<class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE T simd_dot_real_body(const T* x, const T* y, std::size_t n)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  V s0{}, s1{}, s2{}, s3{};
+  std::size_t i = 0;
+  for (; i + 4 * W <= n; i += 4 * W) {
+    s0 += *reinterpret_cast<const U*>(x + i) * *reinterpret_cast<const U*>(y + i);
+    s1 += *reinterpret_cast<const U*>(x + i + W) * *reinterpret_cast<const U*>(y + i + W);
+    s2 += *reinterpret_cast<const U*>(x + i + 2 * W) * *reinterpret_cast<const U*>(y + i + 2 * W);
+    s3 += *reinterpret_cast<const U*>(x + i + 3 * W) * *reinterpret_cast<const U*>(y + i + 3 * W);
+  }
+  for (; i + W <= n; i += W) {
+    s0 += *reinterpret_cast<const U*>(x + i) * *reinterpret_cast<const U*>(y + i);
+  }
+  const V s = (s0 + s1) + (s2 + s3);
+  T sum{};
+  for (std::size_t lane = 0; lane < W; ++lane) {
+    sum += s[lane];
+  }
+  for (; i < n; ++i) {
+    sum += x[i] * y[i];
+  }
+  return sum;
+}
+
+// Sum of conj^Conj(x_i) * y_i over n contiguous complex numbers,
+// stored as 2n interleaved reals.  p accumulates the lane-wise
+// products (re x re, im x im) and q the products with y's real and
+// imaginary parts swapped (re x im, im x re); the real and imaginary
+// parts of the sum combine their even and odd lanes at the end.
+template<bool Conj, class T, std::size_t Bytes, std::size_t... Lane>
+LINALG_SIMD_ALWAYS_INLINE std::complex<T>
+simd_dot_complex_body(const T* x, const T* y, std::size_t n,
+  std::index_sequence<Lane...>)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+  const std::size_t len = 2 * n;
+
+  V p0{}, p1{}, q0{}, q1{};
+  std::size_t i = 0;
+  for (; i + 2 * W <= len; i += 2 * W) {
+    const V x0 = *reinterpret_cast<const U*>(x + i);
+    const V y0 = *reinterpret_cast<const U*>(y + i);
+    const V x1 = *reinterpret_cast<const U*>(x + i + W);
+    const V y1 = *reinterpret_cast<const U*>(y + i + W);
+    p0 += x0 * y0;
+    q0 += x0 * __builtin_shufflevector(y0, y0, (Lane ^ 1)...);
+    p1 += x1 * y1;
+    q1 += x1 * __builtin_shufflevector(y1, y1, (Lane ^ 1)...);
+  }
+  for (; i + W <= len; i += W) {
+    const V x0 = *reinterpret_cast<const U*>(x + i);
+    const V y0 = *reinterpret_cast<const U*>(y + i);
+    p0 += x0 * y0;
+    q0 += x0 * __builtin_shufflevector(y0, y0, (Lane ^ 1)...);
+  }
+  const V p = p0 + p1;
+  const V q = q0 + q1;
+  T re_re{}, im_im{}, re_im{}, im_re{};
+  for (std::size_t lane = 0; lane < W; lane += 2) {
+    re_re += p[lane];
+    im_im += p[lane + 1];
+    re_im += q[lane];
+    im_re += q[lane + 1];
+  }
+  for (; i < len; i += 2) {
+    re_re += x[i] * y[i];
+    im_im += x[i + 1] * y[i + 1];
+    re_im += x[i] * y[i + 1];
+    im_re += x[i + 1] * y[i];
+  }
+  if constexpr (Conj) {
+    return {re_re + im_im, re_im - im_re};
+  }
+  else {
+    return {re_re - im_im, re_im + im_re};
+  }
+}
+
+template<bool Conj, std::size_t Bytes, class T>
+LINALG_SIMD_ALWAYS_INLINE T simd_dot_body(const T* x, const T* y, std::size_t n)
+{
+  if constexpr (is_complex_v<T>) {
+    using real_t = simd_real_t<T>;
+    return simd_dot_complex_body<Conj, real_t, Bytes>(
+      simd_real_data(x), simd_real_data(y), n,
+      std::make_index_sequence<Bytes / sizeof(real_t)>{});
+  }
+  else {
+    return simd_dot_real_body<T, Bytes>(x, y, n);
+  }
+}
+
+// Blue's sums for n contiguous reals.  Each element goes to all three
+// accumulators, masked to zero in the two that it does not belong to,
+// so the loop has no branches.  Masking before squaring keeps the
+// unused squares from underflowing into slow subnormals.  NaN belongs
+// to the medium accumulator.
+template<class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE blue_sums<T> simd_blue_body(const T* x, std::size_t n)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  using c = blue_constants<T>;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  V small0{}, medium0{}, big0{}, small1{}, medium1{}, big1{};
+  // Compare against whole vectors; GCC splits 512-bit comparisons
+  // with a scalar operand into one scalar comparison per lane.
+  const V zero{};
+  const V tsml = zero + c::tsml;
+  const V tbig = zero + c::tbig;
+  std::size_t i = 0;
+  for (; i + 2 * W <= n; i += 2 * W) {
+    V a0 = *reinterpret_cast<const U*>(x + i);
+    V a1 = *reinterpret_cast<const U*>(x + i + W);
+    a0 = a0 < zero ? -a0 : a0;
+    a1 = a1 < zero ? -a1 : a1;
+    const V b0 = (a0 > tbig ? a0 : zero) * c::sbig;
+    const V b1 = (a1 > tbig ? a1 : zero) * c::sbig;
+    const V s0 = (a0 < tsml ? a0 : zero) * c::ssml;
+    const V s1 = (a1 < tsml ? a1 : zero) * c::ssml;
+    const V m0 = ((a0 > tbig) | (a0 < tsml)) ? zero : a0;
+    const V m1 = ((a1 > tbig) | (a1 < tsml)) ? zero : a1;
+    big0 += b0 * b0;
+    big1 += b1 * b1;
+    small0 += s0 * s0;
+    small1 += s1 * s1;
+    medium0 += m0 * m0;
+    medium1 += m1 * m1;
+  }
+  const V small = small0 + small1;
+  const V medium = medium0 + medium1;
+  const V big = big0 + big1;
+  blue_sums<T> sums;
+  for (std::size_t lane = 0; lane < W; ++lane) {
+    sums.small += small[lane];
+    sums.medium += medium[lane];
+    sums.big += big[lane];
+  }
+  for (; i < n; ++i) {
+    blue_accumulate(sums, x[i]);
+  }
+  return sums;
+}
+
+template<class T>
+blue_sums<T> simd_blue_generic(const T* x, std::size_t n)
+{
+  return simd_blue_body<T, 16>(x, n);
+}
+
+// Writes to out the W = Bytes / sizeof(T) magnitudes (see
+// iamax_magnitude) of the elements starting at element i of x.
+// Vectors go by reference, so that this never changes the ABI of a
+// call (it is inlined anyway).  For complex numbers, this
+// reads two vectors of (real, imaginary) pairs and adds their even
+// lanes to their odd lanes.
+template<bool Complex, class T, std::size_t Bytes, std::size_t... Lane>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_iamax_magnitudes(typename simd_vector<T, Bytes>::type& out,
+  const T* x, std::size_t i,
+  const typename simd_vector<T, Bytes>::type& scale,
+  std::index_sequence<Lane...>)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+  const V zero{};
+  if constexpr (Complex) {
+    V a = *reinterpret_cast<const U*>(x + 2 * i);
+    V b = *reinterpret_cast<const U*>(x + 2 * i + W);
+    a = a < zero ? -a : a;
+    b = b < zero ? -b : b;
+    out = scale * (__builtin_shufflevector(a, b, (2 * Lane)...) +
+      __builtin_shufflevector(a, b, (2 * Lane + 1)...));
+  }
+  else {
+    const V a = *reinterpret_cast<const U*>(x + i);
+    out = scale * (a < zero ? -a : a);
+  }
+}
+
+// idx_abs_max in two phases.  The first phase cuts x into blocks and
+// keeps a running maximum magnitude per lane within each block, with
+// two independent accumulators; only when a block's maximum beats
+// every earlier block's does it remember that block.  The second phase
+// scans just that block for the first element with the maximum
+// magnitude.  Comparing with > everywhere keeps the first of equal
+// magnitudes and skips NaN, as the scalar loop does.
+template<bool Complex, class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE iamax_result<T>
+simd_iamax_body(const T* x, std::size_t n, T scale)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+  constexpr std::size_t max_block = 32 * W;
+  constexpr std::ptrdiff_t reals = Complex ? 2 : 1;
+  const auto lanes = std::make_index_sequence<W>{};
+
+  const V zero{};
+  const V vscale = zero + scale;
+  const V none = zero - T(1);
+  iamax_result<T> best{0, T(-1)};
+  std::size_t best_block = n;
+  std::size_t i = 0;
+  while (n - i >= W) {
+    const std::size_t block_end = i + std::min(max_block, (n - i) / W * W);
+    V m0 = none;
+    V m1 = none;
+    std::size_t j = i;
+    for (; j + 2 * W <= block_end; j += 2 * W) {
+      V a0;
+      simd_iamax_magnitudes<Complex, T, Bytes>(a0, x, j, vscale, lanes);
+      V a1;
+      simd_iamax_magnitudes<Complex, T, Bytes>(a1, x, j + W, vscale, lanes);
+      m0 = a0 > m0 ? a0 : m0;
+      m1 = a1 > m1 ? a1 : m1;
+    }
+    if (j < block_end) {
+      V a0;
+      simd_iamax_magnitudes<Complex, T, Bytes>(a0, x, j, vscale, lanes);
+      m0 = a0 > m0 ? a0 : m0;
+    }
+    const V m = m1 > m0 ? m1 : m0;
+    T block_max = m[0];
+    for (std::size_t lane = 1; lane < W; ++lane) {
+      block_max = m[lane] > block_max ? m[lane] : block_max;
+    }
+    if (block_max > best.magnitude) {
+      best.magnitude = block_max;
+      best_block = i;
+    }
+    i = block_end;
+  }
+  // Rescan with the same vector code, so the maximum is sure to match.
+  for (std::size_t k = best_block; k + W <= n; k += W) {
+    V a;
+    simd_iamax_magnitudes<Complex, T, Bytes>(a, x, k, vscale, lanes);
+    std::size_t lane = 0;
+    while (lane < W && ! (a[lane] == best.magnitude)) {
+      ++lane;
+    }
+    if (lane < W) {
+      best.index = k + lane;
+      break;
+    }
+  }
+  for (; i < n; ++i) {
+    const T a = iamax_magnitude<Complex>(x + std::ptrdiff_t(i) * reals, scale);
+    if (a > best.magnitude) {
+      best = {i, a};
+    }
+  }
+  return best;
+}
+
+template<bool Complex, class T>
+iamax_result<T> simd_iamax_generic(const T* x, std::size_t n, T scale)
+{
+  return simd_iamax_body<Complex, T, 16>(x, n, scale);
+}
+
+// Plane rotation of n contiguous reals, with real c and s.  Complex
+// arrays with a real s are rotated as arrays of 2n reals.
+template<class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_rot_real_body(T* x, T* y, std::size_t n, T c, T s)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  const V vc = V{} + c;
+  const V vs = V{} + s;
+  std::size_t i = 0;
+  for (; i + 2 * W <= n; i += 2 * W) {
+    const V x0 = *reinterpret_cast<const U*>(x + i);
+    const V x1 = *reinterpret_cast<const U*>(x + i + W);
+    const V y0 = *reinterpret_cast<const U*>(y + i);
+    const V y1 = *reinterpret_cast<const U*>(y + i + W);
+    *reinterpret_cast<U*>(x + i) = vc * x0 + vs * y0;
+    *reinterpret_cast<U*>(x + i + W) = vc * x1 + vs * y1;
+    *reinterpret_cast<U*>(y + i) = vc * y0 - vs * x0;
+    *reinterpret_cast<U*>(y + i + W) = vc * y1 - vs * x1;
+  }
+  for (; i + W <= n; i += W) {
+    const V x0 = *reinterpret_cast<const U*>(x + i);
+    const V y0 = *reinterpret_cast<const U*>(y + i);
+    *reinterpret_cast<U*>(x + i) = vc * x0 + vs * y0;
+    *reinterpret_cast<U*>(y + i) = vc * y0 - vs * x0;
+  }
+  for (; i < n; ++i) {
+    const T t = c * x[i] + s * y[i];
+    y[i] = c * y[i] - s * x[i];
+    x[i] = t;
+  }
+}
+
+// Plane rotation of n contiguous complex numbers, stored as 2n
+// interleaved reals, with real c and complex s = sr + i si.  With
+// swap(v) exchanging the real and imaginary parts of each number and
+// a = (-si, si, -si, si, ...), s * y is sr y + a swap(y), and
+// conj(s) * x is sr x - a swap(x).  The sums are grouped as
+// std::complex groups them.
+template<class T, std::size_t Bytes, std::size_t... Lane>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_rot_complex_body(T* x, T* y, std::size_t n, T c, T sr, T si,
+  std::index_sequence<Lane...>)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  const V vc = V{} + c;
+  const V vsr = V{} + sr;
+  const V a{(Lane % 2 == 0 ? -si : si)...};
+  const std::size_t n_reals = 2 * n;
+  std::size_t i = 0;
+  for (; i + W <= n_reals; i += W) {
+    const V x0 = *reinterpret_cast<const U*>(x + i);
+    const V y0 = *reinterpret_cast<const U*>(y + i);
+    const V x0_swap = __builtin_shufflevector(x0, x0, (Lane ^ 1)...);
+    const V y0_swap = __builtin_shufflevector(y0, y0, (Lane ^ 1)...);
+    *reinterpret_cast<U*>(x + i) = vc * x0 + (vsr * y0 + a * y0_swap);
+    *reinterpret_cast<U*>(y + i) = vc * y0 - (vsr * x0 - a * x0_swap);
+  }
+  for (; i < n_reals; i += 2) {
+    const T xr = x[i], xi = x[i + 1];
+    const T yr = y[i], yi = y[i + 1];
+    x[i] = c * xr + (sr * yr - si * yi);
+    x[i + 1] = c * xi + (sr * yi + si * yr);
+    y[i] = c * yr - (sr * xr + si * xi);
+    y[i + 1] = c * yi - (sr * xi - si * xr);
+  }
+}
+
+// n_reals is the number of reals in each of x and y: n for real
+// arrays, 2n for complex arrays.
+template<bool ComplexS, class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_rot_body(T* x, T* y, std::size_t n_reals, T c, T sr, T si)
+{
+  if constexpr (ComplexS) {
+    simd_rot_complex_body<T, Bytes>(x, y, n_reals / 2, c, sr, si,
+      std::make_index_sequence<Bytes / sizeof(T)>{});
+  }
+  else {
+    (void) si;
+    simd_rot_real_body<T, Bytes>(x, y, n_reals, c, sr);
+  }
+}
+
+// s[r] = sum of a[r * lda + j] * x[j] over j in [0, n), for R rows
+// of n contiguous reals.  Each vector of x is loaded once for all R
+// rows.  The elements of a are of type S; see scalar_gemv_dot_rows.
+template<std::size_t R, class T, class S, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_gemv_dot_rows_body(const S* a, std::size_t lda, const T* x,
+  std::size_t n, T* s)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  V acc[R] = {};
+  std::size_t j = 0;
+  for (; j + W <= n; j += W) {
+    const V x_j = *reinterpret_cast<const U*>(x + j);
+    for (std::size_t r = 0; r < R; ++r) {
+      V a_rj;
+      simd_load_converted<T, Bytes>(a_rj, a + r * lda + j);
+      acc[r] += a_rj * x_j;
+    }
+  }
+  for (std::size_t r = 0; r < R; ++r) {
+    T sum{};
+    for (std::size_t lane = 0; lane < W; ++lane) {
+      sum += acc[r][lane];
+    }
+    for (std::size_t jj = j; jj < n; ++jj) {
+      sum += T(a[r * lda + jj]) * x[jj];
+    }
+    s[r] = sum;
+  }
+}
+
+// y[i] += sum of c[q] * a[q * lda + i] over q in [0, C), for i in
+// [0, n), with C columns of n contiguous elements of S.
+template<std::size_t C, class T, class S, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_gemv_axpy_columns_body(const S* a, std::size_t lda, const T* c,
+  T* y, std::size_t n)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  V vc[C];
+  for (std::size_t q = 0; q < C; ++q) {
+    vc[q] = V{} + c[q];
+  }
+  std::size_t i = 0;
+  for (; i + W <= n; i += W) {
+    V t = *reinterpret_cast<const U*>(y + i);
+    for (std::size_t q = 0; q < C; ++q) {
+      V a_qi;
+      simd_load_converted<T, Bytes>(a_qi, a + q * lda + i);
+      t += vc[q] * a_qi;
+    }
+    *reinterpret_cast<U*>(y + i) = t;
+  }
+  for (; i < n; ++i) {
+    T t = y[i];
+    for (std::size_t q = 0; q < C; ++q) {
+      t += c[q] * T(a[q * lda + i]);
+    }
+    y[i] = t;
+  }
+}
+
+// See scalar_multiply_add.
+template<bool Subtract, class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_multiply_add_body(const T* a, const T* b, T* c, std::size_t n)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  std::size_t i = 0;
+  for (; i + 2 * W <= n; i += 2 * W) {
+    const V ab0 = *reinterpret_cast<const U*>(a + i) * *reinterpret_cast<const U*>(b + i);
+    const V ab1 = *reinterpret_cast<const U*>(a + i + W) * *reinterpret_cast<const U*>(b + i + W);
+    if constexpr (Subtract) {
+      *reinterpret_cast<U*>(c + i) = *reinterpret_cast<const U*>(c + i) - ab0;
+      *reinterpret_cast<U*>(c + i + W) = *reinterpret_cast<const U*>(c + i + W) - ab1;
+    }
+    else {
+      *reinterpret_cast<U*>(c + i) = *reinterpret_cast<const U*>(c + i) + ab0;
+      *reinterpret_cast<U*>(c + i + W) = *reinterpret_cast<const U*>(c + i + W) + ab1;
+    }
+  }
+  scalar_multiply_add<Subtract>(a + i, b + i, c + i, n - i);
+}
+
+template<bool Subtract, class T>
+void simd_multiply_add_generic(const T* a, const T* b, T* c, std::size_t n)
+{
+  simd_multiply_add_body<Subtract, T, 16>(a, b, c, n);
+}
+
+// See scalar_symv_columns; C columns of n contiguous reals.
+template<std::size_t C, class T, std::size_t Bytes>
+LINALG_SIMD_ALWAYS_INLINE void
+simd_symv_columns_body(const T* a, std::size_t lda, const T* c,
+  const T* x, T* y, std::size_t n, T* t)
+{
+  using V = typename simd_vector<T, Bytes>::type;
+  using U = typename simd_vector<T, Bytes>::unaligned_type;
+  constexpr std::size_t W = Bytes / sizeof(T);
+
+  V vc[C];
+  V acc[C] = {};
+  for (std::size_t q = 0; q < C; ++q) {
+    vc[q] = V{} + c[q];
+  }
+  std::size_t i = 0;
+  for (; i + W <= n; i += W) {
+    const V x_i = *reinterpret_cast<const U*>(x + i);
+    V y_i = *reinterpret_cast<const U*>(y + i);
+    for (std::size_t q = 0; q < C; ++q) {
+      const V a_qi = *reinterpret_cast<const U*>(a + q * lda + i);
+      y_i += vc[q] * a_qi;
+      acc[q] += a_qi * x_i;
+    }
+    *reinterpret_cast<U*>(y + i) = y_i;
+  }
+  T sum[C];
+  for (std::size_t q = 0; q < C; ++q) {
+    sum[q] = T{};
+    for (std::size_t lane = 0; lane < W; ++lane) {
+      sum[q] += acc[q][lane];
+    }
+  }
+  for (; i < n; ++i) {
+    T y_i = y[i];
+    for (std::size_t q = 0; q < C; ++q) {
+      const T a_qi = a[q * lda + i];
+      y_i += c[q] * a_qi;
+      sum[q] += a_qi * x[i];
+    }
+    y[i] = y_i;
+  }
+  for (std::size_t q = 0; q < C; ++q) {
+    t[q] = sum[q];
+  }
+}
+
+template<std::size_t C, class T>
+void simd_symv_columns_generic(const T* a, std::size_t lda, const T* c,
+  const T* x, T* y, std::size_t n, T* t)
+{
+  simd_symv_columns_body<C, T, 16>(a, lda, c, x, y, n, t);
+}
+
+template<std::size_t R, class T, class S>
+void simd_gemv_dot_rows_generic(const S* a, std::size_t lda, const T* x,
+  std::size_t n, T* s)
+{
+  simd_gemv_dot_rows_body<R, T, S, 16>(a, lda, x, n, s);
+}
+
+template<std::size_t C, class T, class S>
+void simd_gemv_axpy_columns_generic(const S* a, std::size_t lda, const T* c,
+  T* y, std::size_t n)
+{
+  simd_gemv_axpy_columns_body<C, T, S, 16>(a, lda, c, y, n);
+}
+
+template<bool ComplexS, class T>
+void simd_rot_generic(T* x, T* y, std::size_t n_reals, T c, T sr, T si)
+{
+  simd_rot_body<ComplexS, T, 16>(x, y, n_reals, c, sr, si);
+}
+
+template<bool Conj, class T>
+T simd_dot_generic(const T* x, const T* y, std::size_t n)
+{
+  return simd_dot_body<Conj, 16>(x, y, n);
+}
+
+#if defined(LINALG_SIMD_X86)
+template<bool Conj, class T>
+LINALG_SIMD_TARGET_AVX2 T simd_dot_avx2(const T* x, const T* y, std::size_t n)
+{
+  return simd_dot_body<Conj, 32>(x, y, n);
+}
+
+template<bool Conj, class T>
+LINALG_SIMD_TARGET_AVX512 T simd_dot_avx512(const T* x, const T* y, std::size_t n)
+{
+  return simd_dot_body<Conj, 64>(x, y, n);
+}
+
+template<class T>
+LINALG_SIMD_TARGET_AVX2 blue_sums<T> simd_blue_avx2(const T* x, std::size_t n)
+{
+  return simd_blue_body<T, 32>(x, n);
+}
+
+template<class T>
+LINALG_SIMD_TARGET_AVX512 blue_sums<T> simd_blue_avx512(const T* x, std::size_t n)
+{
+  return simd_blue_body<T, 64>(x, n);
+}
+
+template<bool Complex, class T>
+LINALG_SIMD_TARGET_AVX2 iamax_result<T> simd_iamax_avx2(const T* x, std::size_t n, T scale)
+{
+  return simd_iamax_body<Complex, T, 32>(x, n, scale);
+}
+
+template<bool Complex, class T>
+LINALG_SIMD_TARGET_AVX512 iamax_result<T> simd_iamax_avx512(const T* x, std::size_t n, T scale)
+{
+  return simd_iamax_body<Complex, T, 64>(x, n, scale);
+}
+
+template<bool ComplexS, class T>
+LINALG_SIMD_TARGET_AVX2 void
+simd_rot_avx2(T* x, T* y, std::size_t n_reals, T c, T sr, T si)
+{
+  simd_rot_body<ComplexS, T, 32>(x, y, n_reals, c, sr, si);
+}
+
+template<bool ComplexS, class T>
+LINALG_SIMD_TARGET_AVX512 void
+simd_rot_avx512(T* x, T* y, std::size_t n_reals, T c, T sr, T si)
+{
+  simd_rot_body<ComplexS, T, 64>(x, y, n_reals, c, sr, si);
+}
+
+template<std::size_t R, class T, class S>
+LINALG_SIMD_TARGET_AVX2 void
+simd_gemv_dot_rows_avx2(const S* a, std::size_t lda, const T* x, std::size_t n, T* s)
+{
+  simd_gemv_dot_rows_body<R, T, S, 32>(a, lda, x, n, s);
+}
+
+template<std::size_t R, class T, class S>
+LINALG_SIMD_TARGET_AVX512 void
+simd_gemv_dot_rows_avx512(const S* a, std::size_t lda, const T* x, std::size_t n, T* s)
+{
+  simd_gemv_dot_rows_body<R, T, S, 64>(a, lda, x, n, s);
+}
+
+template<std::size_t C, class T, class S>
+LINALG_SIMD_TARGET_AVX2 void
+simd_gemv_axpy_columns_avx2(const S* a, std::size_t lda, const T* c, T* y, std::size_t n)
+{
+  simd_gemv_axpy_columns_body<C, T, S, 32>(a, lda, c, y, n);
+}
+
+template<std::size_t C, class T, class S>
+LINALG_SIMD_TARGET_AVX512 void
+simd_gemv_axpy_columns_avx512(const S* a, std::size_t lda, const T* c, T* y, std::size_t n)
+{
+  simd_gemv_axpy_columns_body<C, T, S, 64>(a, lda, c, y, n);
+}
+
+template<bool Subtract, class T>
+LINALG_SIMD_TARGET_AVX2 void
+simd_multiply_add_avx2(const T* a, const T* b, T* c, std::size_t n)
+{
+  simd_multiply_add_body<Subtract, T, 32>(a, b, c, n);
+}
+
+template<bool Subtract, class T>
+LINALG_SIMD_TARGET_AVX512 void
+simd_multiply_add_avx512(const T* a, const T* b, T* c, std::size_t n)
+{
+  simd_multiply_add_body<Subtract, T, 64>(a, b, c, n);
+}
+
+template<std::size_t C, class T>
+LINALG_SIMD_TARGET_AVX2 void
+simd_symv_columns_avx2(const T* a, std::size_t lda, const T* c,
+  const T* x, T* y, std::size_t n, T* t)
+{
+  simd_symv_columns_body<C, T, 32>(a, lda, c, x, y, n, t);
+}
+
+template<std::size_t C, class T>
+LINALG_SIMD_TARGET_AVX512 void
+simd_symv_columns_avx512(const T* a, std::size_t lda, const T* c,
+  const T* x, T* y, std::size_t n, T* t)
+{
+  simd_symv_columns_body<C, T, 64>(a, lda, c, x, y, n, t);
+}
+#endif
+
+#endif // LINALG_SIMD_VECTOR_EXTENSIONS
+
+// Sum of conj^Conj(x_i) * y_i for i in [0, n), where x_i is
+// x[i * incx] and y_i is y[i * incy], using the kernel for isa.
+template<bool Conj, class T>
+T simd_dot(simd_isa isa, std::size_t n,
+  const T* x, std::ptrdiff_t incx, const T* y, std::ptrdiff_t incy)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if (incx == 1 && incy == 1) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_dot_avx512<Conj>(x, y, n);
+    case simd_isa::avx2:
+      return simd_dot_avx2<Conj>(x, y, n);
+#endif
+    default:
+      return simd_dot_generic<Conj>(x, y, n);
+    }
+  }
+#else
+  (void) isa;
+#endif
+  return strided_dot<Conj>(n, x, incx, y, incy);
+}
+
+template<bool Conj, class T>
+T simd_dot(std::size_t n,
+  const T* x, std::ptrdiff_t incx, const T* y, std::ptrdiff_t incy)
+{
+  return simd_dot<Conj>(active_simd_isa(), n, x, incx, y, incy);
+}
+
+// Blue's sums for the n reals x[i * incx], using the kernel for isa.
+template<class T>
+blue_sums<T> simd_blue_sums(simd_isa isa, std::size_t n,
+  const T* x, std::ptrdiff_t incx)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if (incx == 1) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_blue_avx512(x, n);
+    case simd_isa::avx2:
+      return simd_blue_avx2(x, n);
+#endif
+    default:
+      return simd_blue_generic(x, n);
+    }
+  }
+#else
+  (void) isa;
+#endif
+  return strided_blue_sums(n, x, incx);
+}
+
+template<class T>
+blue_sums<T> simd_blue_sums(std::size_t n, const T* x, std::ptrdiff_t incx)
+{
+  return simd_blue_sums(active_simd_isa(), n, x, incx);
+}
+
+// First element of largest magnitude (see iamax_magnitude) among the
+// n elements that start at x[i * incx * (Complex ? 2 : 1)], using the
+// kernel for isa.
+template<bool Complex, class T>
+iamax_result<T> simd_iamax(simd_isa isa, std::size_t n,
+  const T* x, std::ptrdiff_t incx, T scale)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if (incx == 1) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_iamax_avx512<Complex>(x, n, scale);
+    case simd_isa::avx2:
+      return simd_iamax_avx2<Complex>(x, n, scale);
+#endif
+    default:
+      return simd_iamax_generic<Complex>(x, n, scale);
+    }
+  }
+#else
+  (void) isa;
+#endif
+  return strided_iamax<Complex>(n, x, incx, scale);
+}
+
+template<bool Complex, class T>
+iamax_result<T> simd_iamax(std::size_t n, const T* x, std::ptrdiff_t incx, T scale)
+{
+  return simd_iamax<Complex>(active_simd_isa(), n, x, incx, scale);
+}
+
+// Plane rotation (x_i, y_i) := (c x_i + s y_i, c y_i - conj(s) x_i)
+// for i in [0, n), where x_i is x[i * incx] and y_i is y[i * incy],
+// using the kernel for isa.  s is real, or complex if T is.
+template<class T, class S>
+void simd_rot(simd_isa isa, std::size_t n, T* x, std::ptrdiff_t incx,
+  T* y, std::ptrdiff_t incy, simd_real_t<T> c, S s)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if (incx == 1 && incy == 1) {
+    using real_t = simd_real_t<T>;
+    constexpr bool complex_s = ! std::is_same_v<S, real_t>;
+    real_t* xr = reinterpret_cast<real_t*>(x);
+    real_t* yr = reinterpret_cast<real_t*>(y);
+    const std::size_t n_reals = std::is_same_v<T, real_t> ? n : 2 * n;
+    real_t sr, si;
+    if constexpr (complex_s) {
+      sr = s.real();
+      si = s.imag();
+    }
+    else {
+      sr = s;
+      si = real_t(0);
+    }
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_rot_avx512<complex_s>(xr, yr, n_reals, c, sr, si);
+    case simd_isa::avx2:
+      return simd_rot_avx2<complex_s>(xr, yr, n_reals, c, sr, si);
+#endif
+    default:
+      return simd_rot_generic<complex_s>(xr, yr, n_reals, c, sr, si);
+    }
+  }
+#else
+  (void) isa;
+#endif
+  strided_rot(n, x, incx, y, incy, c, s);
+}
+
+template<class T, class S>
+void simd_rot(std::size_t n, T* x, std::ptrdiff_t incx,
+  T* y, std::ptrdiff_t incy, simd_real_t<T> c, S s)
+{
+  simd_rot(active_simd_isa(), n, x, incx, y, incy, c, s);
+}
+
+// s[r] = sum of a[r * lda + j] * x[j] over j in [0, n), for R rows
+// of a matrix with contiguous rows, using the kernel for isa.  The
+// vector kernels take float and double, with a stored in T or in a
+// type that widens to T; complex numbers go through the scalar kernel.
+template<std::size_t R, class T, class S>
+void simd_gemv_dot_rows(simd_isa isa, const S* a, std::size_t lda,
+  const T* x, std::size_t n, T* s)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if constexpr (std::is_floating_point_v<T> && is_widening_conversion_v<S, T>) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_gemv_dot_rows_avx512<R>(a, lda, x, n, s);
+    case simd_isa::avx2:
+      return simd_gemv_dot_rows_avx2<R>(a, lda, x, n, s);
+#endif
+    default:
+      return simd_gemv_dot_rows_generic<R>(a, lda, x, n, s);
+    }
+  }
+#endif
+  (void) isa;
+  scalar_gemv_dot_rows<R>(a, lda, x, n, s);
+}
+
+template<std::size_t R, class T, class S>
+void simd_gemv_dot_rows(const S* a, std::size_t lda,
+  const T* x, std::size_t n, T* s)
+{
+  simd_gemv_dot_rows<R>(active_simd_isa(), a, lda, x, n, s);
+}
+
+// y[i] += sum of c[q] * a[q * lda + i] over q in [0, C), for i in
+// [0, n), with C columns of a matrix with contiguous columns, using
+// the kernel for isa.
+template<std::size_t C, class T, class S>
+void simd_gemv_axpy_columns(simd_isa isa, const S* a, std::size_t lda,
+  const T* c, T* y, std::size_t n)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if constexpr (std::is_floating_point_v<T> && is_widening_conversion_v<S, T>) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_gemv_axpy_columns_avx512<C>(a, lda, c, y, n);
+    case simd_isa::avx2:
+      return simd_gemv_axpy_columns_avx2<C>(a, lda, c, y, n);
+#endif
+    default:
+      return simd_gemv_axpy_columns_generic<C>(a, lda, c, y, n);
+    }
+  }
+#endif
+  (void) isa;
+  scalar_gemv_axpy_columns<C>(a, lda, c, y, n);
+}
+
+template<std::size_t C, class T, class S>
+void simd_gemv_axpy_columns(const S* a, std::size_t lda,
+  const T* c, T* y, std::size_t n)
+{
+  simd_gemv_axpy_columns<C>(active_simd_isa(), a, lda, c, y, n);
+}
+
+// See scalar_symv_columns; uses the kernel for isa.
+template<std::size_t C, class T>
+void simd_symv_columns(simd_isa isa, const T* a, std::size_t lda,
+  const T* c, const T* x, T* y, std::size_t n, T* t)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if constexpr (std::is_floating_point_v<T>) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_symv_columns_avx512<C>(a, lda, c, x, y, n, t);
+    case simd_isa::avx2:
+      return simd_symv_columns_avx2<C>(a, lda, c, x, y, n, t);
+#endif
+    default:
+      return simd_symv_columns_generic<C>(a, lda, c, x, y, n, t);
+    }
+  }
+#endif
+  (void) isa;
+  scalar_symv_columns<C>(a, lda, c, x, y, n, t);
+}
+
+template<std::size_t C, class T>
+void simd_symv_columns(const T* a, std::size_t lda,
+  const T* c, const T* x, T* y, std::size_t n, T* t)
+{
+  simd_symv_columns<C>(active_simd_isa(), a, lda, c, x, y, n, t);
+}
+
+// See scalar_multiply_add; uses the kernel for isa.
+template<bool Subtract = false, class T>
+void simd_multiply_add(simd_isa isa, const T* a, const T* b, T* c, std::size_t n)
+{
+#if defined(LINALG_SIMD_VECTOR_EXTENSIONS)
+  if constexpr (std::is_floating_point_v<T>) {
+    switch (isa) {
+#if defined(LINALG_SIMD_X86)
+    case simd_isa::avx512:
+      return simd_multiply_add_avx512<Subtract>(a, b, c, n);
+    case simd_isa::avx2:
+      return simd_multiply_add_avx2<Subtract>(a, b, c, n);
+#endif
+    default:
+      return simd_multiply_add_generic<Subtract>(a, b, c, n);
+    }
+  }
+#endif
+  (void) isa;
+  scalar_multiply_add<Subtract>(a, b, c, n);
+}
+
+template<bool Subtract = false, class T>
+void simd_multiply_add(const T* a, const T* b, T* c, std::size_t n)
+{
+  simd_multiply_add<Subtract>(active_simd_isa(), a, b, c, n);
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_SIMD_KERNELS_HPP_
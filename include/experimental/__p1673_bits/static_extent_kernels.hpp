@@ -0,0 +1,289 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_STATIC_EXTENT_KERNELS_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_STATIC_EXTENT_KERNELS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Fully unrolled kernels for operands whose extents are all known at
+// compile time and small, such as the 3 x 3 and 4 x 4 matrices of
+// per-particle transforms.  The loops over the extents become
+// index_sequence folds, so each element access has a constant offset,
+// the results are kept in local arrays (registers) until they are all
+// computed, and no loop or dispatch overhead remains.  The kernels
+// compute the same sums, in the same order, as the algorithms' generic
+// loops, and access the elements through the mdspans, so they work
+// for every layout and accessor.
+//
+// The kernels are flattened, so that every call in them, down to the
+// element accesses, is inlined whatever the compiler's inlining
+// heuristics would decide for the nested lambdas.
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define LINALG_STATIC_KERNEL_FLATTEN __attribute__((flatten))
+#else
+#  define LINALG_STATIC_KERNEL_FLATTEN
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+// Largest static extent that gets an unrolled kernel, and the most
+// multiply-adds that one unrolled kernel may contain.  The second
+// bounds the code size: a 16 x 16 matrix-vector product is 256
+// multiply-adds, an 8 x 8 matrix-matrix product is 512.
+inline constexpr std::size_t static_kernel_max_extent = 16;
+inline constexpr std::size_t static_kernel_max_work = 1024;
+
+template<class Extents>
+constexpr bool small_static_extents_v()
+{
+  for (std::size_t r = 0; r < Extents::rank(); ++r) {
+    if (Extents::static_extent(r) == dynamic_extent ||
+        Extents::static_extent(r) > static_kernel_max_extent) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether all of Objects (mdspans) have small static extents, and an
+// unrolled kernel doing work multiply-adds is small enough.
+template<std::size_t Work, class... Objects>
+constexpr bool static_kernel_eligible()
+{
+  return (small_static_extents_v<typename Objects::extents_type>() && ...) &&
+    Work <= static_kernel_max_work;
+}
+
+template<class F, std::size_t... I>
+constexpr void static_for_impl(F&& f, std::index_sequence<I...>)
+{
+  (f(std::integral_constant<std::size_t, I>{}), ...);
+}
+
+// f(integral_constant<size_t, i>) for i in [0, N), unrolled.
+template<std::size_t N, class F>
+constexpr void static_for(F&& f)
+{
+  static_for_impl(f, std::make_index_sequence<N>{});
+}
+
+// How the products sum into an output of type Out.  If every input
+// converts exactly to gemm_accumulator_t<Out>, as in matrix_product's
+// mixed-precision engine, the operands are converted before they are
+// multiplied, so that float inputs to a double output are not rounded
+// to float first.  Otherwise they are multiplied as they are, as in
+// the generic loops.
+template<class Out, class... In>
+struct static_kernel_sum {
+  static constexpr bool widen =
+    std::is_floating_point_v<gemm_accumulator_t<Out>> &&
+    (is_widening_conversion_v<In, gemm_accumulator_t<Out>> && ...);
+  using type = std::conditional_t<widen, gemm_accumulator_t<Out>, Out>;
+
+  template<class X, class Y>
+  static constexpr auto product(const X& x, const Y& y)
+  {
+    if constexpr (widen) {
+      return type(x) * type(y);
+    }
+    else {
+      return x * y;
+    }
+  }
+};
+
+// C := init + A * B, where init(i, j) is C(i,j)'s initial value.
+template<class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t, class Init>
+LINALG_STATIC_KERNEL_FLATTEN
+void static_matrix_product(const in_matrix_1_t& A, const in_matrix_2_t& B,
+                           const out_matrix_t& C, Init init)
+{
+  constexpr std::size_t m = out_matrix_t::static_extent(0);
+  constexpr std::size_t n = out_matrix_t::static_extent(1);
+  constexpr std::size_t k = in_matrix_1_t::static_extent(1);
+  using value_type = typename out_matrix_t::value_type;
+  using sum = static_kernel_sum<value_type, typename in_matrix_1_t::value_type,
+                                typename in_matrix_2_t::value_type>;
+  using sum_type = typename sum::type;
+
+  std::array<value_type, m * n> c{};
+  static_for<m>([&] (auto i) {
+    static_for<n>([&] (auto j) {
+      sum_type s(init(i.value, j.value));
+      static_for<k>([&] (auto l) {
+        s += sum::product(A(i.value, l.value), B(l.value, j.value));
+      });
+      c[i.value * n + j.value] = value_type(s);
+    });
+  });
+  static_for<m>([&] (auto i) {
+    static_for<n>([&] (auto j) {
+      C(i.value, j.value) = c[i.value * n + j.value];
+    });
+  });
+}
+
+template<class in_matrix_1_t, class in_matrix_2_t, class out_matrix_t>
+constexpr bool static_matrix_product_eligible()
+{
+  return static_kernel_eligible<out_matrix_t::static_extent(0) * out_matrix_t::static_extent(1) *
+      in_matrix_1_t::static_extent(1), in_matrix_1_t, in_matrix_2_t, out_matrix_t>();
+}
+
+// y := init + A * x, where init(i) is y(i)'s initial value.
+template<class in_matrix_t, class in_vector_t, class out_vector_t, class Init>
+LINALG_STATIC_KERNEL_FLATTEN
+void static_matrix_vector_product(const in_matrix_t& A, const in_vector_t& x,
+                                  const out_vector_t& y, Init init)
+{
+  constexpr std::size_t m = in_matrix_t::static_extent(0);
+  constexpr std::size_t n = in_matrix_t::static_extent(1);
+  using value_type = typename out_vector_t::value_type;
+  using sum = static_kernel_sum<value_type, typename in_matrix_t::value_type,
+                                typename in_vector_t::value_type>;
+  using sum_type = typename sum::type;
+
+  std::array<value_type, m> y_local{};
+  static_for<m>([&] (auto i) {
+    sum_type s(init(i.value));
+    static_for<n>([&] (auto j) {
+      s += sum::product(A(i.value, j.value), x(j.value));
+    });
+    y_local[i.value] = value_type(s);
+  });
+  static_for<m>([&] (auto i) {
+    y(i.value) = y_local[i.value];
+  });
+}
+
+template<class in_matrix_t, class in_vector_t, class out_vector_t>
+constexpr bool static_matrix_vector_product_eligible()
+{
+  return static_kernel_eligible<in_matrix_t::static_extent(0) * in_matrix_t::static_extent(1),
+    in_matrix_t, in_vector_t, out_vector_t>();
+}
+
+// Solves A * x = b by substitution, with x kept in a local array until
+// it is complete, so x may be b.
+template<bool Lower, bool ExplicitDiagonal, class in_matrix_t, class in_vector_t,
+         class out_vector_t, class BinaryDivideOp>
+LINALG_STATIC_KERNEL_FLATTEN
+void static_triangular_matrix_vector_solve(const in_matrix_t& A, const in_vector_t& b,
+                                           const out_vector_t& x, BinaryDivideOp divide)
+{
+  constexpr std::size_t n = in_matrix_t::static_extent(0);
+  using value_type = typename out_vector_t::value_type;
+
+  std::array<value_type, n> x_local{};
+  static_for<n>([&] (auto step) {
+    constexpr std::size_t i = Lower ? decltype(step)::value : n - 1 - decltype(step)::value;
+    using sum_type = decltype(b(i) - A(i, i) * x_local[i]);
+    sum_type t(b(i));
+    static_for<Lower ? i : n - 1 - i>([&] (auto q) {
+      constexpr std::size_t j = Lower ? decltype(q)::value : i + 1 + decltype(q)::value;
+      t = t - A(i, j) * x_local[j];
+    });
+    if constexpr (ExplicitDiagonal) {
+      x_local[i] = divide(t, A(i, i));
+    }
+    else {
+      x_local[i] = t;
+    }
+  });
+  static_for<n>([&] (auto i) {
+    x(i.value) = x_local[i.value];
+  });
+}
+
+template<class in_matrix_t, class in_vector_t, class out_vector_t>
+constexpr bool static_triangular_matrix_vector_solve_eligible()
+{
+  return static_kernel_eligible<in_matrix_t::static_extent(0) * in_matrix_t::static_extent(0) / 2,
+    in_matrix_t, in_vector_t, out_vector_t>();
+}
+
+// init + the sum of v1(i) * v2(i), in order.
+template<class in_vector_1_t, class in_vector_2_t, class Scalar>
+LINALG_STATIC_KERNEL_FLATTEN
+Scalar static_dot(const in_vector_1_t& v1, const in_vector_2_t& v2, Scalar init)
+{
+  static_for<in_vector_1_t::static_extent(0)>([&] (auto i) {
+    init += v1(i.value) * v2(i.value);
+  });
+  return init;
+}
+
+// x := alpha * x, for a vector or a matrix x.
+template<class Scalar, class inout_object_t>
+LINALG_STATIC_KERNEL_FLATTEN
+void static_scale(const Scalar alpha, const inout_object_t& x)
+{
+  if constexpr (inout_object_t::rank() == 1) {
+    static_for<inout_object_t::static_extent(0)>([&] (auto i) {
+      x(i.value) *= alpha;
+    });
+  }
+  else {
+    static_for<inout_object_t::static_extent(1)>([&] (auto j) {
+      static_for<inout_object_t::static_extent(0)>([&] (auto i) {
+        x(i.value, j.value) *= alpha;
+      });
+    });
+  }
+}
+
+} // end namespace impl
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_STATIC_EXTENT_KERNELS_HPP_
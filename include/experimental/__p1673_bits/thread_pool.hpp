@@ -0,0 +1,410 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 2.0
+//              Copyright (2019) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software. //
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_HPP_
+#define LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+inline namespace __p1673_version_0 {
+namespace linalg {
+namespace impl {
+
+class thread_pool;
+
+// The pool whose tasks the calling thread is running, either as one of
+// the pool's workers or as the thread that called parallel_for; null
+// outside any parallel region.
+inline const thread_pool*& current_thread_pool() noexcept
+{
+  thread_local const thread_pool* pool = nullptr;
+  return pool;
+}
+
+inline bool in_parallel_region() noexcept
+{
+  return current_thread_pool() != nullptr;
+}
+
+// A fixed set of std::thread workers, started once and reused by every
+// parallel_for.  The thread that calls parallel_for works on its tasks
+// too, so a pool of N workers uses N + 1 threads.
+//
+// Each thread working on a parallel_for owns a range of its task
+// indices, and takes tasks from the front of that range.  A thread
+// whose range runs dry steals the back half of another thread's range,
+// so a parallel_for whose tasks take uneven time (like the column
+// blocks of a triangle) still keeps every thread busy.
+//
+// A parallel_for called from inside a task of the same pool is a
+// nested job: the calling thread works on it, and idle workers join
+// in, but the pool never starts more threads.  A parallel_for called
+// from inside a task of a different pool runs inline, so that nesting
+// two pools cannot oversubscribe the machine either.
+class thread_pool {
+public:
+  explicit thread_pool(std::size_t num_workers)
+  {
+    workers_.reserve(num_workers);
+    for (std::size_t w = 0; w < num_workers; ++w) {
+      workers_.emplace_back([this, w] { worker_loop(w); });
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Number of threads that run the tasks of a parallel_for,
+  // counting the calling thread.
+  std::size_t concurrency() const noexcept { return workers_.size() + 1; }
+
+  // Call f(task) once for each task in [0, num_tasks), and return
+  // once all of them are done.  If any call throws, the remaining
+  // tasks are skipped and the first exception is rethrown here.
+  template<class F>
+  void parallel_for(std::size_t num_tasks, F&& f)
+  {
+    if (num_tasks == 0) {
+      return;
+    }
+    const thread_pool* outer = current_thread_pool();
+    if (num_tasks == 1 || workers_.empty() ||
+        (outer != nullptr && outer != this)) {
+      for (std::size_t task = 0; task < num_tasks; ++task) {
+        f(task);
+      }
+      return;
+    }
+
+    using f_t = std::remove_reference_t<F>;
+    job j(num_tasks, concurrency());
+    j.function = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+    j.run = [](void* function, std::size_t task) {
+      (*static_cast<f_t*>(function))(task);
+    };
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(&j);
+    }
+    wake_.notify_all();
+
+    current_thread_pool() = this;
+    run_tasks(j, 0);
+    current_thread_pool() = outer;
+
+    {
+      // No worker may join the job after this, and the ones that did
+      // are done once its helper count drops to zero.
+      std::unique_lock<std::mutex> lock(mutex_);
+      jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &j));
+      done_.wait(lock, [&j] { return j.helpers == 0; });
+    }
+
+    if (j.error) {
+      std::rethrow_exception(j.error);
+    }
+  }
+
+private:
+  // The task indices [begin, end) that one thread has yet to run.
+  struct alignas(64) task_range {
+    std::mutex mutex;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+  };
+
+  // One parallel_for.  Range 0 belongs to the calling thread, and
+  // range w + 1 to worker w.
+  struct job {
+    job(std::size_t num_tasks, std::size_t num_ranges) :
+      ranges(new task_range[num_ranges]),
+      num_ranges(num_ranges), unclaimed(num_tasks)
+    {
+      for (std::size_t r = 0; r < num_ranges; ++r) {
+        ranges[r].begin = num_tasks * r / num_ranges;
+        ranges[r].end = num_tasks * (r + 1) / num_ranges;
+      }
+    }
+
+    void (*run)(void*, std::size_t) = nullptr;
+    void* function = nullptr;
+    std::unique_ptr<task_range[]> ranges;
+    std::size_t num_ranges;
+    // Tasks not yet taken by any thread; workers look for jobs with
+    // some left.
+    std::atomic<std::size_t> unclaimed;
+    // Workers running tasks of this job; guarded by the pool's mutex_.
+    std::size_t helpers = 0;
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  };
+
+  // Take the next task for the thread that owns range self: from the
+  // front of its own range, else by stealing the back half of another
+  // range.  Return false once no range has tasks left.
+  static bool next_task(job& j, std::size_t self, std::size_t& task)
+  {
+    task_range& own = j.ranges[self];
+    {
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (own.begin < own.end) {
+        task = own.begin++;
+        j.unclaimed.fetch_sub(1);
+        return true;
+      }
+    }
+    for (std::size_t i = 1; i < j.num_ranges; ++i) {
+      task_range& victim = j.ranges[(self + i) % j.num_ranges];
+      std::size_t first = 0;
+      std::size_t last = 0;
+      {
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        const std::size_t count = victim.end - victim.begin;
+        if (count == 0) {
+          continue;
+        }
+        first = victim.end - (count + 1) / 2;
+        last = victim.end;
+        victim.end = first;
+      }
+      {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.begin = first + 1;
+        own.end = last;
+      }
+      task = first;
+      j.unclaimed.fetch_sub(1);
+      return true;
+    }
+    return false;
+  }
+
+  static void run_tasks(job& j, std::size_t self) noexcept
+  {
+    std::size_t task = 0;
+    while (next_task(j, self, task)) {
+      try {
+        j.run(j.function, task);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(j.error_mutex);
+        if (! j.error) {
+          j.error = std::current_exception();
+        }
+        // Skip the rest: drop every range's remaining tasks.
+        for (std::size_t r = 0; r < j.num_ranges; ++r) {
+          task_range& range = j.ranges[r];
+          std::lock_guard<std::mutex> range_lock(range.mutex);
+          j.unclaimed.fetch_sub(range.end - range.begin);
+          range.end = range.begin;
+        }
+      }
+    }
+  }
+
+  // The most recently submitted job with tasks left, which is the
+  // innermost one if jobs are nested; null if there is none.
+  // The caller must hold mutex_.
+  job* find_job() const noexcept
+  {
+    for (auto it = jobs_.rbegin(); it != jobs_.rend(); ++it) {
+      if ((*it)->unclaimed.load() != 0) {
+        return *it;
+      }
+    }
+    return nullptr;
+  }
+
+  void worker_loop(std::size_t w)
+  {
+    current_thread_pool() = this;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      job* j = nullptr;
+      wake_.wait(lock, [&] { return stop_ || (j = find_job()) != nullptr; });
+      if (stop_) {
+        return;
+      }
+      ++j->helpers;
+      lock.unlock();
+      run_tasks(*j, w + 1);
+      lock.lock();
+      if (--j->helpers == 0) {
+        done_.notify_all();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  std::vector<job*> jobs_;
+  bool stop_ = false;
+};
+
+// Number of threads for default_thread_pool(), counting the calling
+// thread: the value of the environment variable LINALG_NUM_THREADS if
+// it is a positive integer, else one per hardware thread.
+inline std::size_t default_num_threads()
+{
+  if (const char* env = std::getenv("LINALG_NUM_THREADS")) {
+    char* end = nullptr;
+    const unsigned long n = std::strtoul(env, &end, 10);
+    if (end != env && *end == '\0' && n > 0) {
+      return std::size_t(n);
+    }
+  }
+  const std::size_t hw = std::thread::hardware_concurrency();
+  return hw > 0 ? hw : std::size_t(1);
+}
+
+// The pool behind std::execution::par and par_unseq.  It starts on
+// first use.
+inline thread_pool& default_thread_pool()
+{
+  static thread_pool pool(default_num_threads() - 1);
+  return pool;
+}
+
+// The execution policy that runs the BLAS 2 and 3 algorithms on a
+// thread_pool: the one it points to, else default_thread_pool().
+// execpolicy_mapper maps the Standard parallel policies and
+// thread_pool_exec to it; the algorithms' overloads for it are in
+// blas_parallel.hpp.
+struct parallel_exec_t {
+  thread_pool* target = nullptr;
+
+  thread_pool& pool() const
+  {
+    return target != nullptr ? *target : default_thread_pool();
+  }
+};
+
+template<class T>
+inline constexpr bool is_parallel_exec_v =
+  std::is_same_v<std::remove_cv_t<std::remove_reference_t<T>>, parallel_exec_t>;
+
+template<>
+inline constexpr bool is_custom_linalg_execution_policy_v<parallel_exec_t> = true;
+
+} // end namespace impl
+
+// Execution policy that runs the BLAS 2 and 3 algorithms on a thread
+// pool owned by linalg.  The default-constructed policy shares the
+// pool behind std::execution::par; thread_pool_exec(num_threads) starts
+// a pool of its own with num_threads threads, counting the thread that
+// calls the algorithm.  Copies share the pool, which stops once the
+// last copy is gone.  Starting the threads once and reusing them keeps
+// small problems from paying for thread creation on every call.
+class thread_pool_exec {
+public:
+  thread_pool_exec() : pool_(&impl::default_thread_pool()) {}
+
+  explicit thread_pool_exec(std::size_t num_threads) :
+    owner_(std::make_shared<impl::thread_pool>(
+      num_threads > 0 ? num_threads - 1 : std::size_t(0))),
+    pool_(owner_.get())
+  {}
+
+  std::size_t num_threads() const noexcept { return pool_->concurrency(); }
+
+  impl::thread_pool& pool() const noexcept { return *pool_; }
+
+private:
+  std::shared_ptr<impl::thread_pool> owner_;
+  impl::thread_pool* pool_;
+};
+
+namespace impl {
+template<>
+inline constexpr bool is_custom_linalg_execution_policy_v<thread_pool_exec> = true;
+} // end namespace impl
+
+inline impl::parallel_exec_t execpolicy_mapper(const thread_pool_exec& exec)
+{
+  return impl::parallel_exec_t{&exec.pool()};
+}
+
+#if ((! defined(__GNUC__)) || (__GNUC__ > 9)) && ! defined(LINALG_ENABLE_KOKKOS_DEFAULT)
+inline impl::parallel_exec_t execpolicy_mapper(std::execution::parallel_policy)
+{
+  return impl::parallel_exec_t{};
+}
+
+inline impl::parallel_exec_t execpolicy_mapper(std::execution::parallel_unsequenced_policy)
+{
+  return impl::parallel_exec_t{};
+}
+#endif
+
+} // end namespace linalg
+} // end inline namespace __p1673_version_0
+} // end namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // end namespace MDSPAN_IMPL_STANDARD_NAMESPACE
+
+#endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_THREAD_POOL_HPP_
@@ -0,0 +1,175 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+// Scaled and conjugated views are read straight from the arrays behind
+// them, with the scaling factor and conjugation taken apart once.
+// Compare the algorithms that do so with the same algorithms on the
+// view's elements stored explicitly.  All values are small integers,
+// so every result is exact.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::scaled;
+  using complex_t = std::complex<double>;
+  using vector_t = mdspan<complex_t, dextents<std::size_t, 1>>;
+  using matrix_t = mdspan<complex_t, dextents<std::size_t, 2>, layout_left>;
+
+  complex_t decomposition_test_value(std::size_t k)
+  {
+    return complex_t(double(int(k % 7) - 3), double(int(k % 5) - 2));
+  }
+
+  TEST(accessor_decomposition, traits)
+  {
+    using LinearAlgebra::impl::is_decomposable_accessor_v;
+    using real_vector_t = mdspan<double, dextents<std::size_t, 1>>;
+    using float_vector_t = mdspan<float, dextents<std::size_t, 1>>;
+    static_assert(! is_decomposable_accessor_v<real_vector_t>);
+    static_assert(is_decomposable_accessor_v<
+      decltype(scaled(2.0, std::declval<real_vector_t>()))>);
+    static_assert(is_decomposable_accessor_v<
+      decltype(conjugated(std::declval<vector_t>()))>);
+    static_assert(is_decomposable_accessor_v<
+      decltype(scaled(complex_t(1.0, 2.0), conjugated(scaled(3.0, std::declval<vector_t>()))))>);
+    // Scaling a float vector by a double changes its value_type.
+    static_assert(! is_decomposable_accessor_v<
+      decltype(scaled(2.0, std::declval<float_vector_t>()))>);
+  }
+
+  TEST(accessor_decomposition, elements)
+  {
+    const std::size_t n = 12;
+    std::vector<complex_t> z_mem(2 * n);
+    for (std::size_t k = 0; k < z_mem.size(); ++k) {
+      z_mem[k] = decomposition_test_value(k);
+    }
+    layout_stride::mapping<dextents<std::size_t, 1>> z_mapping(
+      dextents<std::size_t, 1>(n), std::array<std::size_t, 1>{2});
+    mdspan<complex_t, dextents<std::size_t, 1>, layout_stride> z(z_mem.data(), z_mapping);
+
+    const auto view = scaled(complex_t(1.0, 2.0), conjugated(scaled(3.0, z)));
+    const auto elements = LinearAlgebra::impl::decompose_accessor(view);
+    static_assert(decltype(elements)::conj);
+    EXPECT_EQ(elements.alpha, complex_t(3.0, 6.0));
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(elements(i), complex_t(view(i)));
+      EXPECT_EQ(elements.stored(i), std::conj(z(i)));
+    }
+  }
+
+  // x_view = alpha * conj(x), and x_explicit holds its elements.
+  struct decomposition_fixture {
+    static constexpr std::size_t m = 9;
+    static constexpr std::size_t n = 7;
+    const complex_t alpha{2.0, -1.0};
+    std::vector<complex_t> x_mem, x_explicit_mem, y_mem, A_mem, A_explicit_mem;
+
+    decomposition_fixture()
+      : x_mem(m), x_explicit_mem(m), y_mem(m), A_mem(m * n), A_explicit_mem(m * n)
+    {
+      for (std::size_t i = 0; i < m; ++i) {
+        x_mem[i] = decomposition_test_value(i);
+        x_explicit_mem[i] = alpha * std::conj(x_mem[i]);
+        y_mem[i] = decomposition_test_value(3 * i + 1);
+      }
+      for (std::size_t k = 0; k < m * n; ++k) {
+        A_mem[k] = decomposition_test_value(2 * k + 5);
+        A_explicit_mem[k] = alpha * std::conj(A_mem[k]);
+      }
+    }
+
+    auto x_view() { return scaled(alpha, conjugated(vector_t(x_mem.data(), m))); }
+    vector_t x_explicit() { return vector_t(x_explicit_mem.data(), m); }
+    vector_t y() { return vector_t(y_mem.data(), m); }
+    auto A_view() { return scaled(alpha, conjugated(matrix_t(A_mem.data(), m, n))); }
+    matrix_t A_explicit() { return matrix_t(A_explicit_mem.data(), m, n); }
+  };
+
+  TEST(accessor_decomposition, blas1)
+  {
+    decomposition_fixture f;
+    const std::size_t m = f.m;
+    const std::size_t n = f.n;
+    static_assert(LinearAlgebra::impl::is_decomposable_accessor_v<decltype(f.x_view())>);
+
+    std::vector<complex_t> u_mem(m), v_mem(m);
+    vector_t u(u_mem.data(), m);
+    vector_t v(v_mem.data(), m);
+    LinearAlgebra::copy(f.x_view(), u);
+    LinearAlgebra::copy(f.x_explicit(), v);
+    EXPECT_EQ(u_mem, v_mem);
+    LinearAlgebra::add(f.x_view(), f.y(), u);
+    LinearAlgebra::add(f.x_explicit(), f.y(), v);
+    EXPECT_EQ(u_mem, v_mem);
+
+    std::vector<complex_t> B_mem(m * n), C_mem(m * n);
+    matrix_t B(B_mem.data(), m, n);
+    matrix_t C(C_mem.data(), m, n);
+    LinearAlgebra::copy(f.A_view(), B);
+    LinearAlgebra::copy(f.A_explicit(), C);
+    EXPECT_EQ(B_mem, C_mem);
+    LinearAlgebra::add(f.A_view(), f.A_explicit(), B);
+    LinearAlgebra::add(f.A_explicit(), f.A_explicit(), C);
+    EXPECT_EQ(B_mem, C_mem);
+
+    // Real vectors, whose sums of absolute values are exact.
+    std::vector<double> r_mem(m), r_explicit_mem(m);
+    for (std::size_t i = 0; i < m; ++i) {
+      r_mem[i] = double(int(i % 7) - 3);
+      r_explicit_mem[i] = -2.0 * r_mem[i];
+    }
+    mdspan<double, dextents<std::size_t, 1>> r(r_mem.data(), m);
+    mdspan<double, dextents<std::size_t, 1>> r_explicit(r_explicit_mem.data(), m);
+    EXPECT_EQ(LinearAlgebra::vector_abs_sum(scaled(-2.0, r)),
+              LinearAlgebra::vector_abs_sum(r_explicit));
+    EXPECT_EQ(LinearAlgebra::vector_abs_sum(scaled(-2.0, r), 1.0),
+              LinearAlgebra::vector_abs_sum(r_explicit, 1.0));
+
+    std::vector<double> R_mem(m * n), R_explicit_mem(m * n);
+    for (std::size_t k = 0; k < m * n; ++k) {
+      R_mem[k] = double(int(k % 9) - 4);
+      R_explicit_mem[k] = 3.0 * R_mem[k];
+    }
+    mdspan<double, dextents<std::size_t, 2>> R(R_mem.data(), m, n);
+    mdspan<double, dextents<std::size_t, 2>> R_explicit(R_explicit_mem.data(), m, n);
+    EXPECT_EQ(LinearAlgebra::matrix_one_norm(scaled(3.0, R), 0.0),
+              LinearAlgebra::matrix_one_norm(R_explicit, 0.0));
+    EXPECT_EQ(LinearAlgebra::matrix_inf_norm(scaled(3.0, R), 0.0),
+              LinearAlgebra::matrix_inf_norm(R_explicit, 0.0));
+    EXPECT_EQ(LinearAlgebra::matrix_frob_norm(scaled(3.0, R), 0.0),
+              LinearAlgebra::matrix_frob_norm(R_explicit, 0.0));
+  }
+
+  TEST(accessor_decomposition, blas2_and_blas3)
+  {
+    decomposition_fixture f;
+    const std::size_t m = f.m;
+
+    // A small product, which takes the plain loops.
+    std::vector<complex_t> C_mem(m * m), D_mem(m * m);
+    matrix_t C(C_mem.data(), m, m);
+    matrix_t D(D_mem.data(), m, m);
+    LinearAlgebra::matrix_product(f.A_view(), LinearAlgebra::transposed(f.A_view()), C);
+    LinearAlgebra::matrix_product(f.A_explicit(), LinearAlgebra::transposed(f.A_explicit()), D);
+    EXPECT_EQ(C_mem, D_mem);
+
+    // Rank-2 updates of a matrix in layout_stride, which take the
+    // plain loops.
+    layout_stride::mapping<dextents<std::size_t, 2>> S_mapping(
+      dextents<std::size_t, 2>(m, m), std::array<std::size_t, 2>{1, m});
+    std::vector<complex_t> S_mem(m * m), T_mem(m * m);
+    mdspan<complex_t, dextents<std::size_t, 2>, layout_stride> S(S_mem.data(), S_mapping);
+    mdspan<complex_t, dextents<std::size_t, 2>, layout_stride> T(T_mem.data(), S_mapping);
+    LinearAlgebra::symmetric_matrix_rank_2_update(f.x_view(), f.y(), S,
+                                                  LinearAlgebra::lower_triangle);
+    LinearAlgebra::symmetric_matrix_rank_2_update(f.x_explicit(), f.y(), T,
+                                                  LinearAlgebra::lower_triangle);
+    EXPECT_EQ(S_mem, T_mem);
+    LinearAlgebra::hermitian_matrix_rank_2_update(f.x_view(), f.y(), S,
+                                                  LinearAlgebra::upper_triangle);
+    LinearAlgebra::hermitian_matrix_rank_2_update(f.x_explicit(), f.y(), T,
+                                                  LinearAlgebra::upper_triangle);
+    EXPECT_EQ(S_mem, T_mem);
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,233 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+// Batched matrix-matrix products of rank-3 batches in each layout and
+// of ranges of matrices, compared with matrix_product run on each
+// item.  All values are small integers, so every product is exact.
+
+namespace {
+  using LinearAlgebra::batched_matrix_product;
+  using LinearAlgebra::layout_batch_interleaved;
+  using LinearAlgebra::matrix_product;
+
+  using batch_extents_t = dextents<std::size_t, 3>;
+
+  template<class batch_t>
+  void fill_batch(const batch_t& X, int seed)
+  {
+    using value_type = typename batch_t::value_type;
+    for (std::size_t b = 0; b < X.extent(0); ++b) {
+      for (std::size_t i = 0; i < X.extent(1); ++i) {
+        for (std::size_t j = 0; j < X.extent(2); ++j) {
+          X(b,i,j) = test_value<value_type>(int(seed + 11 * b + 5 * i + 3 * j));
+        }
+      }
+    }
+  }
+
+  // Computes C = A*B and D = C0 + A*B for a batch of m x k times k x n
+  // products, and compares each item with matrix_product.  The batch
+  // is longer than one chunk of the interleaved product and ends in a
+  // partial vector.
+  template<class Scalar, class Layout>
+  void test_batched_matrix_product(std::size_t m, std::size_t n, std::size_t k,
+                                   std::size_t batch = 1037)
+  {
+    using batch_t = mdspan<Scalar, batch_extents_t, Layout>;
+    std::vector<Scalar> A_mem(batch * m * k), B_mem(batch * k * n), C0_mem(batch * m * n);
+    std::vector<Scalar> C_mem(batch * m * n), D_mem(batch * m * n);
+    batch_t A(A_mem.data(), batch, m, k);
+    batch_t B(B_mem.data(), batch, k, n);
+    batch_t C0(C0_mem.data(), batch, m, n);
+    batch_t C(C_mem.data(), batch, m, n);
+    batch_t D(D_mem.data(), batch, m, n);
+    fill_batch(A, 1);
+    fill_batch(B, 2);
+    fill_batch(C0, 3);
+
+    batched_matrix_product(A, B, C);
+    batched_matrix_product(A, B, C0, D);
+
+    std::vector<Scalar> expected_mem(m * n), update_mem(m * n);
+    mdspan<Scalar, dextents<std::size_t, 2>> expected(expected_mem.data(), m, n);
+    mdspan<Scalar, dextents<std::size_t, 2>> update(update_mem.data(), m, n);
+    for (std::size_t b = 0; b < batch; ++b) {
+      auto A_b = LinearAlgebra::impl::batch_item(A, b);
+      auto B_b = LinearAlgebra::impl::batch_item(B, b);
+      matrix_product(A_b, B_b, expected);
+      matrix_product(A_b, B_b, LinearAlgebra::impl::batch_item(C0, b), update);
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          EXPECT_EQ(C(b,i,j), expected(i,j));
+          EXPECT_EQ(D(b,i,j), update(i,j));
+        }
+      }
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_batched_matrix_product_shapes()
+  {
+    test_batched_matrix_product<Scalar, Layout>(4, 4, 4);
+    test_batched_matrix_product<Scalar, Layout>(3, 5, 2);
+    test_batched_matrix_product<Scalar, Layout>(0, 3, 2, 10);
+    test_batched_matrix_product<Scalar, Layout>(2, 3, 0, 10);
+    // Large enough items for matrix_product on each item.
+    test_batched_matrix_product<Scalar, Layout>(40, 36, 30, 3);
+  }
+
+  TEST(BLAS3_batched_gemm, double_interleaved)
+  {
+    using batch_t = mdspan<double, batch_extents_t, layout_batch_interleaved>;
+    static_assert(LinearAlgebra::impl::interleaved_batched_gemm_eligible<
+                  batch_t, batch_t, batch_t>());
+    test_batched_matrix_product_shapes<double, layout_batch_interleaved>();
+  }
+
+  TEST(BLAS3_batched_gemm, float_interleaved)
+  {
+    test_batched_matrix_product_shapes<float, layout_batch_interleaved>();
+  }
+
+  TEST(BLAS3_batched_gemm, double_layout_right)
+  {
+    test_batched_matrix_product_shapes<double, layout_right>();
+  }
+
+  TEST(BLAS3_batched_gemm, complex_layouts)
+  {
+    test_batched_matrix_product_shapes<std::complex<double>, layout_batch_interleaved>();
+    test_batched_matrix_product_shapes<std::complex<double>, layout_right>();
+  }
+
+  // A batch that is a layout_stride view of every other item of an
+  // interleaved batch, so its batch stride is not 1.
+  TEST(BLAS3_batched_gemm, layout_stride)
+  {
+    const std::size_t batch = 50, m = 3, n = 4, k = 5;
+    using interleaved_t = mdspan<double, batch_extents_t, layout_batch_interleaved>;
+    std::vector<double> A_mem(2 * batch * m * k), B_mem(2 * batch * k * n);
+    std::vector<double> C_mem(2 * batch * m * n);
+    interleaved_t A_all(A_mem.data(), 2 * batch, m, k);
+    interleaved_t B_all(B_mem.data(), 2 * batch, k, n);
+    fill_batch(A_all, 4);
+    fill_batch(B_all, 5);
+
+    auto every_other = [&] (double* data, std::size_t rows, std::size_t cols) {
+      layout_stride::mapping<batch_extents_t> map(batch_extents_t(batch, rows, cols),
+        std::array<std::size_t, 3>{2, 2 * batch, 2 * batch * rows});
+      return mdspan<double, batch_extents_t, layout_stride>(data, map);
+    };
+    auto A = every_other(A_mem.data(), m, k);
+    auto B = every_other(B_mem.data(), k, n);
+    auto C = every_other(C_mem.data(), m, n);
+    batched_matrix_product(A, B, C);
+
+    std::vector<double> expected_mem(m * n);
+    mdspan<double, dextents<std::size_t, 2>> expected(expected_mem.data(), m, n);
+    for (std::size_t b = 0; b < batch; ++b) {
+      matrix_product(LinearAlgebra::impl::batch_item(A, b),
+                     LinearAlgebra::impl::batch_item(B, b), expected);
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          EXPECT_EQ(C(b,i,j), expected(i,j));
+          // The items in between are left alone.
+          EXPECT_EQ(C_mem[2 * b + 1 + 2 * batch * (i + m * j)], 0.0);
+        }
+      }
+    }
+  }
+
+  // A range of matrices of different sizes, and the updating product
+  // of a batch in place.
+  TEST(BLAS3_batched_gemm, ranges_and_in_place_update)
+  {
+    using matrix_t = mdspan<double, dextents<std::size_t, 2>>;
+    const std::size_t sizes[] = {1, 7, 2, 40, 5};
+    std::vector<std::vector<double>> storage;
+    std::vector<matrix_t> A, B, C;
+    for (std::size_t s : sizes) {
+      for (auto* X : {&A, &B, &C}) {
+        storage.emplace_back(s * s);
+        for (std::size_t q = 0; q < s * s; ++q) {
+          storage.back()[q] = test_value<double>(int(q + storage.size()));
+        }
+        X->push_back(matrix_t(storage.back().data(), s, s));
+      }
+    }
+    batched_matrix_product(A, B, C);
+    for (std::size_t b = 0; b < A.size(); ++b) {
+      std::vector<double> expected_mem(sizes[b] * sizes[b]);
+      matrix_t expected(expected_mem.data(), sizes[b], sizes[b]);
+      matrix_product(A[b], B[b], expected);
+      for (std::size_t i = 0; i < sizes[b]; ++i) {
+        for (std::size_t j = 0; j < sizes[b]; ++j) {
+          EXPECT_EQ(C[b](i,j), expected(i,j));
+        }
+      }
+    }
+
+    const std::size_t batch = 100, n = 3;
+    using batch_t = mdspan<double, batch_extents_t, layout_batch_interleaved>;
+    std::vector<double> X_mem(batch * n * n), Y_mem(batch * n * n), Z_mem(batch * n * n);
+    batch_t X(X_mem.data(), batch, n, n);
+    batch_t Y(Y_mem.data(), batch, n, n);
+    batch_t Z(Z_mem.data(), batch, n, n);
+    fill_batch(X, 6);
+    fill_batch(Y, 7);
+    fill_batch(Z, 8);
+    std::vector<double> Z0_mem(Z_mem);
+    batch_t Z0(Z0_mem.data(), batch, n, n);
+    batched_matrix_product(X, Y, Z, Z);
+    std::vector<double> expected_mem(n * n);
+    mdspan<double, dextents<std::size_t, 2>> expected(expected_mem.data(), n, n);
+    for (std::size_t b = 0; b < batch; ++b) {
+      matrix_product(LinearAlgebra::impl::batch_item(X, b), LinearAlgebra::impl::batch_item(Y, b),
+                     LinearAlgebra::impl::batch_item(Z0, b), expected);
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          EXPECT_EQ(Z(b,i,j), expected(i,j));
+        }
+      }
+    }
+  }
+
+  // Checks each SIMD kernel up to the one this CPU runs against the
+  // scalar kernel, with the lengths ending in whole vectors and in a
+  // scalar tail.
+  template<class Scalar>
+  void test_simd_multiply_add_kernels()
+  {
+    using LinearAlgebra::impl::simd_isa;
+    constexpr std::size_t max_n = 69;
+    std::vector<Scalar> a(max_n), b(max_n), c0(max_n);
+    for (std::size_t q = 0; q < max_n; ++q) {
+      a[q] = test_value<Scalar>(int(q));
+      b[q] = test_value<Scalar>(int(3 * q + 1));
+      c0[q] = test_value<Scalar>(int(q + 2));
+    }
+    for (std::size_t n : {std::size_t(1), std::size_t(8), std::size_t(32), max_n}) {
+      std::vector<Scalar> expected(c0), expected_difference(c0);
+      LinearAlgebra::impl::scalar_multiply_add(a.data(), b.data(), expected.data(), n);
+      LinearAlgebra::impl::scalar_multiply_add<true>(a.data(), b.data(),
+                                                    expected_difference.data(), n);
+      for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+        if (isa > LinearAlgebra::impl::active_simd_isa()) {
+          continue;
+        }
+        std::vector<Scalar> c(c0), d(c0);
+        LinearAlgebra::impl::simd_multiply_add(isa, a.data(), b.data(), c.data(), n);
+        LinearAlgebra::impl::simd_multiply_add<true>(isa, a.data(), b.data(), d.data(), n);
+        EXPECT_EQ(c, expected);
+        EXPECT_EQ(d, expected_difference);
+      }
+    }
+  }
+
+  TEST(BLAS3_batched_gemm, simd_kernels)
+  {
+    test_simd_multiply_add_kernels<double>();
+    test_simd_multiply_add_kernels<float>();
+  }
+
+} // end anonymous namespace
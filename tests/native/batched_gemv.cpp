@@ -0,0 +1,99 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+// Batched matrix-vector products of batches in each layout, compared
+// with matrix_vector_product run on each item.  All values are small
+// integers, so every product is exact.
+
+namespace {
+  using LinearAlgebra::batched_matrix_vector_product;
+  using LinearAlgebra::layout_batch_interleaved;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::impl::batch_item;
+
+  // Computes y = A*x and z = y0 + A*x for a batch of m x n matrices.
+  // The batch is longer than one chunk of the interleaved product and
+  // ends in a partial vector.
+  template<class Scalar, class Layout>
+  void test_batched_gemv(std::size_t m, std::size_t n, std::size_t batch = 1037)
+  {
+    using matrix_batch_t = mdspan<Scalar, dextents<std::size_t, 3>, Layout>;
+    using vector_batch_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+    std::vector<Scalar> A_mem(batch * m * n), x_mem(batch * n), y0_mem(batch * m);
+    std::vector<Scalar> y_mem(batch * m), z_mem(batch * m);
+    matrix_batch_t A(A_mem.data(), batch, m, n);
+    vector_batch_t x(x_mem.data(), batch, n);
+    vector_batch_t y0(y0_mem.data(), batch, m);
+    vector_batch_t y(y_mem.data(), batch, m);
+    vector_batch_t z(z_mem.data(), batch, m);
+    for (std::size_t b = 0; b < batch; ++b) {
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          A(b,i,j) = test_value<Scalar>(int(11 * b + 5 * i + 3 * j));
+        }
+        y0(b,i) = test_value<Scalar>(int(b + 2 * i + 1));
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        x(b,j) = test_value<Scalar>(int(3 * b + j + 2));
+      }
+    }
+
+    batched_matrix_vector_product(A, x, y);
+    batched_matrix_vector_product(A, x, y0, z);
+
+    std::vector<Scalar> expected_mem(m), update_mem(m);
+    mdspan<Scalar, dextents<std::size_t, 1>> expected(expected_mem.data(), m);
+    mdspan<Scalar, dextents<std::size_t, 1>> update(update_mem.data(), m);
+    for (std::size_t b = 0; b < batch; ++b) {
+      matrix_vector_product(batch_item(A, b), batch_item(x, b), expected);
+      matrix_vector_product(batch_item(A, b), batch_item(x, b), batch_item(y0, b), update);
+      for (std::size_t i = 0; i < m; ++i) {
+        EXPECT_EQ(y(b,i), expected(i));
+        EXPECT_EQ(z(b,i), update(i));
+      }
+    }
+
+    // In place: y := y + A*x.
+    batched_matrix_vector_product(A, x, y, y);
+    for (std::size_t b = 0; b < batch; ++b) {
+      for (std::size_t i = 0; i < m; ++i) {
+        EXPECT_EQ(y(b,i), Scalar(2) * z(b,i) - Scalar(2) * y0(b,i));
+      }
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_batched_gemv_shapes()
+  {
+    test_batched_gemv<Scalar, Layout>(6, 6);
+    test_batched_gemv<Scalar, Layout>(3, 5);
+    test_batched_gemv<Scalar, Layout>(4, 0, 10);
+    test_batched_gemv<Scalar, Layout>(70, 50, 3);
+  }
+
+  TEST(BLAS2_batched_gemv, double_interleaved)
+  {
+    using matrix_batch_t = mdspan<double, dextents<std::size_t, 3>, layout_batch_interleaved>;
+    using vector_batch_t = mdspan<double, dextents<std::size_t, 2>, layout_batch_interleaved>;
+    static_assert(LinearAlgebra::impl::interleaved_batch_eligible<
+                  vector_batch_t, matrix_batch_t, vector_batch_t>());
+    test_batched_gemv_shapes<double, layout_batch_interleaved>();
+  }
+
+  TEST(BLAS2_batched_gemv, float_interleaved)
+  {
+    test_batched_gemv_shapes<float, layout_batch_interleaved>();
+  }
+
+  TEST(BLAS2_batched_gemv, layout_right)
+  {
+    test_batched_gemv_shapes<double, layout_right>();
+    test_batched_gemv_shapes<std::complex<double>, layout_right>();
+  }
+
+  TEST(BLAS2_batched_gemv, complex_interleaved)
+  {
+    test_batched_gemv_shapes<std::complex<double>, layout_batch_interleaved>();
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,103 @@
+#include "./gtest_fixtures.hpp"
+#include <cmath>
+#include <complex>
+
+// Batched triangular solves of batches in each layout.  Each item's
+// B is A times an integer X_true, so the solves recover X_true.
+
+namespace {
+  using LinearAlgebra::batched_triangular_matrix_matrix_left_solve;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::explicit_diagonal_t;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::layout_batch_interleaved;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::upper_triangle;
+
+  // Solves A*X = B for a batch of m x m triangular A, filled with junk
+  // outside the triangle that the solve reads, and m x n right-hand
+  // sides; once into X, and once in place in B.  The batch is longer
+  // than one chunk of the interleaved solve and ends in a partial
+  // vector.
+  template<class Scalar, class Layout, class Triangle, class DiagonalStorage>
+  void test_batched_trsm(Triangle t, DiagonalStorage d, std::size_t m, std::size_t n,
+                         std::size_t batch = 1037)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    constexpr bool explicit_diag = std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+    using batch_t = mdspan<Scalar, dextents<std::size_t, 3>, Layout>;
+    std::vector<Scalar> A_mem(batch * m * m), B_mem(batch * m * n);
+    std::vector<Scalar> X_mem(batch * m * n), X_true_mem(batch * m * n);
+    batch_t A(A_mem.data(), batch, m, m);
+    batch_t B(B_mem.data(), batch, m, n);
+    batch_t X(X_mem.data(), batch, m, n);
+    batch_t X_true(X_true_mem.data(), batch, m, n);
+
+    for (std::size_t b = 0; b < batch; ++b) {
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < m; ++j) {
+          const bool stored = lower ? j < i : j > i;
+          if (i == j) {
+            A(b,i,j) = explicit_diag ? Scalar(double(1 + (b + i) % 3)) : Scalar(-1.0e6);
+          } else if (stored) {
+            A(b,i,j) = test_value<Scalar>(int(7 * b + 3 * i + 5 * j), 9);
+          } else {
+            A(b,i,j) = Scalar(1.0e6);
+          }
+        }
+        for (std::size_t k = 0; k < n; ++k) {
+          X_true(b,i,k) = test_value<Scalar>(int(b + 2 * i + 3 * k), 9);
+        }
+      }
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t k = 0; k < n; ++k) {
+          Scalar sum = explicit_diag ? A(b,i,i) * X_true(b,i,k) : X_true(b,i,k);
+          for (std::size_t j = lower ? 0 : i + 1; j < (lower ? i : m); ++j) {
+            sum += A(b,i,j) * X_true(b,j,k);
+          }
+          B(b,i,k) = sum;
+        }
+      }
+    }
+
+    batched_triangular_matrix_matrix_left_solve(A, t, d, B, X);
+    batched_triangular_matrix_matrix_left_solve(A, t, d, B, B);
+    for (std::size_t q = 0; q < X_mem.size(); ++q) {
+      EXPECT_NEAR(std::abs(X_mem[q] - X_true_mem[q]), 0.0, 1.0e-9);
+      EXPECT_EQ(B_mem[q], X_mem[q]);
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_batched_trsm_all_cases()
+  {
+    test_batched_trsm<Scalar, Layout>(lower_triangle, explicit_diagonal, 6, 6);
+    test_batched_trsm<Scalar, Layout>(upper_triangle, explicit_diagonal, 6, 1);
+    test_batched_trsm<Scalar, Layout>(lower_triangle, implicit_unit_diagonal, 5, 3);
+    test_batched_trsm<Scalar, Layout>(upper_triangle, implicit_unit_diagonal, 3, 4);
+    test_batched_trsm<Scalar, Layout>(lower_triangle, explicit_diagonal, 0, 3, 10);
+  }
+
+  TEST(BLAS3_batched_trsm, double_interleaved)
+  {
+    test_batched_trsm_all_cases<double, layout_batch_interleaved>();
+  }
+
+  TEST(BLAS3_batched_trsm, float_interleaved)
+  {
+    test_batched_trsm<float, layout_batch_interleaved>(lower_triangle, implicit_unit_diagonal, 4, 4);
+  }
+
+  TEST(BLAS3_batched_trsm, double_layout_right)
+  {
+    test_batched_trsm_all_cases<double, layout_right>();
+  }
+
+  TEST(BLAS3_batched_trsm, complex)
+  {
+    test_batched_trsm_all_cases<std::complex<double>, layout_batch_interleaved>();
+    test_batched_trsm_all_cases<std::complex<double>, layout_right>();
+  }
+
+} // end anonymous namespace
@@ -0,0 +1,531 @@
+#include "./gtest_fixtures.hpp"
+
+#include <vector>
+
+// These tests exercise the BLAS code paths of the BLAS 2 and 3
+// algorithms when LINALG_ENABLE_BLAS is defined, and the generic code
+// paths otherwise.  Each test feeds an algorithm views (transposed,
+// conjugated, scaled, row major) that the BLAS dispatch must either
+// fold into the BLAS arguments or reject, and compares with a naive
+// computation over the same views.  All values are small integers, so
+// every result is exact.
+
+namespace {
+  using LinearAlgebra::conjugate_transposed;
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::explicit_diagonal_t;
+  using LinearAlgebra::hermitian_matrix_rank_2k_update;
+  using LinearAlgebra::hermitian_matrix_rank_k_update;
+  using LinearAlgebra::hermitian_matrix_vector_product;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::matrix_rank_1_update;
+  using LinearAlgebra::matrix_rank_1_update_c;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_rank_2k_update;
+  using LinearAlgebra::symmetric_matrix_rank_k_update;
+  using LinearAlgebra::symmetric_matrix_vector_product;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::triangular_matrix_matrix_left_solve;
+  using LinearAlgebra::triangular_matrix_matrix_right_solve;
+  using LinearAlgebra::triangular_matrix_vector_solve;
+  using LinearAlgebra::upper_triangle;
+
+  using complex_t = std::complex<double>;
+
+  template<class Scalar>
+  Scalar small_integer_value(std::size_t i, std::size_t j)
+  {
+    const auto re = double(int((3 * i + 5 * j) % 7) - 3);
+    if constexpr (std::is_same_v<Scalar, complex_t>) {
+      return Scalar(re, double(int((2 * i + j) % 5) - 2));
+    } else {
+      return Scalar(re);
+    }
+  }
+
+  template<class Scalar>
+  Scalar conj_value(const Scalar& x)
+  {
+    if constexpr (std::is_same_v<Scalar, complex_t>) {
+      return std::conj(x);
+    } else {
+      return x;
+    }
+  }
+
+  template<class Scalar>
+  Scalar real_value(const Scalar& x)
+  {
+    if constexpr (std::is_same_v<Scalar, complex_t>) {
+      return Scalar(x.real());
+    } else {
+      return x;
+    }
+  }
+
+  // Owns the storage of a rows x cols matrix with the given layout.
+  template<class Scalar, class Layout>
+  struct matrix {
+    using view_type = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+
+    matrix(std::size_t rows, std::size_t cols, std::size_t seed) :
+      storage(rows * cols), view(storage.data(), rows, cols)
+    {
+      for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+          view(i,j) = small_integer_value<Scalar>(i + seed, j);
+        }
+      }
+    }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  template<class Scalar>
+  struct vector {
+    using view_type = mdspan<Scalar, dextents<std::size_t, 1>>;
+
+    vector(std::size_t n, std::size_t seed) :
+      storage(n), view(storage.data(), n)
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        view(i) = small_integer_value<Scalar>(i, seed);
+      }
+    }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  // Element (i,j) of the symmetric (or Hermitian) matrix whose triangle
+  // t is stored in A.
+  template<bool Hermitian, class Triangle, class in_matrix_t>
+  auto structured_value(const in_matrix_t& A, std::size_t i, std::size_t j)
+  {
+    using value_type = typename in_matrix_t::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    if (i == j) {
+      return Hermitian ? real_value(value_type(A(i,i))) : value_type(A(i,i));
+    }
+    if ((i > j) == lower) {
+      return value_type(A(i,j));
+    }
+    return Hermitian ? conj_value(value_type(A(j,i))) : value_type(A(j,i));
+  }
+
+  // Makes A's triangle t well conditioned for a triangular solve with
+  // exact results: the diagonal is all ones (or minus ones).
+  template<class Triangle, class in_matrix_t>
+  void make_unit_triangular(const in_matrix_t& A)
+  {
+    using value_type = typename in_matrix_t::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t n = A.extent(0);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        if (i == j) {
+          A(i,j) = i % 2 == 0 ? value_type(1) : value_type(-1);
+        } else if ((i > j) == lower) {
+          // Keep the off-diagonal part small so X stays small.
+          A(i,j) = (i + j) % 3 == 0 ? A(i,j) : value_type{};
+        }
+      }
+    }
+  }
+
+  template<bool ImplicitUnitDiagonal, class Triangle, class in_matrix_t>
+  auto triangular_value(const in_matrix_t& A, std::size_t i, std::size_t j)
+  {
+    using value_type = typename in_matrix_t::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    if (i == j) {
+      return ImplicitUnitDiagonal ? value_type(1) : value_type(A(i,i));
+    }
+    return (i > j) == lower ? value_type(A(i,j)) : value_type{};
+  }
+
+  template<class Scalar, class Layout>
+  void test_blas_gemv()
+  {
+    constexpr std::size_t m = 7;
+    constexpr std::size_t n = 5;
+    matrix<Scalar, Layout> A(m, n, 1);
+    vector<Scalar> x(n, 2);
+    vector<Scalar> x_t(m, 3);
+    vector<Scalar> y(m, 4);
+    vector<Scalar> z(n, 5);
+    const Scalar alpha(-2);
+    const Scalar beta(3);
+
+    // y = (alpha * A) * x
+    matrix_vector_product(scaled(alpha, A.view), x.view, y.view);
+    for (std::size_t i = 0; i < m; ++i) {
+      Scalar expected{};
+      for (std::size_t j = 0; j < n; ++j) {
+        expected += alpha * A.view(i,j) * x.view(j);
+      }
+      EXPECT_EQ(y.view(i), expected) << "gemv differs at " << i;
+    }
+
+    // z = beta * z + A^H * x_t, in place
+    std::vector<Scalar> z_expected(n);
+    for (std::size_t j = 0; j < n; ++j) {
+      z_expected[j] = beta * z.view(j);
+      for (std::size_t i = 0; i < m; ++i) {
+        z_expected[j] += conj_value(A.view(i,j)) * x_t.view(i);
+      }
+    }
+    matrix_vector_product(conjugate_transposed(A.view), x_t.view,
+                          scaled(beta, z.view), z.view);
+    for (std::size_t j = 0; j < n; ++j) {
+      EXPECT_EQ(z.view(j), z_expected[j]) << "gemv update differs at " << j;
+    }
+
+    // y = conj(A) * x; the BLAS can't conjugate without transposing,
+    // unless A is row major.
+    matrix_vector_product(conjugated(A.view), x.view, y.view);
+    for (std::size_t i = 0; i < m; ++i) {
+      Scalar expected{};
+      for (std::size_t j = 0; j < n; ++j) {
+        expected += conj_value(A.view(i,j)) * x.view(j);
+      }
+      EXPECT_EQ(y.view(i), expected) << "conj gemv differs at " << i;
+    }
+  }
+
+  template<bool Hermitian, class Scalar, class Layout, class Triangle, class in_matrix_t>
+  void check_symmetric_matrix_vector_product(const in_matrix_t& A_view, Triangle t)
+  {
+    constexpr std::size_t n = 6;
+    vector<Scalar> x(n, 2);
+    vector<Scalar> y(n, 3);
+    vector<Scalar> z(n, 4);
+    const Scalar beta(-2);
+
+    std::vector<Scalar> y_expected(n);
+    std::vector<Scalar> z_expected(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      z_expected[i] = beta * z.view(i);
+      for (std::size_t j = 0; j < n; ++j) {
+        const auto A_ij = structured_value<Hermitian, Triangle>(A_view, i, j);
+        y_expected[i] += A_ij * x.view(j);
+        z_expected[i] += A_ij * x.view(j);
+      }
+    }
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_vector_product(A_view, t, x.view, y.view);
+      hermitian_matrix_vector_product(A_view, t, x.view, scaled(beta, z.view), z.view);
+    } else {
+      symmetric_matrix_vector_product(A_view, t, x.view, y.view);
+      symmetric_matrix_vector_product(A_view, t, x.view, scaled(beta, z.view), z.view);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(y.view(i), y_expected[i]) << "symv/hemv differs at " << i;
+      EXPECT_EQ(z.view(i), z_expected[i]) << "symv/hemv update differs at " << i;
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_blas_symv_hemv()
+  {
+    constexpr std::size_t n = 6;
+    matrix<Scalar, Layout> A(n, n, 1);
+
+    check_symmetric_matrix_vector_product<false, Scalar, Layout>(A.view, lower_triangle);
+    check_symmetric_matrix_vector_product<false, Scalar, Layout>(transposed(A.view), upper_triangle);
+    check_symmetric_matrix_vector_product<true, Scalar, Layout>(A.view, upper_triangle);
+    check_symmetric_matrix_vector_product<true, Scalar, Layout>(conjugate_transposed(A.view), lower_triangle);
+    check_symmetric_matrix_vector_product<true, Scalar, Layout>(scaled(Scalar(2), A.view), lower_triangle);
+  }
+
+  template<class Scalar, class Layout, class Triangle, class DiagonalStorage>
+  void check_triangular_solves(Triangle t, DiagonalStorage d)
+  {
+    constexpr bool implicit_unit =
+      ! std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+    constexpr std::size_t n = 6;
+    constexpr std::size_t k = 4;
+    matrix<Scalar, Layout> A(n, n, 1);
+    make_unit_triangular<Triangle>(A.view);
+
+    // Solve op(A) x = b for each op, where b = op(A) x_expected.
+    auto check_trsv = [&] (auto op_A, auto tri) {
+      using op_triangle = decltype(tri);
+      vector<Scalar> x_expected(n, 2);
+      vector<Scalar> b(n, 0);
+      vector<Scalar> x(n, 0);
+      for (std::size_t i = 0; i < n; ++i) {
+        b.view(i) = Scalar{};
+        for (std::size_t j = 0; j < n; ++j) {
+          b.view(i) += triangular_value<implicit_unit, op_triangle>(op_A, i, j) * x_expected.view(j);
+        }
+      }
+      triangular_matrix_vector_solve(op_A, tri, d, b.view, x.view);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(x.view(i), x_expected.view(i)) << "trsv differs at " << i;
+      }
+      // In place
+      triangular_matrix_vector_solve(op_A, tri, d, b.view, b.view);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(b.view(i), x_expected.view(i)) << "in-place trsv differs at " << i;
+      }
+    };
+    using other_triangle = std::conditional_t<
+      std::is_same_v<Triangle, lower_triangle_t>,
+      LinearAlgebra::upper_triangle_t, lower_triangle_t>;
+    check_trsv(A.view, t);
+    check_trsv(transposed(A.view), other_triangle{});
+    check_trsv(conjugate_transposed(A.view), other_triangle{});
+    check_trsv(conjugated(A.view), t);
+
+    // Solve op(A) X = B and X op(A) = B, with X in either layout.
+    auto check_trsm = [&] (auto op_A, auto tri, auto X_layout) {
+      using op_triangle = decltype(tri);
+      using X_layout_t = decltype(X_layout);
+      matrix<Scalar, X_layout_t> X_left_expected(n, k, 2);
+      matrix<Scalar, X_layout_t> B_left(n, k, 0);
+      matrix<Scalar, X_layout_t> X_left(n, k, 0);
+      matrix<Scalar, X_layout_t> X_right_expected(k, n, 3);
+      matrix<Scalar, X_layout_t> B_right(k, n, 0);
+      matrix<Scalar, X_layout_t> X_right(k, n, 0);
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < k; ++j) {
+          B_left.view(i,j) = Scalar{};
+          B_right.view(j,i) = Scalar{};
+          for (std::size_t p = 0; p < n; ++p) {
+            B_left.view(i,j) += triangular_value<implicit_unit, op_triangle>(op_A, i, p) *
+              X_left_expected.view(p,j);
+            B_right.view(j,i) += X_right_expected.view(j,p) *
+              triangular_value<implicit_unit, op_triangle>(op_A, p, i);
+          }
+        }
+      }
+      triangular_matrix_matrix_left_solve(op_A, tri, d, B_left.view, X_left.view);
+      triangular_matrix_matrix_right_solve(op_A, tri, d, B_right.view, X_right.view);
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < k; ++j) {
+          EXPECT_EQ(X_left.view(i,j), X_left_expected.view(i,j))
+            << "left trsm differs at (" << i << "," << j << ")";
+          EXPECT_EQ(X_right.view(j,i), X_right_expected.view(j,i))
+            << "right trsm differs at (" << j << "," << i << ")";
+        }
+      }
+    };
+    check_trsm(A.view, t, layout_left{});
+    check_trsm(A.view, t, layout_right{});
+    check_trsm(transposed(A.view), other_triangle{}, layout_left{});
+    check_trsm(conjugate_transposed(A.view), other_triangle{}, layout_right{});
+    check_trsm(conjugated(A.view), t, layout_left{});
+    check_trsm(conjugated(A.view), t, layout_right{});
+  }
+
+  template<class Scalar, class Layout>
+  void test_blas_triangular_solves()
+  {
+    check_triangular_solves<Scalar, Layout>(lower_triangle, explicit_diagonal);
+    check_triangular_solves<Scalar, Layout>(upper_triangle, explicit_diagonal);
+    check_triangular_solves<Scalar, Layout>(lower_triangle, implicit_unit_diagonal);
+    check_triangular_solves<Scalar, Layout>(upper_triangle, implicit_unit_diagonal);
+  }
+
+  template<class Scalar, class Layout>
+  void test_blas_ger()
+  {
+    constexpr std::size_t m = 7;
+    constexpr std::size_t n = 5;
+    matrix<Scalar, Layout> A(m, n, 1);
+    vector<Scalar> x(m, 2);
+    vector<Scalar> y(n, 3);
+    const Scalar alpha(-3);
+
+    auto check = [&] (auto x_view, auto y_view, bool conj_y) {
+      std::vector<Scalar> expected(m * n);
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          const Scalar y_j = y_view(j);
+          expected[i * n + j] = A.view(i,j) +
+            Scalar(x_view(i)) * (conj_y ? conj_value(y_j) : y_j);
+        }
+      }
+      if (conj_y) {
+        matrix_rank_1_update_c(x_view, y_view, A.view);
+      } else {
+        matrix_rank_1_update(x_view, y_view, A.view);
+      }
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          EXPECT_EQ(A.view(i,j), expected[i * n + j])
+            << "ger differs at (" << i << "," << j << ")";
+        }
+      }
+    };
+    check(x.view, y.view, false);
+    check(scaled(alpha, x.view), y.view, true);
+    check(x.view, conjugated(scaled(alpha, y.view)), false);
+    check(conjugated(x.view), y.view, false);
+    check(conjugated(x.view), y.view, true);
+  }
+
+  template<bool Hermitian, class Scalar, class Layout_C, class Triangle, class in_matrix_t>
+  void check_rank_k_update(const in_matrix_t& A_view, Triangle t)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t n = A_view.extent(0);
+    const std::size_t k = A_view.extent(1);
+    matrix<Scalar, Layout_C> C(n, n, 4);
+    if constexpr (Hermitian) {
+      // ?herk and ?her2k assume that C's diagonal is real.
+      for (std::size_t i = 0; i < n; ++i) {
+        C.view(i,i) = real_value(C.view(i,i));
+      }
+    }
+    const double alpha(-2);
+
+    std::vector<Scalar> expected(C.storage);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        if (i == j || (i > j) == lower) {
+          Scalar sum{};
+          for (std::size_t p = 0; p < k; ++p) {
+            const Scalar A_jp = A_view(j,p);
+            sum += Scalar(A_view(i,p)) * (Hermitian ? conj_value(A_jp) : A_jp);
+          }
+          expected[i * n + j] = C.view(i,j) + Scalar(alpha) * sum;
+        } else {
+          expected[i * n + j] = C.view(i,j);
+        }
+      }
+    }
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_rank_k_update(alpha, A_view, C.view, t);
+    } else {
+      symmetric_matrix_rank_k_update(alpha, A_view, C.view, t);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(C.view(i,j), expected[i * n + j])
+          << "syrk/herk differs at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  template<bool Hermitian, class Scalar, class Layout_C, class Triangle,
+           class in_matrix_1_t, class in_matrix_2_t>
+  void check_rank_2k_update(const in_matrix_1_t& A_view, const in_matrix_2_t& B_view,
+                            Triangle t)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t n = A_view.extent(0);
+    const std::size_t k = A_view.extent(1);
+    matrix<Scalar, Layout_C> C(n, n, 4);
+    if constexpr (Hermitian) {
+      // ?herk and ?her2k assume that C's diagonal is real.
+      for (std::size_t i = 0; i < n; ++i) {
+        C.view(i,i) = real_value(C.view(i,i));
+      }
+    }
+
+    std::vector<Scalar> expected(C.storage);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        Scalar sum = C.view(i,j);
+        if (i == j || (i > j) == lower) {
+          for (std::size_t p = 0; p < k; ++p) {
+            const Scalar A_jp = A_view(j,p);
+            const Scalar B_jp = B_view(j,p);
+            sum += Scalar(A_view(i,p)) * (Hermitian ? conj_value(B_jp) : B_jp) +
+              Scalar(B_view(i,p)) * (Hermitian ? conj_value(A_jp) : A_jp);
+          }
+        }
+        expected[i * n + j] = sum;
+      }
+    }
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_rank_2k_update(A_view, B_view, C.view, t);
+    } else {
+      symmetric_matrix_rank_2k_update(A_view, B_view, C.view, t);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(C.view(i,j), expected[i * n + j])
+          << "syr2k/her2k differs at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  template<class Scalar, class Layout_C>
+  void test_blas_rank_k_updates()
+  {
+    constexpr std::size_t n = 6;
+    constexpr std::size_t k = 4;
+    matrix<Scalar, layout_left> A(n, k, 1);
+    matrix<Scalar, layout_right> B(n, k, 2);
+    matrix<Scalar, layout_left> A_t(k, n, 3);
+    matrix<Scalar, layout_left> B_t(k, n, 5);
+    const Scalar alpha(3);
+
+    check_rank_k_update<false, Scalar, Layout_C>(A.view, lower_triangle);
+    check_rank_k_update<false, Scalar, Layout_C>(scaled(alpha, B.view), upper_triangle);
+    check_rank_k_update<false, Scalar, Layout_C>(transposed(A_t.view), lower_triangle);
+    check_rank_k_update<false, Scalar, Layout_C>(conjugated(A.view), upper_triangle);
+    check_rank_k_update<true, Scalar, Layout_C>(A.view, upper_triangle);
+    check_rank_k_update<true, Scalar, Layout_C>(scaled(alpha, B.view), lower_triangle);
+    check_rank_k_update<true, Scalar, Layout_C>(conjugate_transposed(A_t.view), upper_triangle);
+    check_rank_k_update<true, Scalar, Layout_C>(conjugated(B.view), lower_triangle);
+    check_rank_k_update<true, Scalar, Layout_C>(transposed(A_t.view), lower_triangle);
+
+    check_rank_2k_update<false, Scalar, Layout_C>(A.view, scaled(alpha, A.view), lower_triangle);
+    check_rank_2k_update<false, Scalar, Layout_C>(transposed(A_t.view), transposed(B_t.view), upper_triangle);
+    check_rank_2k_update<false, Scalar, Layout_C>(A.view, B.view, upper_triangle);
+    check_rank_2k_update<true, Scalar, Layout_C>(A.view, scaled(alpha, A.view), upper_triangle);
+    check_rank_2k_update<true, Scalar, Layout_C>(conjugate_transposed(A_t.view),
+                                                 conjugate_transposed(B_t.view), lower_triangle);
+    check_rank_2k_update<true, Scalar, Layout_C>(conjugated(B.view), conjugated(B.view), lower_triangle);
+    check_rank_2k_update<true, Scalar, Layout_C>(transposed(A_t.view), A.view, upper_triangle);
+  }
+
+#define LINALG_BLAS_DISPATCH_TESTS(NAME, FUNCTION) \
+  TEST(BLAS_dispatch, NAME##_double_layout_left) { FUNCTION<double, layout_left>(); } \
+  TEST(BLAS_dispatch, NAME##_double_layout_right) { FUNCTION<double, layout_right>(); } \
+  TEST(BLAS_dispatch, NAME##_complex_layout_left) { FUNCTION<complex_t, layout_left>(); } \
+  TEST(BLAS_dispatch, NAME##_complex_layout_right) { FUNCTION<complex_t, layout_right>(); }
+
+  LINALG_BLAS_DISPATCH_TESTS(gemv, test_blas_gemv)
+  LINALG_BLAS_DISPATCH_TESTS(symv_hemv, test_blas_symv_hemv)
+  LINALG_BLAS_DISPATCH_TESTS(trsv_trsm, test_blas_triangular_solves)
+  LINALG_BLAS_DISPATCH_TESTS(ger, test_blas_ger)
+  LINALG_BLAS_DISPATCH_TESTS(syrk_syr2k, test_blas_rank_k_updates)
+
+#undef LINALG_BLAS_DISPATCH_TESTS
+
+#ifdef LINALG_ENABLE_BLAS
+  namespace impl = LinearAlgebra::impl;
+  using dmatrix_t = mdspan<double, dextents<std::size_t, 2>>;
+  using dvector_t = mdspan<double, dextents<std::size_t, 1>>;
+  using zmatrix_t = mdspan<complex_t, dextents<std::size_t, 2>>;
+  using zvector_t = mdspan<complex_t, dextents<std::size_t, 1>>;
+
+  static_assert(impl::matrix_vector_product_dispatch_to_blas<dmatrix_t, dvector_t, dvector_t>());
+  static_assert(! impl::matrix_vector_product_dispatch_to_blas<
+    zmatrix_t, decltype(conjugated(std::declval<zvector_t>())), zvector_t>());
+  static_assert(! impl::symmetric_matrix_vector_product_dispatch_to_blas<
+    false, zmatrix_t, zvector_t, zvector_t>());
+  static_assert(impl::symmetric_matrix_vector_product_dispatch_to_blas<
+    true, zmatrix_t, zvector_t, zvector_t>());
+  static_assert(! impl::rank_k_update_dispatch_to_blas<
+    false, double, decltype(conjugated(std::declval<zmatrix_t>())), zmatrix_t>());
+  static_assert(impl::rank_k_update_dispatch_to_blas<
+    true, double, decltype(conjugated(std::declval<zmatrix_t>())), zmatrix_t>());
+  static_assert(! impl::triangular_matrix_matrix_solve_dispatch_to_blas<
+    dmatrix_t, dmatrix_t, decltype(scaled(2.0, std::declval<dmatrix_t>()))>());
+#endif // LINALG_ENABLE_BLAS
+
+} // end anonymous namespace
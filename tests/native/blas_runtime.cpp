@@ -0,0 +1,127 @@
+#include "./gtest_fixtures.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dlfcn.h>
+
+// LINALG_BLAS_STUB_LIBRARY is the path of a stand-in BLAS (see
+// blas_runtime_stub.cpp) that has only dgemm_ and dgemv_.
+
+namespace {
+  using LinearAlgebra::load_blas_library;
+  using LinearAlgebra::load_default_blas_library;
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::unload_blas_library;
+
+  const std::string stub_library = LINALG_BLAS_STUB_LIBRARY;
+
+  // How often the stub's routines have been called.
+  int stub_calls()
+  {
+    void* handle = dlopen(stub_library.c_str(), RTLD_NOW | RTLD_LOCAL);
+    EXPECT_NE(handle, nullptr);
+    const int* calls = static_cast<const int*>(dlsym(handle, "linalg_blas_stub_calls"));
+    EXPECT_NE(calls, nullptr);
+    const int result = *calls;
+    dlclose(handle);
+    return result;
+  }
+
+  // Computes C = A * B and y = A * x, and checks the results.
+  template<class Scalar>
+  void check_products()
+  {
+    constexpr std::size_t m = 5;
+    constexpr std::size_t n = 4;
+    constexpr std::size_t k = 3;
+    std::vector<Scalar> A_storage(m * k), B_storage(k * n), C_storage(m * n);
+    std::vector<Scalar> x_storage(k), y_storage(m);
+    mdspan<Scalar, dextents<std::size_t, 2>, layout_left> A(A_storage.data(), m, k);
+    mdspan<Scalar, dextents<std::size_t, 2>, layout_left> B(B_storage.data(), k, n);
+    mdspan<Scalar, dextents<std::size_t, 2>, layout_left> C(C_storage.data(), m, n);
+    mdspan<Scalar, dextents<std::size_t, 1>> x(x_storage.data(), k);
+    mdspan<Scalar, dextents<std::size_t, 1>> y(y_storage.data(), m);
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t i = 0; i < m; ++i) {
+        A(i,p) = Scalar(double(i) - double(2 * p));
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        B(p,j) = Scalar(double(p + j) - 2.0);
+      }
+      x(p) = Scalar(double(p) + 1.0);
+    }
+
+    matrix_product(A, B, C);
+    matrix_vector_product(A, x, y);
+    for (std::size_t i = 0; i < m; ++i) {
+      Scalar y_i{};
+      for (std::size_t p = 0; p < k; ++p) {
+        y_i += A(i,p) * x(p);
+      }
+      EXPECT_EQ(y(i), y_i) << "y differs at " << i;
+      for (std::size_t j = 0; j < n; ++j) {
+        Scalar C_ij{};
+        for (std::size_t p = 0; p < k; ++p) {
+          C_ij += A(i,p) * B(p,j);
+        }
+        EXPECT_EQ(C(i,j), C_ij) << "C differs at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+  TEST(BLAS_runtime, stub_library_provides_double)
+  {
+    ASSERT_TRUE(load_blas_library(stub_library));
+    const int calls = stub_calls();
+    check_products<double>();
+    EXPECT_EQ(stub_calls(), calls + 2);
+    unload_blas_library();
+  }
+
+  TEST(BLAS_runtime, missing_routines_use_generic_implementation)
+  {
+    ASSERT_TRUE(load_blas_library(stub_library));
+    const int calls = stub_calls();
+    check_products<float>();
+    check_products<std::complex<double>>();
+    EXPECT_EQ(stub_calls(), calls);
+    unload_blas_library();
+  }
+
+  TEST(BLAS_runtime, library_list_skips_missing_libraries)
+  {
+    ASSERT_TRUE(load_blas_library("liblinalg_no_such_blas.so:" + stub_library));
+    const int calls = stub_calls();
+    check_products<double>();
+    EXPECT_EQ(stub_calls(), calls + 2);
+    unload_blas_library();
+  }
+
+  TEST(BLAS_runtime, no_library_uses_generic_implementation)
+  {
+    EXPECT_FALSE(load_blas_library("liblinalg_no_such_blas.so"));
+    check_products<double>();
+    EXPECT_FALSE(load_blas_library(""));
+    check_products<double>();
+  }
+
+  TEST(BLAS_runtime, environment_variable)
+  {
+    ASSERT_EQ(setenv("LINALG_BLAS_LIBRARY", stub_library.c_str(), 1), 0);
+    ASSERT_TRUE(load_default_blas_library());
+    const int calls = stub_calls();
+    check_products<double>();
+    EXPECT_EQ(stub_calls(), calls + 2);
+
+    // An empty list means no BLAS.
+    ASSERT_EQ(setenv("LINALG_BLAS_LIBRARY", "", 1), 0);
+    EXPECT_FALSE(load_default_blas_library());
+    check_products<double>();
+    ASSERT_EQ(unsetenv("LINALG_BLAS_LIBRARY"), 0);
+    unload_blas_library();
+  }
+
+} // end anonymous namespace
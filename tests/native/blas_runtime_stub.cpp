@@ -0,0 +1,55 @@
+// A stand-in BLAS shared library for the blas_runtime test.  It has
+// only dgemm_ and dgemv_, and counts how often they are called.
+
+extern "C" {
+
+int linalg_blas_stub_calls = 0;
+
+void dgemm_(const char TRANSA[], const char TRANSB[],
+            const int* M, const int* N, const int* K,
+            const double* ALPHA,
+            const double* A, const int* LDA,
+            const double* B, const int* LDB,
+            const double* BETA,
+            double* C, const int* LDC)
+{
+  ++linalg_blas_stub_calls;
+  const bool trans_A = TRANSA[0] != 'N' && TRANSA[0] != 'n';
+  const bool trans_B = TRANSB[0] != 'N' && TRANSB[0] != 'n';
+  for (int j = 0; j < *N; ++j) {
+    for (int i = 0; i < *M; ++i) {
+      double sum = 0.0;
+      for (int p = 0; p < *K; ++p) {
+        const double A_ip = trans_A ? A[p + i * *LDA] : A[i + p * *LDA];
+        const double B_pj = trans_B ? B[j + p * *LDB] : B[p + j * *LDB];
+        sum += A_ip * B_pj;
+      }
+      double& C_ij = C[i + j * *LDC];
+      C_ij = (*BETA == 0.0 ? 0.0 : *BETA * C_ij) + *ALPHA * sum;
+    }
+  }
+}
+
+void dgemv_(const char TRANS[], const int* M, const int* N,
+            const double* ALPHA,
+            const double* A, const int* LDA,
+            const double* X, const int* INCX,
+            const double* BETA,
+            double* Y, const int* INCY)
+{
+  ++linalg_blas_stub_calls;
+  const bool trans = TRANS[0] != 'N' && TRANS[0] != 'n';
+  const int rows = trans ? *N : *M;
+  const int cols = trans ? *M : *N;
+  for (int i = 0; i < rows; ++i) {
+    double sum = 0.0;
+    for (int j = 0; j < cols; ++j) {
+      const double A_ij = trans ? A[j + i * *LDA] : A[i + j * *LDA];
+      sum += A_ij * X[j * *INCX];
+    }
+    double& y_i = Y[i * *INCY];
+    y_i = (*BETA == 0.0 ? 0.0 : *BETA * y_i) + *ALPHA * sum;
+  }
+}
+
+} // extern "C"
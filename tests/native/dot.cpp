@@ -179,6 +179,102 @@ namespace {
     static_assert( std::is_same_v<std::remove_const_t<decltype(conjDotResultTwoArg)>, scalar_t> );
     EXPECT_EQ( conjDotResultTwoArg, expectedConjDotResult );
   }
+
+  // Small integer values, so that sums are exact in any order.
+  template<class scalar_t>
+  scalar_t dot_test_value(std::size_t k, std::size_t seed)
+  {
+    const int re = int((3 * k + seed) % 7) - 3;
+    if constexpr (LinearAlgebra::impl::is_complex_v<scalar_t>) {
+      return scalar_t(re, int((5 * k + 2 * seed) % 9) - 4);
+    } else {
+      return scalar_t(re);
+    }
+  }
+
+  // Checks each SIMD kernel up to the one this CPU runs, on lengths
+  // that exercise the unrolled loop, the single-vector loop, and the
+  // scalar tail, with unit and non-unit strides.
+  template<class scalar_t>
+  void test_simd_dot_kernels()
+  {
+    using LinearAlgebra::impl::simd_isa;
+    constexpr std::size_t max_n = 1001;
+    std::vector<scalar_t> x(2 * max_n), y(3 * max_n);
+    for (std::size_t k = 0; k < x.size(); ++k) {
+      x[k] = dot_test_value<scalar_t>(k, 1);
+    }
+    for (std::size_t k = 0; k < y.size(); ++k) {
+      y[k] = dot_test_value<scalar_t>(k, 2);
+    }
+
+    for (std::size_t n : std::initializer_list<std::size_t>{0, 1, 3, 7, 16, 33, 100, max_n}) {
+      for (std::ptrdiff_t incx : {1, 2}) {
+        for (std::ptrdiff_t incy : {1, 3}) {
+          scalar_t expected{}, expected_conj{};
+          for (std::size_t k = 0; k < n; ++k) {
+            const scalar_t x_k = x[k * incx];
+            const scalar_t y_k = y[k * incy];
+            expected += x_k * y_k;
+            expected_conj += LinearAlgebra::impl::conj_if_needed(x_k) * y_k;
+          }
+          for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+            if (isa > LinearAlgebra::impl::active_simd_isa()) {
+              continue;
+            }
+            EXPECT_EQ((LinearAlgebra::impl::simd_dot<false>(
+              isa, n, x.data(), incx, y.data(), incy)), expected);
+            EXPECT_EQ((LinearAlgebra::impl::simd_dot<true>(
+              isa, n, x.data(), incx, y.data(), incy)), expected_conj);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(BLAS1_dot, simd_kernels)
+  {
+    test_simd_dot_kernels<double>();
+    test_simd_dot_kernels<float>();
+    test_simd_dot_kernels<std::complex<double>>();
+    test_simd_dot_kernels<std::complex<float>>();
+  }
+
+  TEST(BLAS1_dot, long_strided_scaled_conjugated)
+  {
+    using scalar_t = std::complex<double>;
+    using LinearAlgebra::conjugated;
+    using LinearAlgebra::scaled;
+    using vector_t = mdspan<scalar_t, dextents<std::size_t, 1>>;
+    using strided_t = mdspan<scalar_t, dextents<std::size_t, 1>, layout_stride>;
+
+    constexpr std::size_t n = 203;
+    std::vector<scalar_t> x_storage(n), y_storage(2 * n);
+    for (std::size_t k = 0; k < n; ++k) {
+      x_storage[k] = dot_test_value<scalar_t>(k, 1);
+    }
+    for (std::size_t k = 0; k < 2 * n; ++k) {
+      y_storage[k] = dot_test_value<scalar_t>(k, 2);
+    }
+    vector_t x(x_storage.data(), n);
+    const std::array<std::size_t, 1> strides{2};
+    strided_t y(y_storage.data(), layout_stride::mapping<dextents<std::size_t, 1>>(
+      dextents<std::size_t, 1>(n), strides));
+
+    const scalar_t alpha(2.0, -1.0);
+    scalar_t expected{}, expected_c{}, expected_cc{};
+    for (std::size_t k = 0; k < n; ++k) {
+      expected += alpha * x(k) * y(k);
+      expected_c += std::conj(x(k)) * y(k);
+      expected_cc += std::conj(x(k)) * std::conj(alpha * y(k));
+    }
+
+    EXPECT_EQ(dot(scaled(alpha, x), y), expected);
+    EXPECT_EQ(dot(x, y, scalar_t(1.0)), dot(x, y) + scalar_t(1.0));
+    EXPECT_EQ(dotc(x, y), expected_c);
+    EXPECT_EQ(dot(conjugated(x), y), expected_c);
+    EXPECT_EQ(dotc(x, conjugated(scaled(alpha, y))), expected_cc);
+  }
 }
 
 // int main() {
@@ -2,6 +2,8 @@
 #include <iostream>
 
 namespace {
+  using LinearAlgebra::conjugate_transposed;
+  using LinearAlgebra::conjugated;
   using LinearAlgebra::explicit_diagonal;
   using LinearAlgebra::implicit_unit_diagonal;
   using LinearAlgebra::lower_triangle;
@@ -225,4 +227,286 @@ namespace {
     test_matrix_product<double>();
   }
 
+  // These sizes are large enough to go through the cache-blocked,
+  // packed engine, and none of them is a multiple of the register or
+  // cache block sizes.  All entries are small integers, so every
+  // partial sum is exact and the blocked result must match the
+  // triple loop exactly, whatever order the engine adds things in.
+  template<class Scalar, class Layout_C>
+  void test_packed_matrix_product()
+  {
+    using matrix_t = mdspan<Scalar, dextents<std::size_t, 2>, layout_left>;
+    using out_matrix_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout_C>;
+
+    const std::array<std::size_t, 3> sizes[] = {
+      {37, 29, 41}, {150, 70, 300}, {5, 130, 9}
+    };
+    for (const auto& mnk : sizes) {
+      const std::size_t m = mnk[0];
+      const std::size_t n = mnk[1];
+      const std::size_t k = mnk[2];
+
+      std::vector<Scalar> A_storage(m * k);
+      std::vector<Scalar> B_t_storage(n * k);
+      std::vector<Scalar> E_storage(m * n);
+      std::vector<Scalar> C_storage(m * n);
+      std::vector<Scalar> AB_storage(m * n);
+      matrix_t A(A_storage.data(), m, k);
+      matrix_t B_t(B_t_storage.data(), n, k);
+      matrix_t E(E_storage.data(), m, n);
+      out_matrix_t C(C_storage.data(), m, n);
+      matrix_t AB(AB_storage.data(), m, n);
+
+      for (std::size_t j = 0; j < k; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          A(i,j) = Scalar(int((3 * i + 7 * j) % 11) - 5);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+          B_t(i,j) = Scalar(int((5 * i + 2 * j) % 7) - 3);
+        }
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          E(i,j) = Scalar(int((i + j) % 5));
+          AB(i,j) = Scalar{};
+          for (std::size_t p = 0; p < k; ++p) {
+            AB(i,j) += A(i,p) * B_t(j,p);
+          }
+        }
+      }
+      auto B = transposed(B_t);
+
+      matrix_product(A, B, C);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          ASSERT_EQ(C(i,j), AB(i,j)) << "C = A*B differs at (" << i << "," << j << ")";
+        }
+      }
+
+      matrix_product(scaled(Scalar(2), A), B, C);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          ASSERT_EQ(C(i,j), Scalar(2) * AB(i,j)) << "C = 2A*B differs at (" << i << "," << j << ")";
+        }
+      }
+
+      matrix_product(A, B, E, C);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          ASSERT_EQ(C(i,j), E(i,j) + AB(i,j)) << "C = E + A*B differs at (" << i << "," << j << ")";
+        }
+      }
+
+      // The updating overload permits E and C to be the same matrix.
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          C(i,j) = E(i,j);
+        }
+      }
+      matrix_product(A, B, C, C);
+      for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < m; ++i) {
+          ASSERT_EQ(C(i,j), E(i,j) + AB(i,j)) << "C = C + A*B differs at (" << i << "," << j << ")";
+        }
+      }
+    }
+  }
+
+  TEST(BLAS3_gemm, packed_int_layout_right)
+  {
+    test_packed_matrix_product<int, layout_right>();
+  }
+
+  TEST(BLAS3_gemm, packed_float_layout_left)
+  {
+    test_packed_matrix_product<float, layout_left>();
+  }
+
+  TEST(BLAS3_gemm, packed_double_layout_left)
+  {
+    test_packed_matrix_product<double, layout_left>();
+  }
+
+  TEST(BLAS3_gemm, packed_double_layout_right)
+  {
+    test_packed_matrix_product<double, layout_right>();
+  }
+
+
+  // Tests for the views that the BLAS path folds into TRANSA, TRANSB,
+  // alpha and beta.  They must give the same answers whether or not
+  // LINALG_ENABLE_BLAS is defined.  Entries are small integers (real
+  // and imaginary parts alike), so all results are exact.
+  template<class Scalar>
+  Scalar small_integer_value(std::size_t i, std::size_t j)
+  {
+    const auto re = double(int((3 * i + 5 * j) % 7) - 3);
+    if constexpr (std::is_same_v<Scalar, std::complex<double>>) {
+      return Scalar(re, double(int((2 * i + j) % 5) - 2));
+    } else {
+      return Scalar(re);
+    }
+  }
+
+  template<class Scalar>
+  Scalar conj_value(const Scalar& x)
+  {
+    if constexpr (std::is_same_v<Scalar, std::complex<double>>) {
+      return std::conj(x);
+    } else {
+      return x;
+    }
+  }
+
+  template<class Scalar, class Layout_C>
+  void test_blas_matrix_product()
+  {
+    using matrix_t = mdspan<Scalar, dextents<std::size_t, 2>, layout_left>;
+    using out_matrix_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout_C>;
+
+    constexpr std::size_t m = 13;
+    constexpr std::size_t n = 9;
+    constexpr std::size_t k = 11;
+
+    // A_t is stored k x m; A_big holds an m x k submatrix A.
+    std::vector<Scalar> A_t_storage(k * m);
+    std::vector<Scalar> A_big_storage((m + 3) * (k + 2));
+    std::vector<Scalar> B_storage(k * n);
+    std::vector<Scalar> E_storage(m * n);
+    std::vector<Scalar> C_storage(m * n);
+    matrix_t A_t(A_t_storage.data(), k, m);
+    matrix_t A_big(A_big_storage.data(), m + 3, k + 2);
+    matrix_t B(B_storage.data(), k, n);
+    matrix_t E(E_storage.data(), m, n);
+    out_matrix_t C(C_storage.data(), m, n);
+    auto A = submdspan(A_big, std::pair{std::size_t(2), std::size_t(2 + m)},
+                       std::pair{std::size_t(1), std::size_t(1 + k)});
+
+    for (std::size_t j = 0; j < A_big.extent(1); ++j) {
+      for (std::size_t i = 0; i < A_big.extent(0); ++i) {
+        A_big(i,j) = small_integer_value<Scalar>(i, j + 1);
+      }
+    }
+    for (std::size_t j = 0; j < m; ++j) {
+      for (std::size_t i = 0; i < k; ++i) {
+        A_t(i,j) = small_integer_value<Scalar>(i + 2, j);
+      }
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < k; ++i) {
+        B(i,j) = small_integer_value<Scalar>(j, i);
+      }
+      for (std::size_t i = 0; i < m; ++i) {
+        E(i,j) = small_integer_value<Scalar>(i + j, 1);
+      }
+    }
+
+    Scalar alpha(2);
+    Scalar beta(-1);
+    if constexpr (std::is_same_v<Scalar, std::complex<double>>) {
+      alpha = Scalar(2, -1);
+      beta = Scalar(-1, 3);
+    }
+
+    // C = A_t^H * (alpha * B)
+    matrix_product(conjugate_transposed(A_t), scaled(alpha, B), C);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        Scalar expected{};
+        for (std::size_t p = 0; p < k; ++p) {
+          expected += conj_value(A_t(p,i)) * (alpha * B(p,j));
+        }
+        ASSERT_EQ(C(i,j), expected) << "C = A_t^H * alpha B differs at (" << i << "," << j << ")";
+      }
+    }
+
+    // C = conj(A) * B has no TRANS code, so it must not go to the BLAS.
+    matrix_product(conjugated(A), B, C);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        Scalar expected{};
+        for (std::size_t p = 0; p < k; ++p) {
+          expected += conj_value(A(i,p)) * B(p,j);
+        }
+        ASSERT_EQ(C(i,j), expected) << "C = conj(A) * B differs at (" << i << "," << j << ")";
+      }
+    }
+
+    // C = beta * C + (alpha * A_t)^T * B
+    const std::vector<Scalar> C_orig(C_storage);
+    matrix_product(transposed(scaled(alpha, A_t)), B, scaled(beta, C), C);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        Scalar expected = beta * C_orig[C.mapping()(i,j)];
+        for (std::size_t p = 0; p < k; ++p) {
+          expected += (alpha * A_t(p,i)) * B(p,j);
+        }
+        ASSERT_EQ(C(i,j), expected) << "C = beta C + (alpha A_t)^T * B differs at (" << i << "," << j << ")";
+      }
+    }
+
+    // C = E + A * B, where A is a submatrix
+    matrix_product(A, B, E, C);
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        Scalar expected = E(i,j);
+        for (std::size_t p = 0; p < k; ++p) {
+          expected += A(i,p) * B(p,j);
+        }
+        ASSERT_EQ(C(i,j), expected) << "C = E + A * B differs at (" << i << "," << j << ")";
+      }
+    }
+  }
+
+#ifdef LINALG_ENABLE_BLAS
+  // The compile-time half of the BLAS dispatch.  The run-time half
+  // (strides, conjugation without transposition) is exercised by the
+  // numerical tests below.
+  using dbl_matrix_t = mdspan<double, dextents<std::size_t, 2>, layout_left>;
+  using cpx_matrix_t = mdspan<std::complex<double>, dextents<std::size_t, 2>, layout_left>;
+  using flt_matrix_t = mdspan<float, dextents<std::size_t, 2>, layout_left>;
+  using int_matrix_t = mdspan<int, dextents<std::size_t, 2>, layout_left>;
+  using dbl_static_matrix_t = mdspan<double, extents<std::size_t, 4, 4>, layout_left>;
+
+  template<class A_t, class B_t, class C_t>
+  constexpr bool gemm_goes_to_blas_v =
+    LinearAlgebra::impl::matrix_product_dispatch_to_blas<A_t, B_t, C_t>();
+
+  static_assert(gemm_goes_to_blas_v<dbl_matrix_t, dbl_matrix_t, dbl_matrix_t>);
+  static_assert(gemm_goes_to_blas_v<
+    decltype(transposed(std::declval<dbl_matrix_t>())),
+    decltype(scaled(2.0, std::declval<dbl_matrix_t>())),
+    mdspan<double, dextents<std::size_t, 2>, layout_right>>);
+  static_assert(gemm_goes_to_blas_v<
+    decltype(conjugate_transposed(scaled(std::complex<double>(1.0, 2.0), std::declval<cpx_matrix_t>()))),
+    cpx_matrix_t, cpx_matrix_t>);
+  static_assert(! gemm_goes_to_blas_v<int_matrix_t, int_matrix_t, int_matrix_t>);
+  static_assert(! gemm_goes_to_blas_v<flt_matrix_t, dbl_matrix_t, dbl_matrix_t>);
+  static_assert(! gemm_goes_to_blas_v<
+    decltype(scaled(2.0, std::declval<flt_matrix_t>())), flt_matrix_t, flt_matrix_t>);
+  static_assert(! gemm_goes_to_blas_v<
+    dbl_matrix_t, dbl_matrix_t, decltype(scaled(2.0, std::declval<dbl_matrix_t>()))>);
+  static_assert(! gemm_goes_to_blas_v<dbl_static_matrix_t, dbl_static_matrix_t, dbl_static_matrix_t>);
+#endif // LINALG_ENABLE_BLAS
+
+  TEST(BLAS3_gemm, blas_views_double_layout_left)
+  {
+    test_blas_matrix_product<double, layout_left>();
+  }
+
+  TEST(BLAS3_gemm, blas_views_double_layout_right)
+  {
+    test_blas_matrix_product<double, layout_right>();
+  }
+
+  TEST(BLAS3_gemm, blas_views_complex_layout_left)
+  {
+    test_blas_matrix_product<std::complex<double>, layout_left>();
+  }
+
+  TEST(BLAS3_gemm, blas_views_complex_layout_right)
+  {
+    test_blas_matrix_product<std::complex<double>, layout_right>();
+  }
+
 } // end anonymous namespace
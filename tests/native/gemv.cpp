@@ -153,4 +153,152 @@ namespace {
   {
     test_matrix_product<double>();
   }
+
+  // Small integer values, so that every product below is exact.
+  template<class Scalar>
+  Scalar gemv_test_value(std::size_t k)
+  {
+    const int re = int((7 * k + 3) % 11) - 5;
+    if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+      return Scalar(re, int((5 * k + 1) % 9) - 4);
+    } else {
+      return Scalar(re);
+    }
+  }
+
+  // Checks the row and column GEMV kernels for each instruction set up
+  // to the one this CPU runs, with full and partial vectors.
+  template<class Scalar>
+  void test_simd_gemv_kernels()
+  {
+    using LinearAlgebra::impl::simd_isa;
+    const std::size_t lda = 67;
+    std::vector<Scalar> a(4 * lda), x(lda), c{Scalar(2), Scalar(-1), Scalar(3), Scalar(1)};
+    for (std::size_t k = 0; k < a.size(); ++k) {
+      a[k] = gemv_test_value<Scalar>(k);
+    }
+    for (std::size_t k = 0; k < x.size(); ++k) {
+      x[k] = gemv_test_value<Scalar>(3 * k + 1);
+    }
+    for (std::size_t n : {1, 3, 8, 17, 64, 67}) {
+      Scalar expected_dot[4] = {};
+      std::vector<Scalar> expected_y(x);
+      for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t j = 0; j < n; ++j) {
+          expected_dot[r] += a[r * lda + j] * x[j];
+          expected_y[j] += c[r] * a[r * lda + j];
+        }
+      }
+      for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+        if (isa > LinearAlgebra::impl::active_simd_isa()) {
+          continue;
+        }
+        Scalar dot[4];
+        LinearAlgebra::impl::simd_gemv_dot_rows<4>(isa, a.data(), lda, x.data(), n, dot);
+        for (std::size_t r = 0; r < 4; ++r) {
+          EXPECT_EQ(dot[r], expected_dot[r]);
+        }
+        std::vector<Scalar> y(x);
+        LinearAlgebra::impl::simd_gemv_axpy_columns<4>(isa, a.data(), lda, c.data(), y.data(), n);
+        for (std::size_t j = 0; j < n; ++j) {
+          EXPECT_EQ(y[j], expected_y[j]);
+        }
+      }
+    }
+  }
+
+  TEST(BLAS2_gemv, simd_kernels)
+  {
+    test_simd_gemv_kernels<double>();
+    test_simd_gemv_kernels<float>();
+    test_simd_gemv_kernels<std::complex<double>>();
+  }
+
+  // Column-major, row-major, transposed, scaled and conjugated
+  // matrices, with dimensions that leave partial groups of rows and
+  // columns, and strided or aliased vectors.
+  template<class Scalar, class Layout>
+  void test_layout_aware_gemv()
+  {
+    using LinearAlgebra::conjugated;
+    using LinearAlgebra::scaled;
+    const std::size_t m = 37;
+    const std::size_t n = 23;
+    std::vector<Scalar> A_mem(m * n), x_mem(2 * m), y_mem(m), z_mem(3 * m);
+    mdspan<Scalar, dextents<std::size_t, 2>, Layout> A(A_mem.data(), m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i,j) = gemv_test_value<Scalar>(i + 5 * j);
+      }
+    }
+    for (std::size_t k = 0; k < x_mem.size(); ++k) {
+      x_mem[k] = gemv_test_value<Scalar>(2 * k + 1);
+    }
+    for (std::size_t k = 0; k < y_mem.size(); ++k) {
+      y_mem[k] = gemv_test_value<Scalar>(k + 4);
+    }
+    using stride_map = layout_stride::mapping<dextents<std::size_t, 1>>;
+    auto strided = [] (Scalar* p, std::size_t len, std::size_t inc) {
+      return mdspan<Scalar, dextents<std::size_t, 1>, layout_stride>(p,
+        stride_map(dextents<std::size_t, 1>(len), std::array<std::size_t, 1>{inc}));
+    };
+    auto conj_value = [] (Scalar v) {
+      if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+        return std::conj(v);
+      } else {
+        return v;
+      }
+    };
+
+    auto check = [&] (auto B, auto x, auto y, auto z) {
+      std::vector<Scalar> expected(B.extent(0));
+      for (std::size_t i = 0; i < B.extent(0); ++i) {
+        expected[i] = y(i);
+        for (std::size_t j = 0; j < B.extent(1); ++j) {
+          expected[i] += Scalar(B(i,j)) * Scalar(x(j));
+        }
+      }
+      matrix_vector_product(B, x, y, z);
+      for (std::size_t i = 0; i < B.extent(0); ++i) {
+        EXPECT_EQ(Scalar(z(i)), expected[i]) << "at " << i;
+      }
+    };
+    const Scalar alpha = gemv_test_value<Scalar>(2);
+    auto x_n = strided(x_mem.data(), n, 2);
+    auto x_m = strided(x_mem.data(), m, 1);
+    auto z_m = strided(z_mem.data(), m, 3);
+    auto z_n = strided(z_mem.data(), n, 1);
+    mdspan<Scalar, dextents<std::size_t, 1>> y_m(y_mem.data(), m), y_n(y_mem.data(), n);
+
+    static_assert(LinearAlgebra::impl::layout_aware_gemv_eligible<decltype(A), decltype(z_m)>());
+    check(A, x_n, y_m, z_m);
+    check(transposed(A), x_m, y_n, z_n);
+    check(scaled(alpha, A), x_n, y_m, z_m);
+    check(conjugated(transposed(A)), scaled(alpha, x_m), y_n, z_n);
+    // z = y + A*x with z and y the same vector.
+    check(A, x_n, y_m, y_m);
+    check(transposed(A), x_m, y_n, y_n);
+
+    // Overwriting form
+    std::vector<Scalar> expected(m);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        expected[i] += conj_value(A(i,j)) * x_n(j);
+      }
+    }
+    matrix_vector_product(conjugated(A), x_n, z_m);
+    for (std::size_t i = 0; i < m; ++i) {
+      EXPECT_EQ(z_m(i), expected[i]);
+    }
+  }
+
+  TEST(BLAS2_gemv, layout_aware)
+  {
+    test_layout_aware_gemv<double, layout_left>();
+    test_layout_aware_gemv<double, layout_right>();
+    test_layout_aware_gemv<float, layout_left>();
+    test_layout_aware_gemv<float, layout_right>();
+    test_layout_aware_gemv<std::complex<double>, layout_left>();
+    test_layout_aware_gemv<std::complex<double>, layout_right>();
+  }
 }
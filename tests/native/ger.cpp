@@ -0,0 +1,45 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+// matrix_rank_1_update of matrices in column-major and row-major arrays
+// takes the outer-product kernel.  Compare with the same update of a
+// copy of the matrix without a unit stride, which takes the generic
+// loops whether or not a BLAS is enabled.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::matrix_rank_1_update;
+  using LinearAlgebra::matrix_rank_1_update_c;
+  using LinearAlgebra::scaled;
+
+  // m x n with m and n not multiples of the SIMD width; x is strided.
+  template<class Scalar, class Layout>
+  void test_ger()
+  {
+    layout_stride_reference<Scalar, Layout> r(37, 29);
+    static_assert(LinearAlgebra::impl::outer_product_update_eligible<decltype(r.A)>());
+    static_assert(! LinearAlgebra::impl::outer_product_update_eligible<decltype(r.B)>());
+    const auto& x = r.x;
+    const auto& y = r.y;
+
+    r.check([&] (auto M) { matrix_rank_1_update(x, y, M); });
+    r.check([&] (auto M) { matrix_rank_1_update(scaled(Scalar(-2), x), y, M); });
+    r.check([&] (auto M) { matrix_rank_1_update_c(x, y, M); });
+    r.check([&] (auto M) {
+      matrix_rank_1_update(conjugated(y), x, LinearAlgebra::transposed(M));
+    });
+  }
+
+  TEST(BLAS2_ger, double_layouts)
+  {
+    test_ger<double, layout_left>();
+    test_ger<double, layout_right>();
+  }
+
+  TEST(BLAS2_ger, complex_layouts)
+  {
+    test_ger<std::complex<double>, layout_left>();
+    test_ger<std::complex<double>, layout_right>();
+  }
+
+} // end anonymous namespace
@@ -1,9 +1,11 @@
 #include "./gtest_fixtures.hpp"
+#include <cmath>
 #include <limits>
 
 namespace {
   using LinearAlgebra::givens_rotation_setup;
   using LinearAlgebra::givens_rotation_apply;
+  using LinearAlgebra::givens_rotation_sequence_apply;
 
   TEST(givens_rotation_setup, complex_double)
   {
@@ -258,4 +260,151 @@ namespace {
       }
     }
   }
+
+  template<class scalar_t>
+  scalar_t givens_test_value(std::size_t k)
+  {
+    using real_t = LinearAlgebra::impl::simd_real_t<scalar_t>;
+    const real_t re = real_t(int((7 * k + 3) % 19) - 9) / real_t(4);
+    if constexpr (LinearAlgebra::impl::is_complex_v<scalar_t>) {
+      return scalar_t(re, real_t(int((5 * k + 1) % 13) - 6) / real_t(4));
+    } else {
+      return re;
+    }
+  }
+
+  // The kernels for every instruction set that this CPU supports, on
+  // lengths that reach the unrolled loop, the single vector loop, and
+  // the scalar tail, must match the loop from the definition.
+  template<class scalar_t, class s_t>
+  void test_simd_rot_kernels(const s_t s)
+  {
+    using LinearAlgebra::impl::simd_isa;
+    using real_t = LinearAlgebra::impl::simd_real_t<scalar_t>;
+    const real_t c(0.6);
+    const real_t tol = std::numeric_limits<real_t>::epsilon() * real_t(16);
+    for (std::size_t n : {0, 1, 3, 7, 16, 33, 100}) {
+      for (std::ptrdiff_t inc : {1, 2}) {
+        std::vector<scalar_t> x0(n * inc), y0(n * inc);
+        for (std::size_t k = 0; k < x0.size(); ++k) {
+          x0[k] = givens_test_value<scalar_t>(k);
+          y0[k] = givens_test_value<scalar_t>(k + 100);
+        }
+        for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+          if (isa > LinearAlgebra::impl::active_simd_isa()) {
+            continue;
+          }
+          std::vector<scalar_t> x(x0), y(y0);
+          LinearAlgebra::impl::simd_rot(isa, n, x.data(), inc, y.data(), inc, c, s);
+          for (std::size_t k = 0; k < x0.size(); ++k) {
+            scalar_t x_k = x0[k];
+            scalar_t y_k = y0[k];
+            if (k % inc == 0) {
+              x_k = c * x0[k] + s * y0[k];
+              y_k = c * y0[k] - LinearAlgebra::impl::conj_if_needed(s) * x0[k];
+            }
+            EXPECT_LE(std::abs(x[k] - x_k), tol * real_t(8));
+            EXPECT_LE(std::abs(y[k] - y_k), tol * real_t(8));
+          }
+        }
+      }
+    }
+  }
+
+  TEST(givens_rotation_apply, simd_kernels)
+  {
+    test_simd_rot_kernels<double>(0.8);
+    test_simd_rot_kernels<float>(0.8f);
+    test_simd_rot_kernels<std::complex<double>>(0.8);
+    test_simd_rot_kernels<std::complex<double>>(std::complex<double>(0.48, -0.64));
+    test_simd_rot_kernels<std::complex<float>>(std::complex<float>(0.48f, 0.64f));
+  }
+
+  // Applies num_sequences sequences of rotations to an m x n matrix
+  // with the given layout, and compares with applying the rotations
+  // one at a time, as the definition does.
+  template<class scalar_t, class Layout, class c_t, class s_t>
+  void test_givens_rotation_sequence(std::size_t m, std::size_t n,
+    std::size_t num_sequences, bool vector_coefficients)
+  {
+    using matrix_t = mdspan<scalar_t, dextents<std::size_t, 2>, Layout>;
+    using real_t = decltype(std::abs(scalar_t{}));
+    std::vector<scalar_t> storage(m * n), expected_storage(m * n);
+    matrix_t A(storage.data(), m, n);
+    matrix_t expected(expected_storage.data(), m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i, j) = givens_test_value<scalar_t>(i * n + j);
+        expected(i, j) = A(i, j);
+      }
+    }
+
+    const std::size_t num_rotations = n - 1;
+    std::vector<c_t> c_storage(num_rotations * num_sequences);
+    std::vector<s_t> s_storage(num_rotations * num_sequences);
+    for (std::size_t r = 0; r < c_storage.size(); ++r) {
+      const double theta = 0.1 + 0.37 * double(r);
+      c_storage[r] = c_t(std::cos(theta));
+      if constexpr (LinearAlgebra::impl::is_complex_v<s_t>) {
+        s_storage[r] = std::sin(theta) * s_t(0.6, 0.8);
+      } else {
+        s_storage[r] = s_t(std::sin(theta));
+      }
+    }
+    mdspan<c_t, dextents<std::size_t, 2>, layout_left> c(
+      c_storage.data(), num_rotations, num_sequences);
+    mdspan<s_t, dextents<std::size_t, 2>, layout_left> s(
+      s_storage.data(), num_rotations, num_sequences);
+
+    for (std::size_t j = 0; j < num_sequences; ++j) {
+      for (std::size_t k = 0; k < num_rotations; ++k) {
+        for (std::size_t i = 0; i < m; ++i) {
+          const scalar_t x = expected(i, k);
+          const scalar_t y = expected(i, k + 1);
+          expected(i, k) = c(k, j) * x + s(k, j) * y;
+          expected(i, k + 1) = c(k, j) * y - LinearAlgebra::impl::conj_if_needed(s(k, j)) * x;
+        }
+      }
+    }
+
+    if (vector_coefficients) {
+      ASSERT_EQ(num_sequences, std::size_t(1));
+      mdspan<c_t, dextents<std::size_t, 1>> c_vector(c_storage.data(), num_rotations);
+      mdspan<s_t, dextents<std::size_t, 1>> s_vector(s_storage.data(), num_rotations);
+      givens_rotation_sequence_apply(A, c_vector, s_vector);
+    }
+    else {
+      givens_rotation_sequence_apply(A, c, s);
+    }
+    const real_t tol = std::numeric_limits<real_t>::epsilon() *
+      real_t(64 * num_sequences);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_LE(std::abs(A(i, j) - expected(i, j)), tol) << i << ", " << j;
+      }
+    }
+  }
+
+  TEST(givens_rotation_sequence_apply, double)
+  {
+    // Enough rows for two blocks of the wavefront.
+    test_givens_rotation_sequence<double, layout_left, double, double>(2100, 40, 3, false);
+    test_givens_rotation_sequence<double, layout_left, double, double>(70, 9, 1, true);
+    test_givens_rotation_sequence<double, layout_right, double, double>(50, 33, 4, false);
+    test_givens_rotation_sequence<double, layout_left, double, double>(5, 1, 2, false);
+  }
+
+  TEST(givens_rotation_sequence_apply, complex_double)
+  {
+    using complex_t = std::complex<double>;
+    test_givens_rotation_sequence<complex_t, layout_left, double, complex_t>(100, 17, 5, false);
+    test_givens_rotation_sequence<complex_t, layout_right, double, complex_t>(30, 12, 2, false);
+    test_givens_rotation_sequence<complex_t, layout_left, double, double>(40, 8, 1, true);
+  }
+
+  TEST(givens_rotation_sequence_apply, mixed_types)
+  {
+    // float entries with double coefficients take the generic loops.
+    test_givens_rotation_sequence<float, layout_left, double, double>(300, 20, 3, false);
+  }
 }
@@ -156,4 +156,84 @@ protected:
   cpx_vector_t v;
 }; // end class signed_double_vector
 
+// Small integer test values.  Sums and products of a few of them are
+// exact in any floating-point type, so results computed in different
+// orders can be compared with EXPECT_EQ.  The real part cycles through
+// the period integers centered on zero.
+template<class Scalar>
+Scalar test_value(int k, int period = 7)
+{
+  const int re = k % period - period / 2;
+  if constexpr (LinearAlgebra::impl::is_complex_v<Scalar>) {
+    return Scalar(re, k % 5 - 2);
+  } else {
+    return Scalar(re);
+  }
+}
+
+// An m x n matrix A in an array of the given Layout, and a copy B of
+// it in a layout_stride array with no unit stride, filled with
+// test_value; with them, a strided vector x of length m and a
+// contiguous vector y of length n.  Neither the BLAS nor the library's
+// kernels take a matrix without a unit stride, so B's updates take the
+// generic loops, and check(f) compares A's kernel with those loops: it
+// applies f to A and to B, and expects the same result from both.
+template<class Scalar, class Layout>
+class layout_stride_reference {
+public:
+  using matrix_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+  using stride_matrix_t = mdspan<Scalar, dextents<std::size_t, 2>, layout_stride>;
+
+  layout_stride_reference(std::size_t m, std::size_t n) :
+    A_mem(m * n),
+    B_mem(2 * m * n),
+    x_mem(2 * m),
+    y_mem(n),
+    A(A_mem.data(), m, n),
+    B(B_mem.data(), layout_stride::mapping<dextents<std::size_t, 2>>(
+      dextents<std::size_t, 2>(m, n), std::array<std::size_t, 2>{2, 2 * m})),
+    x(x_mem.data(), layout_stride::mapping<dextents<std::size_t, 1>>(
+      dextents<std::size_t, 1>(m), std::array<std::size_t, 1>{2})),
+    y(y_mem.data(), n)
+  {
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i,j) = test_value<Scalar>(int(3 * i + 5 * j));
+        B(i,j) = A(i,j);
+      }
+    }
+    for (std::size_t k = 0; k < x_mem.size(); ++k) {
+      x_mem[k] = test_value<Scalar>(int(2 * k + 1));
+    }
+    for (std::size_t k = 0; k < n; ++k) {
+      y_mem[k] = test_value<Scalar>(int(k + 4));
+    }
+  }
+
+  // A, B, x and y view the members above.
+  layout_stride_reference(const layout_stride_reference&) = delete;
+  layout_stride_reference& operator=(const layout_stride_reference&) = delete;
+
+  template<class Update>
+  void check(Update f)
+  {
+    f(A);
+    f(B);
+    for (std::size_t i = 0; i < A.extent(0); ++i) {
+      for (std::size_t j = 0; j < A.extent(1); ++j) {
+        EXPECT_EQ(A(i,j), B(i,j)) << "at (" << i << ", " << j << ")";
+      }
+    }
+  }
+
+private:
+  std::vector<Scalar> A_mem, B_mem, x_mem, y_mem;
+
+public:
+  matrix_t A;
+  stride_matrix_t B;
+  mdspan<const Scalar, dextents<std::size_t, 1>, layout_stride> x;
+  mdspan<const Scalar, dextents<std::size_t, 1>> y;
+};
+
 #endif //LINALG_INCLUDE_EXPERIMENTAL___P1673_BITS_FIXTURES_HPP_
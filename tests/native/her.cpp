@@ -1,4 +1,5 @@
 #include "./gtest_fixtures.hpp"
+#include <complex>
 
 namespace {
   using LinearAlgebra::lower_triangle;
@@ -101,4 +102,32 @@ namespace {
     check_lower_triangle();
   }
 
+  // Rank-1 updates of the triangle of a matrix in a column-major or
+  // row-major array take the outer-product kernel, which must leave
+  // the other triangle alone too.
+  template<class Scalar, class Layout, class Triangle>
+  void test_her_kernel(Triangle t)
+  {
+    layout_stride_reference<Scalar, Layout> r(37, 37);
+    static_assert(LinearAlgebra::impl::outer_product_update_eligible<decltype(r.A)>());
+    const auto& x = r.x;
+    const auto& y = r.y;
+
+    r.check([&] (auto M) { hermitian_matrix_rank_1_update(x, M, t); });
+    r.check([&] (auto M) { hermitian_matrix_rank_1_update(-2.0, x, M, t); });
+    r.check([&] (auto M) {
+      hermitian_matrix_rank_1_update(LinearAlgebra::conjugated(y), M, t);
+    });
+  }
+
+  TEST(BLAS2_her, kernel)
+  {
+    test_her_kernel<double, layout_left>(lower_triangle);
+    test_her_kernel<double, layout_left>(upper_triangle);
+    test_her_kernel<double, layout_right>(lower_triangle);
+    test_her_kernel<double, layout_right>(upper_triangle);
+    test_her_kernel<std::complex<double>, layout_left>(lower_triangle);
+    test_her_kernel<std::complex<double>, layout_right>(upper_triangle);
+  }
+
 } // end anonymous namespace
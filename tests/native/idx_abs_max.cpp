@@ -1,4 +1,6 @@
 #include "./gtest_fixtures.hpp"
+#include <cmath>
+#include <limits>
 
 namespace {
 
@@ -36,4 +38,120 @@ namespace {
     EXPECT_EQ(expected, idx_abs_max(b));
   }
 
+  // Small integer magnitudes, so that there are many ties.
+  template<class scalar_t>
+  scalar_t idx_test_value(std::size_t k)
+  {
+    const int re = int((7 * k + 3) % 11) - 5;
+    if constexpr (LinearAlgebra::impl::is_complex_v<scalar_t>) {
+      return scalar_t(re, int((5 * k + 1) % 9) - 4);
+    } else {
+      return scalar_t(re);
+    }
+  }
+
+  // Checks each SIMD kernel up to the one this CPU runs against a
+  // scalar loop, with the maximum in a whole block, in the partial
+  // last block and in the scalar tail.
+  template<class scalar_t>
+  void test_simd_iamax_kernels()
+  {
+    using LinearAlgebra::impl::simd_isa;
+    using real_t = LinearAlgebra::impl::simd_real_t<scalar_t>;
+    constexpr bool is_complex = LinearAlgebra::impl::is_complex_v<scalar_t>;
+    constexpr std::size_t max_n = 1001;
+    std::vector<scalar_t> x(2 * max_n);
+    for (std::size_t k = 0; k < x.size(); ++k) {
+      x[k] = idx_test_value<scalar_t>(k);
+    }
+
+    for (std::size_t n : std::initializer_list<std::size_t>{1, 3, 7, 16, 33, 100, 700, max_n}) {
+      for (std::size_t peak : {std::size_t(0), n / 3, n - 1}) {
+        for (std::ptrdiff_t incx : {1, 2}) {
+          std::vector<scalar_t> y(x);
+          y[peak * incx] = scalar_t(real_t(-9));
+          const real_t scale(0.5);
+          std::size_t expected = 0;
+          real_t expected_magnitude(-1);
+          for (std::size_t k = 0; k < n; ++k) {
+            const scalar_t y_k = y[k * incx];
+            real_t a{};
+            if constexpr (is_complex) {
+              a = scale * (std::abs(y_k.real()) + std::abs(y_k.imag()));
+            } else {
+              a = scale * std::abs(y_k);
+            }
+            if (a > expected_magnitude) {
+              expected = k;
+              expected_magnitude = a;
+            }
+          }
+          for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+            if (isa > LinearAlgebra::impl::active_simd_isa()) {
+              continue;
+            }
+            const auto result = LinearAlgebra::impl::simd_iamax<is_complex>(isa, n,
+              LinearAlgebra::impl::simd_real_data(y.data()), incx, scale);
+            EXPECT_EQ(result.index, expected);
+            EXPECT_EQ(result.magnitude, expected_magnitude);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(BLAS1_idx_abs_max, simd_kernels)
+  {
+    test_simd_iamax_kernels<double>();
+    test_simd_iamax_kernels<float>();
+    test_simd_iamax_kernels<std::complex<double>>();
+    test_simd_iamax_kernels<std::complex<float>>();
+  }
+
+  TEST(BLAS1_idx_abs_max, magnitudes)
+  {
+    using LinearAlgebra::idx_abs_max_abs_parts;
+    using LinearAlgebra::idx_abs_max_modulus;
+    using LinearAlgebra::scaled;
+    using LinearAlgebra::conjugated;
+    using complex_t = std::complex<double>;
+
+    // |z| picks -5i; |Re z| + |Im z| picks -3+3i, the first of two
+    // ties.
+    std::vector<complex_t> storage(300, complex_t(1.0, 1.0));
+    storage[100] = complex_t(0.0, -5.0);
+    storage[50] = complex_t(-3.0, 3.0);
+    storage[200] = complex_t(3.0, -3.0);
+    mdspan<complex_t, dextents<std::size_t, 1>> z(storage.data(), storage.size());
+    EXPECT_EQ(idx_abs_max(z), std::size_t(100));
+    EXPECT_EQ(idx_abs_max(z, idx_abs_max_modulus), std::size_t(100));
+    EXPECT_EQ(idx_abs_max(z, idx_abs_max_abs_parts), std::size_t(50));
+    EXPECT_EQ(idx_abs_max(conjugated(z), idx_abs_max_abs_parts), std::size_t(50));
+    EXPECT_EQ(idx_abs_max(scaled(-2.0, z), idx_abs_max_abs_parts), std::size_t(50));
+    // A complex scaling factor rotates the elements, which changes
+    // their |Re z| + |Im z|: (1+i)(-5i) = 5-5i wins.
+    EXPECT_EQ(idx_abs_max(scaled(complex_t(1.0, 1.0), z), idx_abs_max_abs_parts),
+              std::size_t(100));
+  }
+
+  TEST(BLAS1_idx_abs_max, nan_and_infinity)
+  {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> storage(100, 1.0);
+    mdspan<double, dextents<std::size_t, 1>> x(storage.data(), storage.size());
+
+    // NaN never compares greater, so later NaNs are skipped...
+    storage[10] = nan;
+    storage[20] = 5.0;
+    storage[90] = nan;
+    EXPECT_EQ(idx_abs_max(x), std::size_t(20));
+    storage[30] = -inf;
+    storage[40] = inf;
+    EXPECT_EQ(idx_abs_max(x), std::size_t(30));
+    // ... but NaN first wins, as in the reference BLAS.
+    storage[0] = nan;
+    EXPECT_EQ(idx_abs_max(x), std::size_t(0));
+  }
+
 } // end anonymous namespace
@@ -0,0 +1,271 @@
+#include "./gtest_fixtures.hpp"
+
+// Products of matrices stored in a narrower type than the result:
+// float inputs summed in double, and _Float16 inputs summed in float.
+// The inputs are chosen so that every product and sum is exact in the
+// accumulation type but not in the input type, so the results show
+// that the sums were taken in the wider type.
+
+namespace {
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::matrix_vector_product;
+
+  // 1 + k / 4096 for float: exact, but the product of two of them
+  // needs more bits than float has.  1 + k / 64 for _Float16, whose
+  // products need more bits than it has, and whose sums of a few
+  // hundred products are still exact in float.
+  template<class Input>
+  Input mixed_test_value(std::size_t k)
+  {
+    const double step = sizeof(Input) == 2 ? 64.0 : 4096.0;
+    return Input(1.0 + double(int(k % 13) - 6) / step);
+  }
+
+  template<class Input, class Result, class Layout>
+  void test_mixed_gemm(std::size_t m, std::size_t n, std::size_t k)
+  {
+    using input_matrix_t = mdspan<Input, dextents<std::size_t, 2>, Layout>;
+    using result_matrix_t = mdspan<Result, dextents<std::size_t, 2>, Layout>;
+    static_assert(LinearAlgebra::impl::mixed_precision_gemm_eligible<
+      input_matrix_t, input_matrix_t, result_matrix_t>());
+
+    std::vector<Input> A_mem(m * k), B_mem(k * n);
+    std::vector<Result> C_mem(m * n), E_mem(m * n), expected(m * n);
+    input_matrix_t A(A_mem.data(), m, k);
+    input_matrix_t B(B_mem.data(), k, n);
+    result_matrix_t C(C_mem.data(), m, n);
+    result_matrix_t E(E_mem.data(), m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t l = 0; l < k; ++l) {
+        A(i,l) = mixed_test_value<Input>(3 * i + 5 * l);
+      }
+    }
+    for (std::size_t l = 0; l < k; ++l) {
+      for (std::size_t j = 0; j < n; ++j) {
+        B(l,j) = mixed_test_value<Input>(7 * l + 2 * j + 1);
+      }
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        Result sum{};
+        for (std::size_t l = 0; l < k; ++l) {
+          sum += Result(A(i,l)) * Result(B(l,j));
+        }
+        expected[i * n + j] = sum;
+        E(i,j) = Result(double(i + j));
+      }
+    }
+
+    matrix_product(A, B, C);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(C(i,j), expected[i * n + j]);
+      }
+    }
+    matrix_product(A, B, E, C);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(C(i,j), Result(double(i + j)) + expected[i * n + j]);
+      }
+    }
+  }
+
+  TEST(mixed_precision, float_gemm_double_sums)
+  {
+    // Large enough for the packed engine, and too small for it.
+    test_mixed_gemm<float, double, layout_left>(37, 29, 300);
+    test_mixed_gemm<float, double, layout_right>(37, 29, 300);
+    test_mixed_gemm<float, double, layout_left>(3, 2, 5);
+  }
+
+  template<class Input, class Result, class Layout>
+  void test_mixed_gemv(std::size_t m, std::size_t n)
+  {
+    using input_matrix_t = mdspan<Input, dextents<std::size_t, 2>, Layout>;
+    using result_vector_t = mdspan<Result, dextents<std::size_t, 1>>;
+    static_assert(LinearAlgebra::impl::layout_aware_gemv_eligible<
+      input_matrix_t, result_vector_t>());
+
+    std::vector<Input> A_mem(m * n);
+    std::vector<Result> x_mem(n), y_mem(m), z_mem(m), expected(m);
+    input_matrix_t A(A_mem.data(), m, n);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i,j) = mixed_test_value<Input>(3 * i + 5 * j);
+      }
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+      x_mem[j] = Result(mixed_test_value<Input>(7 * j + 1));
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+      Result sum{};
+      for (std::size_t j = 0; j < n; ++j) {
+        sum += Result(A(i,j)) * x_mem[j];
+      }
+      expected[i] = sum;
+    }
+    result_vector_t x(x_mem.data(), n);
+    result_vector_t y(y_mem.data(), m);
+    result_vector_t z(z_mem.data(), m);
+
+    matrix_vector_product(A, x, y);
+    for (std::size_t i = 0; i < m; ++i) {
+      EXPECT_EQ(y(i), expected[i]);
+    }
+    matrix_vector_product(A, x, y, z);
+    for (std::size_t i = 0; i < m; ++i) {
+      EXPECT_EQ(z(i), expected[i] + expected[i]);
+    }
+  }
+
+  TEST(mixed_precision, float_gemv_double_sums)
+  {
+    test_mixed_gemv<float, double, layout_left>(37, 23);
+    test_mixed_gemv<float, double, layout_right>(37, 23);
+  }
+
+  // Small static extents take the unrolled kernels, which must also
+  // convert the operands before multiplying them.  Here x is float as
+  // well, so that A(i,j) * x(j) would otherwise be rounded to float.
+  template<class Input, class Result>
+  void test_mixed_static_extents()
+  {
+    constexpr std::size_t n = 4;
+    using input_matrix_t = mdspan<Input, extents<std::size_t, n, n>>;
+    using result_matrix_t = mdspan<Result, extents<std::size_t, n, n>>;
+    using input_vector_t = mdspan<Input, extents<std::size_t, n>>;
+    using result_vector_t = mdspan<Result, extents<std::size_t, n>>;
+    static_assert(LinearAlgebra::impl::static_matrix_product_eligible<
+      input_matrix_t, input_matrix_t, result_matrix_t>());
+
+    std::vector<Input> A_mem(n * n), B_mem(n * n), x_mem(n);
+    std::vector<Result> C_mem(n * n), y_mem(n), z_mem(n);
+    input_matrix_t A(A_mem.data());
+    input_matrix_t B(B_mem.data());
+    input_vector_t x(x_mem.data());
+    result_matrix_t C(C_mem.data());
+    result_vector_t y(y_mem.data());
+    result_vector_t z(z_mem.data());
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i,j) = mixed_test_value<Input>(3 * i + 5 * j);
+        B(i,j) = mixed_test_value<Input>(7 * i + 2 * j + 1);
+      }
+      x(i) = mixed_test_value<Input>(7 * i + 1);
+    }
+
+    matrix_product(A, B, C);
+    matrix_vector_product(A, x, y);
+    matrix_vector_product(A, x, y, z);
+    for (std::size_t i = 0; i < n; ++i) {
+      Result Ax{};
+      for (std::size_t j = 0; j < n; ++j) {
+        Result AB{};
+        for (std::size_t l = 0; l < n; ++l) {
+          AB += Result(A(i,l)) * Result(B(l,j));
+        }
+        EXPECT_EQ(C(i,j), AB);
+        Ax += Result(A(i,j)) * Result(x(j));
+      }
+      EXPECT_EQ(y(i), Ax);
+      EXPECT_EQ(z(i), Ax + Ax);
+    }
+  }
+
+  TEST(mixed_precision, static_extents)
+  {
+    test_mixed_static_extents<float, double>();
+#if defined(__FLT16_MAX__)
+    test_mixed_static_extents<_Float16, float>();
+#endif
+  }
+
+  // Checks each SIMD kernel up to the one this CPU runs, on a matrix
+  // of S and vectors of T, against the scalar kernels.
+  template<class S, class T>
+  void test_simd_mixed_gemv_kernels()
+  {
+    using LinearAlgebra::impl::simd_isa;
+    const std::size_t lda = 67;
+    std::vector<S> a(4 * lda);
+    std::vector<T> x(lda), c{T(2), T(-1), T(3), T(1)};
+    for (std::size_t k = 0; k < a.size(); ++k) {
+      a[k] = mixed_test_value<S>(k);
+    }
+    for (std::size_t k = 0; k < x.size(); ++k) {
+      x[k] = T(mixed_test_value<S>(3 * k + 1));
+    }
+    for (std::size_t n : {1, 3, 8, 17, 64, 67}) {
+      T expected_dot[4];
+      LinearAlgebra::impl::scalar_gemv_dot_rows<4>(a.data(), lda, x.data(), n, expected_dot);
+      std::vector<T> expected_y(x);
+      LinearAlgebra::impl::scalar_gemv_axpy_columns<4>(a.data(), lda, c.data(),
+        expected_y.data(), n);
+      for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+        if (isa > LinearAlgebra::impl::active_simd_isa()) {
+          continue;
+        }
+        T dot[4];
+        LinearAlgebra::impl::simd_gemv_dot_rows<4>(isa, a.data(), lda, x.data(), n, dot);
+        for (std::size_t r = 0; r < 4; ++r) {
+          EXPECT_EQ(dot[r], expected_dot[r]);
+        }
+        std::vector<T> y(x);
+        LinearAlgebra::impl::simd_gemv_axpy_columns<4>(isa, a.data(), lda, c.data(), y.data(), n);
+        EXPECT_EQ(y, expected_y);
+      }
+    }
+  }
+
+  TEST(mixed_precision, simd_kernels)
+  {
+    test_simd_mixed_gemv_kernels<float, double>();
+#if defined(__FLT16_MAX__)
+    test_simd_mixed_gemv_kernels<_Float16, float>();
+    test_simd_mixed_gemv_kernels<_Float16, double>();
+#endif
+  }
+
+#if defined(__FLT16_MAX__)
+  TEST(mixed_precision, half_gemm_float_sums)
+  {
+    test_mixed_gemm<_Float16, float, layout_left>(37, 29, 300);
+    test_mixed_gemm<_Float16, float, layout_right>(3, 2, 5);
+  }
+
+  TEST(mixed_precision, half_gemv_float_sums)
+  {
+    test_mixed_gemv<_Float16, float, layout_left>(37, 23);
+    test_mixed_gemv<_Float16, float, layout_right>(37, 23);
+  }
+
+  // A _Float16 C is summed in float and rounded once.  Each element of
+  // C is a sum of 300 terms of 1 + 1/1024, which _Float16 sums would
+  // get wrong.
+  TEST(mixed_precision, half_result)
+  {
+    using half_matrix_t = mdspan<_Float16, dextents<std::size_t, 2>, layout_left>;
+    constexpr std::size_t m = 20;
+    constexpr std::size_t n = 30;
+    constexpr std::size_t k = 300;
+    std::vector<_Float16> A_mem(m * k, _Float16(1.0f + 1.0f / 1024.0f));
+    std::vector<_Float16> B_mem(k * n, _Float16(1.0f)), C_mem(m * n);
+    half_matrix_t A(A_mem.data(), m, k);
+    half_matrix_t B(B_mem.data(), k, n);
+    half_matrix_t C(C_mem.data(), m, n);
+    static_assert(! LinearAlgebra::impl::packed_gemm_eligible<
+      half_matrix_t, half_matrix_t, half_matrix_t>());
+    static_assert(LinearAlgebra::impl::mixed_precision_gemm_eligible<
+      half_matrix_t, half_matrix_t, half_matrix_t>());
+
+    const float sum = float(k) * float(_Float16(1.0f + 1.0f / 1024.0f));
+    matrix_product(A, B, C);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(float(C(i,j)), float(_Float16(sum)));
+      }
+    }
+  }
+#endif
+
+} // end anonymous namespace
@@ -1,4 +1,7 @@
 #include "./gtest_fixtures.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
 #include <type_traits>
 
 // FIXME (mfh 2022/06/17) Temporarily disable calling the BLAS,
@@ -159,4 +162,100 @@ namespace {
     static_assert( std::is_same_v<std::remove_const_t<decltype(normResultAuto)>, mag_t> );
     EXPECT_NEAR( expectedNormResult, normResultAuto, tol );
   }
+
+  // Blue's algorithm and rescaling must agree to a few ulps on vectors
+  // whose elements span small, medium and big magnitudes.
+  template<class scalar_t>
+  void test_norm2_algorithms(double magnitude)
+  {
+    using LinearAlgebra::sum_of_squares_blue;
+    using LinearAlgebra::sum_of_squares_rescaling;
+    using mag_t = decltype(std::abs(scalar_t{}));
+    using vector_t = mdspan<scalar_t, dextents<std::size_t, 1>>;
+
+    constexpr std::size_t n = 257;
+    std::vector<scalar_t> storage(n);
+    vector_t x(storage.data(), n);
+    for (std::size_t k = 0; k < n; ++k) {
+      const mag_t value = mag_t(magnitude) * mag_t(int(k % 13) - 6) / mag_t(7);
+      if constexpr (LinearAlgebra::impl::is_complex_v<scalar_t>) {
+        x(k) = scalar_t(value, -value / mag_t(2));
+      } else {
+        x(k) = value;
+      }
+    }
+
+    const mag_t rescaling = vector_norm2(x, mag_t{}, sum_of_squares_rescaling);
+    const mag_t tol = mag_t(16) * std::numeric_limits<mag_t>::epsilon() * rescaling;
+    EXPECT_TRUE(std::isfinite(rescaling));
+    EXPECT_GT(rescaling, mag_t(0));
+    EXPECT_NEAR(vector_norm2(x, mag_t{}, sum_of_squares_blue), rescaling, tol);
+    EXPECT_NEAR(vector_norm2(x), rescaling, tol);
+
+    // The same through a stride and a scaling factor.
+    using strided_t = mdspan<scalar_t, dextents<std::size_t, 1>, layout_stride>;
+    const std::array<std::size_t, 1> strides{2};
+    strided_t x_even(storage.data(), layout_stride::mapping<dextents<std::size_t, 1>>(
+      dextents<std::size_t, 1>((n + 1) / 2), strides));
+    const mag_t even = vector_norm2(x_even, mag_t{}, sum_of_squares_rescaling);
+    EXPECT_NEAR(vector_norm2(x_even), even, tol);
+    EXPECT_NEAR(vector_norm2(LinearAlgebra::scaled(mag_t(-0.5), x)), rescaling / mag_t(2), tol);
+  }
+
+  TEST(BLAS1_norm2, blue_matches_rescaling)
+  {
+    for (double magnitude : {1.0, 1.0e-300, 1.0e300, 1.0e-310}) {
+      test_norm2_algorithms<double>(magnitude);
+      test_norm2_algorithms<std::complex<double>>(magnitude);
+    }
+    for (double magnitude : {1.0, 1.0e-30, 1.0e35}) {
+      test_norm2_algorithms<float>(magnitude);
+      test_norm2_algorithms<std::complex<float>>(magnitude);
+    }
+  }
+
+  TEST(BLAS1_norm2, blue_mixed_magnitudes)
+  {
+    using LinearAlgebra::sum_of_squares_blue;
+    using vector_t = mdspan<double, dextents<std::size_t, 1>>;
+
+    // Big and small elements together: the small ones vanish next to
+    // the big one, but neither overflows nor underflows.
+    std::vector<double> storage{3.0e300, 1.0e-300, 4.0e300, 2.0, 1.0e-320};
+    vector_t x(storage.data(), storage.size());
+    EXPECT_NEAR(vector_norm2(x), 5.0e300, 5.0e300 * 1.0e-15);
+
+    // Small and medium together.
+    std::vector<double> storage2{3.0e-200, 4.0e-200, 0.0, 1.0e-300};
+    vector_t y(storage2.data(), storage2.size());
+    EXPECT_NEAR(vector_norm2(y, 0.0, sum_of_squares_blue), 5.0e-200, 5.0e-200 * 1.0e-15);
+
+    // NaN and infinity propagate.
+    storage[3] = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(vector_norm2(x), std::numeric_limits<double>::infinity());
+    storage[1] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(std::isnan(vector_norm2(x)));
+  }
+
+  TEST(BLAS1_norm2, blue_simd_kernels)
+  {
+    using LinearAlgebra::impl::simd_isa;
+    std::vector<double> x(1003);
+    for (std::size_t k = 0; k < x.size(); ++k) {
+      const double scale = k % 3 == 0 ? 1.0e-200 : (k % 3 == 1 ? 1.0 : 1.0e200);
+      x[k] = scale * double(int(k % 11) - 5);
+    }
+    for (std::size_t n : {0, 1, 5, 64, 1003}) {
+      const auto expected = LinearAlgebra::impl::strided_blue_sums(n, x.data(), 1);
+      for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+        if (isa > LinearAlgebra::impl::active_simd_isa()) {
+          continue;
+        }
+        const auto sums = LinearAlgebra::impl::simd_blue_sums(isa, n, x.data(), 1);
+        EXPECT_NEAR(sums.small, expected.small, 1.0e-13 * expected.small);
+        EXPECT_NEAR(sums.medium, expected.medium, 1.0e-13 * expected.medium);
+        EXPECT_NEAR(sums.big, expected.big, 1.0e-13 * expected.big);
+      }
+    }
+  }
 }
@@ -0,0 +1,275 @@
+#include "./gtest_fixtures.hpp"
+#include <cmath>
+
+namespace {
+
+  using LinearAlgebra::column_major_t;
+  using LinearAlgebra::explicit_diagonal_t;
+  using LinearAlgebra::implicit_unit_diagonal_t;
+  using LinearAlgebra::layout_blas_packed;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::row_major_t;
+  using LinearAlgebra::upper_triangle_t;
+
+  template<class Triangle, class StorageOrder>
+  void test_packed_mapping(const std::array<std::size_t, 16>& expected_offsets)
+  {
+    using extents_type = dextents<std::size_t, 2>;
+    using mapping_type = typename layout_blas_packed<Triangle, StorageOrder>::template mapping<extents_type>;
+    const mapping_type map(extents_type(4, 4));
+
+    EXPECT_EQ(map.required_span_size(), std::size_t(10));
+    EXPECT_FALSE(mapping_type::is_always_unique());
+    EXPECT_FALSE(map.is_unique());
+    EXPECT_TRUE(map.is_exhaustive());
+    for (std::size_t i = 0; i < 4; ++i) {
+      for (std::size_t j = 0; j < 4; ++j) {
+        EXPECT_EQ(map(i, j), expected_offsets[4 * i + j]) << "at (" << i << ", " << j << ")";
+      }
+    }
+
+    using static_mapping_type = typename layout_blas_packed<Triangle, StorageOrder>::template mapping<extents<std::size_t, 1, 1>>;
+    EXPECT_TRUE(static_mapping_type::is_always_unique());
+    EXPECT_TRUE(static_mapping_type::is_always_strided());
+  }
+
+  TEST(layout_blas_packed, mapping)
+  {
+    // Each line's elements are adjacent, and lines follow each other.
+    constexpr std::array<std::size_t, 16> leading_lines{
+      0, 1, 3, 6,
+      1, 2, 4, 7,
+      3, 4, 5, 8,
+      6, 7, 8, 9
+    };
+    constexpr std::array<std::size_t, 16> trailing_lines{
+      0, 1, 2, 3,
+      1, 4, 5, 6,
+      2, 5, 7, 8,
+      3, 6, 8, 9
+    };
+    test_packed_mapping<upper_triangle_t, column_major_t>(leading_lines);
+    test_packed_mapping<lower_triangle_t, row_major_t>(leading_lines);
+    test_packed_mapping<lower_triangle_t, column_major_t>(trailing_lines);
+    test_packed_mapping<upper_triangle_t, row_major_t>(trailing_lines);
+  }
+
+  TEST(layout_blas_packed, packed_and_transposed)
+  {
+    using LinearAlgebra::packed;
+    using LinearAlgebra::transposed;
+
+    std::vector<double> storage(10);
+    for (std::size_t k = 0; k < storage.size(); ++k) {
+      storage[k] = double(k);
+    }
+    mdspan<double, dextents<std::size_t, 1>> v(storage.data(), storage.size());
+    auto A = packed(v, 4, LinearAlgebra::upper_triangle, LinearAlgebra::column_major);
+    static_assert(std::is_same_v<decltype(A)::layout_type,
+                  layout_blas_packed<upper_triangle_t, column_major_t>>);
+    EXPECT_EQ(A.extent(0), std::size_t(4));
+    EXPECT_EQ(A.extent(1), std::size_t(4));
+    EXPECT_EQ(A(1, 3), 7.0);
+    EXPECT_EQ(A(3, 1), 7.0);
+
+    auto A_t = transposed(A);
+    static_assert(std::is_same_v<decltype(A_t)::layout_type,
+                  layout_blas_packed<lower_triangle_t, row_major_t>>);
+    for (std::size_t i = 0; i < 4; ++i) {
+      for (std::size_t j = 0; j < 4; ++j) {
+        EXPECT_EQ(A_t(i, j), A(j, i));
+      }
+    }
+  }
+
+  // Small integers, so that the packed and dense results agree exactly
+  // whatever the order of summation.
+  template<class T>
+  T packed_test_value(std::size_t i, std::size_t j)
+  {
+    const int re = int((3 * i + 5 * j) % 7) - 3;
+    if constexpr (LinearAlgebra::impl::is_complex_v<T>) {
+      return T(re, int((i + 2 * j) % 5) - 2);
+    } else {
+      return T(re);
+    }
+  }
+
+  template<class T>
+  T conj_value(const T& t)
+  {
+    if constexpr (LinearAlgebra::impl::is_complex_v<T>) {
+      return std::conj(t);
+    } else {
+      return t;
+    }
+  }
+
+  // Compares each algorithm on packed storage of triangle Triangle
+  // against a dense computation of the same result.
+  template<class T, class Triangle, class StorageOrder>
+  void test_packed_algorithms()
+  {
+    using LinearAlgebra::packed;
+    constexpr std::size_t n = 7;
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    auto in_triangle = [&](std::size_t i, std::size_t j) {
+      return lower ? i >= j : i <= j;
+    };
+
+    // S is symmetric; H is Hermitian.
+    std::vector<T> S(n * n), H(n * n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = i; j < n; ++j) {
+        S[i * n + j] = S[j * n + i] = packed_test_value<T>(i, j);
+        H[i * n + j] = packed_test_value<T>(i, j);
+        H[j * n + i] = conj_value(H[i * n + j]);
+      }
+      H[i * n + i] = T(std::real(H[i * n + i]));
+    }
+    std::vector<T> x_storage(n), y_storage(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_storage[i] = packed_test_value<T>(i, 2 * i + 1);
+      y_storage[i] = packed_test_value<T>(2 * i, i + 3);
+    }
+    mdspan<T, dextents<std::size_t, 1>> x(x_storage.data(), n);
+    mdspan<T, dextents<std::size_t, 1>> y(y_storage.data(), n);
+
+    std::vector<T> S_packed(n * (n + 1) / 2), H_packed(n * (n + 1) / 2);
+    auto A_S = packed(mdspan<T, dextents<std::size_t, 1>>(S_packed.data(), S_packed.size()),
+                      n, Triangle{}, StorageOrder{});
+    auto A_H = packed(mdspan<T, dextents<std::size_t, 1>>(H_packed.data(), H_packed.size()),
+                      n, Triangle{}, StorageOrder{});
+    static_assert(LinearAlgebra::impl::stores_packed_triangle_v<decltype(A_S), Triangle>);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        if (in_triangle(i, j)) {
+          A_S(i, j) = S[i * n + j];
+          A_H(i, j) = H[i * n + j];
+        }
+      }
+    }
+
+    // Matrix-vector products
+    std::vector<T> Sx(n), Hx(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        Sx[i] += S[i * n + j] * x(j);
+        Hx[i] += H[i * n + j] * x(j);
+      }
+    }
+    std::vector<T> z_storage(n);
+    mdspan<T, dextents<std::size_t, 1>> z(z_storage.data(), n);
+
+    LinearAlgebra::symmetric_matrix_vector_product(A_S, Triangle{}, x, z);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(z(i), Sx[i]) << "symv at " << i;
+    }
+    // Reading the triangle that isn't stored goes through the mapping.
+    using other_triangle_t = std::conditional_t<lower, upper_triangle_t, lower_triangle_t>;
+    LinearAlgebra::symmetric_matrix_vector_product(A_S, other_triangle_t{}, x, z);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(z(i), Sx[i]) << "symv (other triangle) at " << i;
+    }
+    LinearAlgebra::symmetric_matrix_vector_product(LinearAlgebra::scaled(T(2), A_S), Triangle{}, x, y, z);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(z(i), y(i) + T(2) * Sx[i]) << "updating symv at " << i;
+    }
+    LinearAlgebra::hermitian_matrix_vector_product(A_H, Triangle{}, x, z);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(z(i), Hx[i]) << "hemv at " << i;
+    }
+    LinearAlgebra::hermitian_matrix_vector_product(A_H, Triangle{}, x, y, z);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(z(i), y(i) + Hx[i]) << "updating hemv at " << i;
+    }
+
+    // Triangular solves, with S's triangle (its diagonal made
+    // dominant) as the triangular matrix.
+    std::vector<T> T_packed(S_packed);
+    auto A_T = packed(mdspan<T, dextents<std::size_t, 1>>(T_packed.data(), T_packed.size()),
+                      n, Triangle{}, StorageOrder{});
+    for (std::size_t i = 0; i < n; ++i) {
+      A_T(i, i) = T(10 + i);
+    }
+    auto check_solve = [&](auto d, bool unit_diagonal) {
+      std::vector<T> b_storage(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          if (in_triangle(i, j)) {
+            b_storage[i] += (i == j && unit_diagonal ? T(1) : A_T(i, j)) * x(j);
+          }
+        }
+      }
+      mdspan<T, dextents<std::size_t, 1>> b(b_storage.data(), n);
+      LinearAlgebra::triangular_matrix_vector_solve(A_T, Triangle{}, d, b, z);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(std::abs(z(i) - x(i)), 0.0, 1.0e-12) << "trsv at " << i;
+      }
+    };
+    check_solve(explicit_diagonal_t{}, false);
+    check_solve(implicit_unit_diagonal_t{}, true);
+
+    // Rank-1 and rank-2 updates
+    auto check_update = [&](const auto& A, const std::vector<T>& expected, const char* name) {
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          if (in_triangle(i, j)) {
+            EXPECT_EQ(A(i, j), expected[i * n + j]) << name << " at (" << i << ", " << j << ")";
+          }
+        }
+      }
+    };
+    std::vector<T> expected(S);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        expected[i * n + j] += T(2) * x(i) * x(j);
+      }
+    }
+    LinearAlgebra::symmetric_matrix_rank_1_update(T(2), x, A_S, Triangle{});
+    check_update(A_S, expected, "syr");
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        expected[i * n + j] += x(i) * y(j) + y(i) * x(j);
+      }
+    }
+    LinearAlgebra::symmetric_matrix_rank_2_update(x, y, A_S, Triangle{});
+    check_update(A_S, expected, "syr2");
+
+    expected = H;
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        expected[i * n + j] += 2.0 * x(i) * conj_value(x(j));
+      }
+    }
+    LinearAlgebra::hermitian_matrix_rank_1_update(2.0, x, A_H, Triangle{});
+    check_update(A_H, expected, "her");
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        expected[i * n + j] += x(i) * conj_value(y(j)) + y(i) * conj_value(x(j));
+      }
+    }
+    LinearAlgebra::hermitian_matrix_rank_2_update(x, y, A_H, Triangle{});
+    check_update(A_H, expected, "her2");
+  }
+
+  template<class T>
+  void test_packed_algorithms_all_layouts()
+  {
+    test_packed_algorithms<T, upper_triangle_t, column_major_t>();
+    test_packed_algorithms<T, lower_triangle_t, column_major_t>();
+    test_packed_algorithms<T, upper_triangle_t, row_major_t>();
+    test_packed_algorithms<T, lower_triangle_t, row_major_t>();
+  }
+
+  TEST(layout_blas_packed, algorithms_double)
+  {
+    test_packed_algorithms_all_layouts<double>();
+  }
+
+  TEST(layout_blas_packed, algorithms_complex_double)
+  {
+    test_packed_algorithms_all_layouts<std::complex<double>>();
+  }
+
+} // end anonymous namespace
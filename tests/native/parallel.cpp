@@ -0,0 +1,720 @@
+#include "./gtest_fixtures.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <execution>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// These tests run idx_abs_max, plane rotations, and the BLAS 2 and 3
+// algorithms with
+// std::execution::par, which maps to the native thread pool, and
+// compare with the same algorithms run inline.  Some use a
+// thread_pool_exec with a pool of their own instead.  The problems are big
+// enough to be cut into several blocks.  All values are small
+// integers, so every product is exact.  CMake runs this test with
+// LINALG_NUM_THREADS set, so that the pool has workers even on a
+// single-core machine.
+
+namespace {
+  using LinearAlgebra::batched_matrix_product;
+  using LinearAlgebra::batched_matrix_vector_product;
+  using LinearAlgebra::batched_triangular_matrix_matrix_left_solve;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::givens_rotation_apply;
+  using LinearAlgebra::givens_rotation_sequence_apply;
+  using LinearAlgebra::hermitian_matrix_rank_1_update;
+  using LinearAlgebra::hermitian_matrix_rank_2_update;
+  using LinearAlgebra::hermitian_matrix_rank_2k_update;
+  using LinearAlgebra::hermitian_matrix_rank_k_update;
+  using LinearAlgebra::hermitian_matrix_vector_product;
+  using LinearAlgebra::idx_abs_max;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::layout_batch_interleaved;
+  using LinearAlgebra::left_side;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::matrix_rank_1_update;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::right_side;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_rank_1_update;
+  using LinearAlgebra::symmetric_matrix_rank_2_update;
+  using LinearAlgebra::symmetric_matrix_rank_2k_update;
+  using LinearAlgebra::symmetric_matrix_rank_k_update;
+  using LinearAlgebra::symmetric_matrix_vector_product;
+  using LinearAlgebra::thread_pool_exec;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::triangular_matrix_left_product;
+  using LinearAlgebra::triangular_matrix_matrix_left_solve;
+  using LinearAlgebra::triangular_matrix_matrix_right_solve;
+  using LinearAlgebra::triangular_matrix_matrix_solve;
+  using LinearAlgebra::triangular_matrix_product;
+  using LinearAlgebra::triangular_matrix_right_product;
+  using LinearAlgebra::upper_triangle;
+
+  using complex_t = std::complex<double>;
+
+  template<class Scalar>
+  Scalar small_integer_value(std::size_t i, std::size_t j)
+  {
+    const auto re = double(int((3 * i + 5 * j) % 7) - 3);
+    if constexpr (std::is_same_v<Scalar, complex_t>) {
+      return Scalar(re, double(int((2 * i + j) % 5) - 2));
+    } else {
+      return Scalar(re);
+    }
+  }
+
+  // Owns the storage of a rows x cols matrix with the given layout.
+  template<class Scalar, class Layout>
+  struct matrix {
+    using view_type = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+
+    matrix(std::size_t rows, std::size_t cols, std::size_t seed) :
+      storage(rows * cols), view(storage.data(), rows, cols)
+    {
+      for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+          view(i,j) = small_integer_value<Scalar>(i + seed, j);
+        }
+      }
+    }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  template<class Scalar>
+  struct vector {
+    using view_type = mdspan<Scalar, dextents<std::size_t, 1>>;
+
+    vector(std::size_t n, std::size_t seed) :
+      storage(n), view(storage.data(), n)
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        view(i) = small_integer_value<Scalar>(i, seed);
+      }
+    }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  // Makes A's triangle t unit diagonal with sparse off-diagonal
+  // entries, so that triangular solves stay small.
+  template<class Triangle, class in_matrix_t>
+  void make_unit_triangular(const in_matrix_t& A)
+  {
+    using value_type = typename in_matrix_t::value_type;
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t n = A.extent(0);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        if (i == j) {
+          A(i,j) = value_type(1);
+        } else if ((i > j) == lower) {
+          A(i,j) = (i + j) % 5 == 0 ? value_type(0.25) : value_type{};
+        }
+      }
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void expect_equal(const matrix<Scalar, Layout>& actual,
+                    const matrix<Scalar, Layout>& expected)
+  {
+    EXPECT_EQ(actual.storage, expected.storage);
+  }
+
+  template<class Scalar, class Layout>
+  void expect_near(const matrix<Scalar, Layout>& actual,
+                   const matrix<Scalar, Layout>& expected)
+  {
+    ASSERT_EQ(actual.storage.size(), expected.storage.size());
+    for (std::size_t k = 0; k < actual.storage.size(); ++k) {
+      EXPECT_NEAR(std::abs(actual.storage[k] - expected.storage[k]), 0.0, 1.0e-10);
+    }
+  }
+
+  constexpr std::size_t m = 100;
+  constexpr std::size_t n = 90;
+  constexpr std::size_t k = 70;
+
+  template<class Scalar, class Layout>
+  void test_matrix_product()
+  {
+    matrix<Scalar, Layout> A(m, k, 1);
+    matrix<Scalar, Layout> B(k, n, 2);
+    matrix<Scalar, Layout> E(m, n, 3);
+    matrix<Scalar, Layout> C_par(m, n, 0), C_seq(m, n, 0);
+
+    matrix_product(std::execution::par, A.view, B.view, C_par.view);
+    matrix_product(A.view, B.view, C_seq.view);
+    expect_equal(C_par, C_seq);
+
+    // The wide and the tall case are cut along different sides.
+    matrix<Scalar, Layout> F(20, k, 4);
+    matrix<Scalar, Layout> D_par(m, 20, 0), D_seq(m, 20, 0);
+    matrix_product(std::execution::par_unseq, A.view, scaled(Scalar(2), transposed(F.view)), D_par.view);
+    matrix_product(A.view, scaled(Scalar(2), transposed(F.view)), D_seq.view);
+    expect_equal(D_par, D_seq);
+
+    matrix_product(std::execution::par, A.view, B.view, E.view, C_par.view);
+    matrix_product(A.view, B.view, E.view, C_seq.view);
+    expect_equal(C_par, C_seq);
+  }
+
+  // Owns the storage of a batch of rows x cols matrices with the given
+  // layout.
+  template<class Scalar, class Layout>
+  struct matrix_batch {
+    using view_type = mdspan<Scalar, dextents<std::size_t, 3>, Layout>;
+
+    matrix_batch(std::size_t batch, std::size_t rows, std::size_t cols, std::size_t seed) :
+      storage(batch * rows * cols), view(storage.data(), batch, rows, cols)
+    {
+      for (std::size_t b = 0; b < batch; ++b) {
+        for (std::size_t i = 0; i < rows; ++i) {
+          for (std::size_t j = 0; j < cols; ++j) {
+            view(b,i,j) = small_integer_value<Scalar>(i + seed, j + b);
+          }
+        }
+      }
+    }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  // Many small items are cut into blocks of items; a few large ones
+  // get a parallel product each.
+  template<class Scalar, class Layout>
+  void test_batched_matrix_product(std::size_t batch, std::size_t p)
+  {
+    matrix_batch<Scalar, Layout> A(batch, p, p + 1, 1);
+    matrix_batch<Scalar, Layout> B(batch, p + 1, p + 2, 2);
+    matrix_batch<Scalar, Layout> E(batch, p, p + 2, 3);
+    matrix_batch<Scalar, Layout> C_par(batch, p, p + 2, 0), C_seq(batch, p, p + 2, 0);
+
+    batched_matrix_product(std::execution::par, A.view, B.view, C_par.view);
+    batched_matrix_product(A.view, B.view, C_seq.view);
+    EXPECT_EQ(C_par.storage, C_seq.storage);
+
+    batched_matrix_product(std::execution::par, A.view, B.view, E.view, C_par.view);
+    batched_matrix_product(A.view, B.view, E.view, C_seq.view);
+    EXPECT_EQ(C_par.storage, C_seq.storage);
+
+    using item_t = decltype(LinearAlgebra::impl::batch_item(A.view, 0));
+    std::vector<item_t> A_items, B_items, C_items;
+    for (std::size_t b = 0; b < batch; ++b) {
+      A_items.push_back(LinearAlgebra::impl::batch_item(A.view, b));
+      B_items.push_back(LinearAlgebra::impl::batch_item(B.view, b));
+      C_items.push_back(LinearAlgebra::impl::batch_item(C_par.view, b));
+    }
+    batched_matrix_product(std::execution::par, A_items, B_items, C_items);
+    batched_matrix_product(A.view, B.view, C_seq.view);
+    EXPECT_EQ(C_par.storage, C_seq.storage);
+  }
+
+  template<class Scalar, class Layout, class Triangle>
+  void test_batched_gemv_and_trsm(Triangle t, std::size_t batch, std::size_t p)
+  {
+    matrix_batch<Scalar, Layout> A(batch, p, p, 1);
+    matrix_batch<Scalar, Layout> B(batch, p, 3, 2);
+    matrix_batch<Scalar, Layout> X_par(batch, p, 3, 0), X_seq(batch, p, 3, 0);
+    for (std::size_t b = 0; b < batch; ++b) {
+      make_unit_triangular<Triangle>(LinearAlgebra::impl::batch_item(A.view, b));
+    }
+    batched_triangular_matrix_matrix_left_solve(std::execution::par, A.view, t,
+      implicit_unit_diagonal, B.view, X_par.view);
+    batched_triangular_matrix_matrix_left_solve(A.view, t,
+      implicit_unit_diagonal, B.view, X_seq.view);
+    EXPECT_EQ(X_par.storage, X_seq.storage);
+
+    using vector_batch_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+    std::vector<Scalar> x_mem(batch * p, Scalar(2)), y_par_mem(batch * p), y_seq_mem(batch * p);
+    vector_batch_t x(x_mem.data(), batch, p);
+    vector_batch_t y_par(y_par_mem.data(), batch, p);
+    vector_batch_t y_seq(y_seq_mem.data(), batch, p);
+    batched_matrix_vector_product(std::execution::par, A.view, x, y_par);
+    batched_matrix_vector_product(A.view, x, y_seq);
+    EXPECT_EQ(y_par_mem, y_seq_mem);
+    batched_matrix_vector_product(std::execution::par, A.view, x, y_par, y_par);
+    batched_matrix_vector_product(A.view, x, y_seq, y_seq);
+    EXPECT_EQ(y_par_mem, y_seq_mem);
+  }
+
+  template<class Scalar, class Layout>
+  void test_matrix_vector_product()
+  {
+    matrix<Scalar, Layout> A(m * 4, n * 4, 1);
+    vector<Scalar> x(n * 4, 2), y(m * 4, 3), z_par(m * 4, 0), z_seq(m * 4, 0);
+
+    matrix_vector_product(std::execution::par, A.view, x.view, z_par.view);
+    matrix_vector_product(A.view, x.view, z_seq.view);
+    EXPECT_EQ(z_par.storage, z_seq.storage);
+
+    matrix_vector_product(std::execution::par, A.view, x.view, y.view, z_par.view);
+    matrix_vector_product(A.view, x.view, y.view, z_seq.view);
+    EXPECT_EQ(z_par.storage, z_seq.storage);
+
+    // z := z + A x, in place
+    matrix_vector_product(std::execution::par, A.view, x.view, z_par.view, z_par.view);
+    matrix_vector_product(A.view, x.view, z_seq.view, z_seq.view);
+    EXPECT_EQ(z_par.storage, z_seq.storage);
+  }
+
+  template<bool Hermitian, class Scalar, class Layout, class Triangle>
+  void test_symmetric_matrix_vector_product(Triangle t)
+  {
+    constexpr std::size_t N = n * 4;
+    matrix<Scalar, Layout> A(N, N, 1);
+    vector<Scalar> x(N, 2), y_par(N, 0), y_seq(N, 0);
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_vector_product(std::execution::par, A.view, t, x.view, y_par.view);
+      hermitian_matrix_vector_product(A.view, t, x.view, y_seq.view);
+    } else {
+      symmetric_matrix_vector_product(std::execution::par, A.view, t, x.view, y_par.view);
+      symmetric_matrix_vector_product(A.view, t, x.view, y_seq.view);
+    }
+    EXPECT_EQ(y_par.storage, y_seq.storage);
+  }
+
+  template<class Scalar, class Layout>
+  void test_matrix_rank_1_update()
+  {
+    vector<Scalar> x(m * 4, 1), y(n * 4, 2);
+    matrix<Scalar, Layout> A_par(m * 4, n * 4, 3), A_seq(m * 4, n * 4, 3);
+
+    matrix_rank_1_update(std::execution::par, x.view, y.view, A_par.view);
+    matrix_rank_1_update(x.view, y.view, A_seq.view);
+    expect_equal(A_par, A_seq);
+  }
+
+  template<bool Hermitian, class Scalar, class Layout, class Triangle>
+  void test_rank_1_and_2_update(Triangle t)
+  {
+    constexpr std::size_t N = n * 4;
+    vector<Scalar> x(N, 1), y(N, 2);
+    matrix<Scalar, Layout> A_par(N, N, 3), A_seq(N, N, 3);
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_rank_1_update(std::execution::par, 2.0, x.view, A_par.view, t);
+      hermitian_matrix_rank_1_update(2.0, x.view, A_seq.view, t);
+      expect_equal(A_par, A_seq);
+      hermitian_matrix_rank_1_update(std::execution::par, x.view, A_par.view, t);
+      hermitian_matrix_rank_1_update(x.view, A_seq.view, t);
+      expect_equal(A_par, A_seq);
+      hermitian_matrix_rank_2_update(std::execution::par, x.view, y.view, A_par.view, t);
+      hermitian_matrix_rank_2_update(x.view, y.view, A_seq.view, t);
+      expect_equal(A_par, A_seq);
+    } else {
+      symmetric_matrix_rank_1_update(std::execution::par, Scalar(2), x.view, A_par.view, t);
+      symmetric_matrix_rank_1_update(Scalar(2), x.view, A_seq.view, t);
+      expect_equal(A_par, A_seq);
+      symmetric_matrix_rank_1_update(std::execution::par, x.view, A_par.view, t);
+      symmetric_matrix_rank_1_update(x.view, A_seq.view, t);
+      expect_equal(A_par, A_seq);
+      symmetric_matrix_rank_2_update(std::execution::par, x.view, y.view, A_par.view, t);
+      symmetric_matrix_rank_2_update(x.view, y.view, A_seq.view, t);
+      expect_equal(A_par, A_seq);
+    }
+  }
+
+  template<bool Hermitian, class Scalar, class Layout, class Triangle>
+  void test_rank_k_update(Triangle t)
+  {
+    matrix<Scalar, Layout> A(n, k, 1), B(n, k, 2);
+    matrix<Scalar, Layout> C_par(n, n, 3), C_seq(n, n, 3);
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_rank_k_update(std::execution::par, 2.0, A.view, C_par.view, t);
+      hermitian_matrix_rank_k_update(2.0, A.view, C_seq.view, t);
+      expect_equal(C_par, C_seq);
+      hermitian_matrix_rank_k_update(std::execution::par, A.view, C_par.view, t);
+      hermitian_matrix_rank_k_update(A.view, C_seq.view, t);
+      expect_equal(C_par, C_seq);
+      hermitian_matrix_rank_2k_update(std::execution::par, A.view, B.view, C_par.view, t);
+      hermitian_matrix_rank_2k_update(A.view, B.view, C_seq.view, t);
+      expect_equal(C_par, C_seq);
+    } else {
+      symmetric_matrix_rank_k_update(std::execution::par, Scalar(2), A.view, C_par.view, t);
+      symmetric_matrix_rank_k_update(Scalar(2), A.view, C_seq.view, t);
+      expect_equal(C_par, C_seq);
+      symmetric_matrix_rank_k_update(std::execution::par, A.view, C_par.view, t);
+      symmetric_matrix_rank_k_update(A.view, C_seq.view, t);
+      expect_equal(C_par, C_seq);
+      symmetric_matrix_rank_2k_update(std::execution::par, A.view, B.view, C_par.view, t);
+      symmetric_matrix_rank_2k_update(A.view, B.view, C_seq.view, t);
+      expect_equal(C_par, C_seq);
+    }
+  }
+
+  template<class Scalar, class Layout, class Triangle>
+  void test_triangular_product(Triangle t)
+  {
+    const thread_pool_exec exec(4);
+    matrix<Scalar, Layout> A(m, m, 1), B(m, n, 2), B_right(n, m, 3);
+    matrix<Scalar, Layout> C_par(m, n, 0), C_seq(m, n, 0);
+
+    triangular_matrix_product(exec, A.view, t, explicit_diagonal, B.view, C_par.view);
+    triangular_matrix_product(A.view, t, explicit_diagonal, B.view, C_seq.view);
+    expect_equal(C_par, C_seq);
+
+    matrix<Scalar, Layout> D_par(n, m, 0), D_seq(n, m, 0);
+    triangular_matrix_product(exec, B_right.view, A.view, t,
+      implicit_unit_diagonal, D_par.view);
+    triangular_matrix_product(B_right.view, A.view, t, implicit_unit_diagonal, D_seq.view);
+    expect_equal(D_par, D_seq);
+
+    triangular_matrix_left_product(exec, A.view, t, implicit_unit_diagonal, C_par.view);
+    triangular_matrix_left_product(A.view, t, implicit_unit_diagonal, C_seq.view);
+    expect_equal(C_par, C_seq);
+
+    triangular_matrix_right_product(exec, A.view, t, explicit_diagonal, D_par.view);
+    triangular_matrix_right_product(A.view, t, explicit_diagonal, D_seq.view);
+    expect_equal(D_par, D_seq);
+  }
+
+  template<class Scalar, class Layout, class Triangle>
+  void test_triangular_solve(Triangle t)
+  {
+    matrix<Scalar, Layout> A(m, m, 1), B(m, n, 2), B_right(n, m, 3);
+    make_unit_triangular<Triangle>(A.view);
+    matrix<Scalar, Layout> X_par(m, n, 0), X_seq(m, n, 0);
+
+    triangular_matrix_matrix_left_solve(std::execution::par, A.view, t,
+      explicit_diagonal, B.view, X_par.view);
+    triangular_matrix_matrix_left_solve(A.view, t, explicit_diagonal, B.view, X_seq.view);
+    expect_near(X_par, X_seq);
+
+    matrix<Scalar, Layout> Y_par(n, m, 0), Y_seq(n, m, 0);
+    triangular_matrix_matrix_right_solve(std::execution::par, A.view, t,
+      implicit_unit_diagonal, B_right.view, Y_par.view);
+    triangular_matrix_matrix_right_solve(A.view, t, implicit_unit_diagonal, B_right.view, Y_seq.view);
+    expect_near(Y_par, Y_seq);
+
+    triangular_matrix_matrix_solve(std::execution::par, A.view, t,
+      explicit_diagonal, left_side, B.view, X_par.view);
+    expect_near(X_par, X_seq);
+    triangular_matrix_matrix_solve(std::execution::par, A.view, t,
+      implicit_unit_diagonal, right_side, B_right.view, Y_par.view);
+    expect_near(Y_par, Y_seq);
+  }
+
+  using impl_thread_pool = LinearAlgebra::impl::thread_pool;
+  using dbl_matrix_view = mdspan<double, dextents<std::size_t, 2>>;
+
+  static_assert(std::is_same_v<
+    decltype(LinearAlgebra::execpolicy_mapper(std::execution::par)),
+    LinearAlgebra::impl::parallel_exec_t>);
+  static_assert(std::is_same_v<
+    decltype(LinearAlgebra::execpolicy_mapper(std::execution::par_unseq)),
+    LinearAlgebra::impl::parallel_exec_t>);
+  static_assert(std::is_same_v<
+    decltype(LinearAlgebra::execpolicy_mapper(std::execution::seq)),
+    LinearAlgebra::impl::inline_exec_t>);
+  static_assert(std::is_same_v<
+    decltype(LinearAlgebra::execpolicy_mapper(std::declval<thread_pool_exec&>())),
+    LinearAlgebra::impl::parallel_exec_t>);
+  static_assert(LinearAlgebra::is_custom_matrix_product_avail<
+    LinearAlgebra::impl::parallel_exec_t,
+    dbl_matrix_view, dbl_matrix_view, dbl_matrix_view>::value);
+
+  TEST(thread_pool, runs_every_task_once)
+  {
+    impl_thread_pool pool(3);
+    EXPECT_EQ(pool.concurrency(), std::size_t(4));
+
+    for (std::size_t num_tasks : {0, 1, 2, 7, 1000}) {
+      std::vector<std::atomic<int>> counts(num_tasks);
+      pool.parallel_for(num_tasks, [&] (std::size_t task) { ++counts[task]; });
+      for (std::size_t task = 0; task < num_tasks; ++task) {
+        EXPECT_EQ(counts[task].load(), 1);
+      }
+    }
+  }
+
+  TEST(thread_pool, steals_from_blocked_thread)
+  {
+    // Task 0 waits for all the others.  Task 1 starts out in the same
+    // thread's range as task 0, so it only runs if another thread
+    // steals it.
+    impl_thread_pool pool(3);
+    constexpr std::size_t num_tasks = 8;
+    std::atomic<std::size_t> others_done{0};
+    bool all_ran = false;
+    pool.parallel_for(num_tasks, [&] (std::size_t task) {
+      if (task == 0) {
+        const auto deadline =
+          std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (others_done.load() != num_tasks - 1 &&
+               std::chrono::steady_clock::now() < deadline) {
+          std::this_thread::yield();
+        }
+        all_ran = others_done.load() == num_tasks - 1;
+      } else {
+        ++others_done;
+      }
+    });
+    EXPECT_TRUE(all_ran);
+  }
+
+  TEST(thread_pool, nested_parallel_for_stays_in_pool)
+  {
+    impl_thread_pool pool(3);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<int> count{0};
+    pool.parallel_for(8, [&] (std::size_t) {
+      EXPECT_TRUE(LinearAlgebra::impl::in_parallel_region());
+      pool.parallel_for(8, [&] (std::size_t) {
+        ++count;
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+      });
+    });
+    EXPECT_EQ(count.load(), 64);
+    EXPECT_LE(threads.size(), pool.concurrency());
+    EXPECT_FALSE(LinearAlgebra::impl::in_parallel_region());
+  }
+
+  TEST(thread_pool, nested_other_pool_runs_inline)
+  {
+    impl_thread_pool outer(3), inner(3);
+    std::atomic<int> count{0};
+    outer.parallel_for(8, [&] (std::size_t) {
+      const auto id = std::this_thread::get_id();
+      inner.parallel_for(8, [&] (std::size_t) {
+        EXPECT_EQ(std::this_thread::get_id(), id);
+        ++count;
+      });
+    });
+    EXPECT_EQ(count.load(), 64);
+  }
+
+  TEST(thread_pool, rethrows_task_exception)
+  {
+    impl_thread_pool pool(3);
+    EXPECT_THROW(
+      pool.parallel_for(100, [] (std::size_t task) {
+        if (task == 42) {
+          throw std::runtime_error("task 42");
+        }
+      }),
+      std::runtime_error);
+
+    // The pool still works afterwards.
+    std::atomic<int> count{0};
+    pool.parallel_for(100, [&] (std::size_t) { ++count; });
+    EXPECT_EQ(count.load(), 100);
+  }
+
+  TEST(parallel, idx_abs_max)
+  {
+    // Long enough to be cut into several blocks, and full of ties.
+    constexpr std::size_t len = std::size_t(1) << 20;
+    vector<double> x(len, 1);
+    EXPECT_EQ(idx_abs_max(std::execution::par, x.view), idx_abs_max(x.view));
+
+    // The first of equal maxima wins, even when a later block has one.
+    x.view(len - 10) = -100.0;
+    x.view(len / 2 + 3) = 100.0;
+    EXPECT_EQ(idx_abs_max(std::execution::par, x.view), len / 2 + 3);
+    x.view(3 * len / 4) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(idx_abs_max(std::execution::par, x.view), len / 2 + 3);
+    x.view(0) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(idx_abs_max(std::execution::par, x.view), std::size_t(0));
+
+    vector<complex_t> z(len, 2);
+    z.view(len - 1) = complex_t(-80.0, 0.0);
+    z.view(len / 3) = complex_t(-70.0, 30.0);
+    EXPECT_EQ(idx_abs_max(std::execution::par, z.view), len - 1);
+    EXPECT_EQ(idx_abs_max(std::execution::par, z.view, LinearAlgebra::idx_abs_max_abs_parts),
+              len / 3);
+  }
+
+  // The sums are the same, bit for bit, for any number of threads.
+  // Their terms are not small integers, so that the order of the sum
+  // shows in its rounding.
+  TEST(parallel, reproducible_reductions)
+  {
+    using LinearAlgebra::dot;
+    using LinearAlgebra::dotc;
+    using LinearAlgebra::matrix_frob_norm;
+    using LinearAlgebra::vector_abs_sum;
+    using LinearAlgebra::vector_norm2;
+    constexpr std::size_t chunk = LinearAlgebra::impl::reduction_chunk_size;
+
+    for (std::size_t len : {chunk / 3, 12 * chunk + 1234}) {
+      std::vector<double> x_mem(len), y_mem(len);
+      std::vector<complex_t> z_mem(len);
+      for (std::size_t i = 0; i < len; ++i) {
+        x_mem[i] = std::sin(double(i)) / double(i % 97 + 1);
+        y_mem[i] = std::cos(0.3 * double(i)) * double(i % 13 + 1);
+        z_mem[i] = complex_t(x_mem[i], y_mem[i]);
+      }
+      mdspan<double, dextents<std::size_t, 1>> x(x_mem.data(), len);
+      mdspan<double, dextents<std::size_t, 1>> y(y_mem.data(), len);
+      mdspan<complex_t, dextents<std::size_t, 1>> z(z_mem.data(), len);
+      const std::size_t rows = len / 64;
+      mdspan<double, dextents<std::size_t, 2>, layout_left> A(y_mem.data(), rows, 64);
+
+      const auto sums = [&] (const auto& exec) {
+        return std::vector<complex_t>{
+          dot(exec, x, y), dot(exec, scaled(3.0, x), y, 1.0), dotc(exec, z, z),
+          vector_abs_sum(exec, y), vector_norm2(exec, x), vector_norm2(exec, z),
+          matrix_frob_norm(exec, A), matrix_frob_norm(exec, transposed(A))};
+      };
+      const auto one_thread = sums(thread_pool_exec(1));
+      EXPECT_EQ(sums(thread_pool_exec(2)), one_thread);
+      EXPECT_EQ(sums(thread_pool_exec(3)), one_thread);
+      EXPECT_EQ(sums(thread_pool_exec(7)), one_thread);
+      EXPECT_EQ(sums(std::execution::par), one_thread);
+
+      const auto inline_sums = sums(LinearAlgebra::impl::inline_exec_t{});
+      for (std::size_t k = 0; k < one_thread.size(); ++k) {
+        if (len <= chunk) {
+          EXPECT_EQ(one_thread[k], inline_sums[k]);
+        }
+        else {
+          EXPECT_NEAR(std::abs(one_thread[k] - inline_sums[k]), 0.0,
+                      1e-12 * std::abs(inline_sums[k]));
+        }
+      }
+    }
+  }
+
+  TEST(parallel, givens_rotation_apply)
+  {
+    constexpr std::size_t len = std::size_t(1) << 18;
+    vector<double> x(len, 1), y(len, 2), x_expected(len, 1), y_expected(len, 2);
+    givens_rotation_apply(std::execution::par, x.view, y.view, 0.6, 0.8);
+    givens_rotation_apply(x_expected.view, y_expected.view, 0.6, 0.8);
+    for (std::size_t i = 0; i < len; ++i) {
+      EXPECT_NEAR(x.view(i), x_expected.view(i), 1.0e-14);
+      EXPECT_NEAR(y.view(i), y_expected.view(i), 1.0e-14);
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_givens_rotation_sequence_apply()
+  {
+    constexpr std::size_t num_sequences = 3;
+    matrix<Scalar, Layout> A(2 * m, n, 1), expected(2 * m, n, 1);
+    std::vector<double> c_storage((n - 1) * num_sequences);
+    std::vector<Scalar> s_storage((n - 1) * num_sequences);
+    for (std::size_t r = 0; r < c_storage.size(); ++r) {
+      c_storage[r] = std::cos(0.3 * double(r));
+      s_storage[r] = Scalar(std::sin(0.3 * double(r)));
+    }
+    mdspan<double, dextents<std::size_t, 2>> c(c_storage.data(), n - 1, num_sequences);
+    mdspan<Scalar, dextents<std::size_t, 2>> s(s_storage.data(), n - 1, num_sequences);
+    givens_rotation_sequence_apply(std::execution::par, A.view, c, s);
+    givens_rotation_sequence_apply(expected.view, c, s);
+    expect_near(A, expected);
+  }
+
+  TEST(parallel, givens_rotation_sequence_apply)
+  {
+    test_givens_rotation_sequence_apply<double, layout_left>();
+    test_givens_rotation_sequence_apply<double, layout_right>();
+    test_givens_rotation_sequence_apply<complex_t, layout_left>();
+  }
+
+  TEST(parallel, matrix_product)
+  {
+    test_matrix_product<double, layout_left>();
+    test_matrix_product<double, layout_right>();
+    test_matrix_product<complex_t, layout_left>();
+  }
+
+  TEST(parallel, batched_matrix_product)
+  {
+    test_batched_matrix_product<double, layout_batch_interleaved>(3000, 5);
+    test_batched_matrix_product<double, layout_right>(3000, 5);
+    test_batched_matrix_product<complex_t, layout_batch_interleaved>(500, 6);
+    test_batched_matrix_product<double, layout_right>(2, 80);
+  }
+
+  TEST(parallel, batched_gemv_and_trsm)
+  {
+    test_batched_gemv_and_trsm<double, layout_batch_interleaved>(lower_triangle, 5000, 6);
+    test_batched_gemv_and_trsm<double, layout_right>(upper_triangle, 5000, 6);
+    test_batched_gemv_and_trsm<complex_t, layout_batch_interleaved>(upper_triangle, 1000, 6);
+    test_batched_gemv_and_trsm<double, layout_right>(lower_triangle, 2, 150);
+  }
+
+  TEST(parallel, matrix_vector_product)
+  {
+    test_matrix_vector_product<double, layout_left>();
+    test_matrix_vector_product<double, layout_right>();
+    test_matrix_vector_product<complex_t, layout_left>();
+  }
+
+  TEST(parallel, symmetric_matrix_vector_product)
+  {
+    test_symmetric_matrix_vector_product<false, double, layout_left>(lower_triangle);
+    test_symmetric_matrix_vector_product<false, double, layout_right>(upper_triangle);
+    test_symmetric_matrix_vector_product<true, complex_t, layout_left>(lower_triangle);
+    test_symmetric_matrix_vector_product<true, complex_t, layout_right>(upper_triangle);
+  }
+
+  TEST(parallel, matrix_rank_1_update)
+  {
+    test_matrix_rank_1_update<double, layout_left>();
+    test_matrix_rank_1_update<complex_t, layout_right>();
+  }
+
+  TEST(parallel, rank_1_and_2_updates)
+  {
+    test_rank_1_and_2_update<false, double, layout_left>(lower_triangle);
+    test_rank_1_and_2_update<false, double, layout_right>(upper_triangle);
+    test_rank_1_and_2_update<true, complex_t, layout_left>(upper_triangle);
+    test_rank_1_and_2_update<true, complex_t, layout_right>(lower_triangle);
+  }
+
+  TEST(parallel, rank_k_update)
+  {
+    test_rank_k_update<false, double, layout_left>(lower_triangle);
+    test_rank_k_update<false, double, layout_right>(upper_triangle);
+    test_rank_k_update<true, complex_t, layout_left>(upper_triangle);
+    test_rank_k_update<true, complex_t, layout_right>(lower_triangle);
+  }
+
+  TEST(parallel, thread_pool_exec)
+  {
+    EXPECT_EQ(thread_pool_exec(3).num_threads(), std::size_t(3));
+    EXPECT_EQ(thread_pool_exec(0).num_threads(), std::size_t(1));
+    EXPECT_EQ(&thread_pool_exec().pool(), &LinearAlgebra::impl::default_thread_pool());
+
+    // A single-threaded policy runs everything inline.
+    matrix<double, layout_left> A(m, k, 1), B(k, n, 2);
+    matrix<double, layout_left> C_par(m, n, 0), C_seq(m, n, 0);
+    matrix_product(thread_pool_exec(1), A.view, B.view, C_par.view);
+    matrix_product(A.view, B.view, C_seq.view);
+    expect_equal(C_par, C_seq);
+  }
+
+  TEST(parallel, triangular_matrix_product)
+  {
+    test_triangular_product<double, layout_left>(lower_triangle);
+    test_triangular_product<double, layout_right>(upper_triangle);
+    test_triangular_product<complex_t, layout_left>(upper_triangle);
+  }
+
+  TEST(parallel, triangular_matrix_matrix_solve)
+  {
+    test_triangular_solve<double, layout_left>(lower_triangle);
+    test_triangular_solve<double, layout_right>(upper_triangle);
+    test_triangular_solve<complex_t, layout_left>(upper_triangle);
+  }
+}
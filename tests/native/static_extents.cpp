@@ -0,0 +1,170 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+// Operands with small static extents take the unrolled kernels.  They
+// compute the same sums in the same order as the generic loops, so
+// compare exactly with the same problems with dynamic extents.
+
+namespace {
+  using LinearAlgebra::dot;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::matrix_product;
+  using LinearAlgebra::matrix_vector_product;
+  using LinearAlgebra::scale;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::triangular_matrix_vector_solve;
+  using LinearAlgebra::upper_triangle;
+
+  template<class Scalar, std::size_t Rows, std::size_t Cols, class Layout = layout_right>
+  struct static_matrix {
+    using view_type = mdspan<Scalar, extents<std::size_t, Rows, Cols>, Layout>;
+    using dynamic_type = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+
+    explicit static_matrix(int seed) : storage(Rows * Cols), view(storage.data())
+    {
+      for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 0; j < Cols; ++j) {
+          view(i,j) = Scalar(0.25) * test_value<Scalar>(int(seed + 3 * i + 5 * j));
+        }
+      }
+    }
+
+    dynamic_type dynamic() { return dynamic_type(storage.data(), Rows, Cols); }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  template<class Scalar, std::size_t N>
+  struct static_vector {
+    using view_type = mdspan<Scalar, extents<std::size_t, N>>;
+    using dynamic_type = mdspan<Scalar, dextents<std::size_t, 1>>;
+
+    explicit static_vector(int seed) : storage(N), view(storage.data())
+    {
+      for (std::size_t i = 0; i < N; ++i) {
+        view(i) = Scalar(0.25) * test_value<Scalar>(int(seed + 2 * i));
+      }
+    }
+
+    dynamic_type dynamic() { return dynamic_type(storage.data(), N); }
+
+    std::vector<Scalar> storage;
+    view_type view;
+  };
+
+  template<class Scalar, std::size_t M, std::size_t N, std::size_t K, class Layout>
+  void test_static_matrix_product()
+  {
+    static_matrix<Scalar, M, K, Layout> A(1);
+    static_matrix<Scalar, K, N, Layout> B(2);
+    static_matrix<Scalar, N, K, Layout> Bt(3);
+    static_matrix<Scalar, M, N, Layout> E(4), C(0), D(0);
+
+    matrix_product(A.view, B.view, C.view);
+    matrix_product(A.dynamic(), B.dynamic(), D.dynamic());
+    EXPECT_EQ(C.storage, D.storage);
+
+    matrix_product(A.view, scaled(Scalar(2.0), transposed(Bt.view)), E.view, C.view);
+    matrix_product(A.dynamic(), scaled(Scalar(2.0), transposed(Bt.dynamic())), E.dynamic(),
+                   D.dynamic());
+    EXPECT_EQ(C.storage, D.storage);
+
+    // In place: C := C + A * B.
+    matrix_product(A.view, B.view, C.view, C.view);
+    matrix_product(A.dynamic(), B.dynamic(), D.dynamic(), D.dynamic());
+    EXPECT_EQ(C.storage, D.storage);
+  }
+
+  TEST(static_extents, matrix_product)
+  {
+    using small_t = mdspan<double, extents<std::size_t, 4, 4>>;
+    static_assert(LinearAlgebra::impl::static_matrix_product_eligible<small_t, small_t, small_t>());
+    test_static_matrix_product<double, 3, 3, 3, layout_right>();
+    test_static_matrix_product<double, 4, 4, 4, layout_left>();
+    test_static_matrix_product<float, 2, 5, 3, layout_right>();
+    test_static_matrix_product<std::complex<double>, 4, 4, 4, layout_left>();
+    // Too much work to unroll: takes the generic path.
+    using big_t = mdspan<double, extents<std::size_t, 16, 16>>;
+    static_assert(! LinearAlgebra::impl::static_matrix_product_eligible<big_t, big_t, big_t>());
+    test_static_matrix_product<double, 16, 16, 16, layout_right>();
+  }
+
+  template<class Scalar, std::size_t M, std::size_t N, class Layout>
+  void test_static_matrix_vector_product()
+  {
+    static_matrix<Scalar, M, N, Layout> A(1);
+    static_vector<Scalar, N> x(2);
+    static_vector<Scalar, M> y0(3), y(0), z(0);
+    static_assert(LinearAlgebra::impl::static_matrix_vector_product_eligible<
+                  decltype(A.view), decltype(x.view), decltype(y.view)>());
+
+    matrix_vector_product(A.view, x.view, y.view);
+    matrix_vector_product(A.dynamic(), x.dynamic(), z.dynamic());
+    EXPECT_EQ(y.storage, z.storage);
+
+    matrix_vector_product(scaled(Scalar(-2.0), A.view), x.view, y0.view, y.view);
+    matrix_vector_product(scaled(Scalar(-2.0), A.dynamic()), x.dynamic(), y0.dynamic(),
+                          z.dynamic());
+    EXPECT_EQ(y.storage, z.storage);
+  }
+
+  TEST(static_extents, matrix_vector_product)
+  {
+    test_static_matrix_vector_product<double, 3, 3, layout_right>();
+    test_static_matrix_vector_product<double, 4, 3, layout_left>();
+    test_static_matrix_vector_product<float, 16, 16, layout_right>();
+    test_static_matrix_vector_product<std::complex<double>, 4, 4, layout_left>();
+  }
+
+  template<class Scalar, std::size_t N, class Layout, class Triangle, class DiagonalStorage>
+  void test_static_triangular_solve(Triangle t, DiagonalStorage d)
+  {
+    static_matrix<Scalar, N, N, Layout> A(1);
+    for (std::size_t i = 0; i < N; ++i) {
+      A.view(i,i) = Scalar(2.0 + double(i % 3));
+    }
+    static_vector<Scalar, N> b(2), x(0), y(0), in_place(2);
+    static_assert(LinearAlgebra::impl::static_triangular_matrix_vector_solve_eligible<
+                  decltype(A.view), decltype(b.view), decltype(x.view)>());
+
+    triangular_matrix_vector_solve(A.view, t, d, b.view, x.view);
+    triangular_matrix_vector_solve(A.dynamic(), t, d, b.dynamic(), y.dynamic());
+    EXPECT_EQ(x.storage, y.storage);
+
+    triangular_matrix_vector_solve(A.view, t, d, in_place.view, in_place.view);
+    EXPECT_EQ(in_place.storage, y.storage);
+  }
+
+  TEST(static_extents, triangular_matrix_vector_solve)
+  {
+    test_static_triangular_solve<double, 3, layout_right>(lower_triangle, explicit_diagonal);
+    test_static_triangular_solve<double, 4, layout_left>(upper_triangle, explicit_diagonal);
+    test_static_triangular_solve<double, 6, layout_right>(upper_triangle, implicit_unit_diagonal);
+    test_static_triangular_solve<std::complex<double>, 4, layout_left>(
+      lower_triangle, implicit_unit_diagonal);
+  }
+
+  TEST(static_extents, dot_and_scale)
+  {
+    static_vector<double, 3> x(1), y(2);
+    static_vector<std::complex<double>, 4> u(3), v(4);
+    EXPECT_EQ(dot(x.view, y.view), dot(x.dynamic(), y.dynamic()));
+    EXPECT_EQ(dot(x.view, y.view, 1.5), dot(x.dynamic(), y.dynamic(), 1.5));
+    EXPECT_EQ(LinearAlgebra::dotc(u.view, v.view), LinearAlgebra::dotc(u.dynamic(), v.dynamic()));
+
+    static_vector<double, 5> w(5), w_dynamic(5);
+    scale(3.0, w.view);
+    scale(3.0, w_dynamic.dynamic());
+    EXPECT_EQ(w.storage, w_dynamic.storage);
+
+    static_matrix<double, 3, 4, layout_left> A(6), B(6);
+    scale(-0.5, A.view);
+    scale(-0.5, B.dynamic());
+    EXPECT_EQ(A.storage, B.storage);
+  }
+
+} // end anonymous namespace
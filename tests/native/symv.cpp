@@ -0,0 +1,234 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+// The symmetric and Hermitian matrix-vector products of matrices in
+// column-major and row-major arrays take the fused product, which reads
+// each element of the triangle once.  All values are small integers,
+// so every result is exact and does not depend on the order of the
+// sums.
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::hermitian_matrix_vector_product;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_vector_product;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::upper_triangle;
+
+  using complex_t = std::complex<double>;
+
+  // Computes y = A*x and z = y0 + A*x for the n x n symmetric or
+  // Hermitian matrix A whose Triangle is stored in an array with the
+  // given layout, and filled with junk outside it, and compares with a
+  // product with all of A stored explicitly.  n = 151 takes the fused
+  // product through full and partial groups of four columns.  y and z
+  // may be strided.
+  template<bool Hermitian, class Scalar, class Layout, class Triangle>
+  void test_symv(Triangle t, std::size_t incy = 1)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    const std::size_t n = 151;
+    using A_t = mdspan<Scalar, dextents<std::size_t, 2>, Layout>;
+    using strided_vector_t = mdspan<Scalar, dextents<std::size_t, 1>, layout_stride>;
+    static_assert(LinearAlgebra::impl::fused_symv_eligible<A_t, strided_vector_t>());
+
+    std::vector<Scalar> A_mem(n * n), full(n * n);
+    A_t A(A_mem.data(), n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        const bool stored = lower ? i >= j : i <= j;
+        A(i,j) = stored ? test_value<Scalar>(int(3 * i + 5 * j)) : Scalar(1.0e6);
+      }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        const bool stored = lower ? i >= j : i <= j;
+        Scalar A_ij = stored ? A(i,j) : A(j,i);
+        if constexpr (Hermitian) {
+          if (i == j) {
+            A_ij = Scalar(std::real(A_ij));
+          } else if (! stored) {
+            A_ij = LinearAlgebra::impl::conj_if_needed(A_ij);
+          }
+        }
+        full[i * n + j] = A_ij;
+      }
+    }
+
+    std::vector<Scalar> x_mem(n), y0_mem(n), expected(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_mem[i] = test_value<Scalar>(int(2 * i + 1));
+      y0_mem[i] = test_value<Scalar>(int(i + 4));
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      Scalar sum{};
+      for (std::size_t j = 0; j < n; ++j) {
+        sum += full[i * n + j] * x_mem[j];
+      }
+      expected[i] = sum;
+    }
+
+    mdspan<const Scalar, dextents<std::size_t, 1>> x(x_mem.data(), n);
+    mdspan<const Scalar, dextents<std::size_t, 1>> y0(y0_mem.data(), n);
+    std::vector<Scalar> y_mem(n * incy, Scalar(7.0)), z_mem(n * incy, Scalar(7.0));
+    layout_stride::mapping<dextents<std::size_t, 1>> y_mapping(
+      dextents<std::size_t, 1>(n), std::array<std::size_t, 1>{incy});
+    strided_vector_t y(y_mem.data(), y_mapping);
+    strided_vector_t z(z_mem.data(), y_mapping);
+
+    if constexpr (Hermitian) {
+      hermitian_matrix_vector_product(A, t, x, y);
+      hermitian_matrix_vector_product(A, t, x, y0, z);
+    } else {
+      symmetric_matrix_vector_product(A, t, x, y);
+      symmetric_matrix_vector_product(A, t, x, y0, z);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(y(i), expected[i]);
+      EXPECT_EQ(z(i), y0_mem[i] + expected[i]);
+    }
+  }
+
+  template<bool Hermitian, class Scalar, class Layout>
+  void test_symv_all_cases()
+  {
+    test_symv<Hermitian, Scalar, Layout>(lower_triangle);
+    test_symv<Hermitian, Scalar, Layout>(upper_triangle);
+    test_symv<Hermitian, Scalar, Layout>(lower_triangle, 3);
+  }
+
+  TEST(BLAS2_symv, double_layout_left)
+  {
+    test_symv_all_cases<false, double, layout_left>();
+    test_symv_all_cases<true, double, layout_left>();
+  }
+
+  TEST(BLAS2_symv, double_layout_right)
+  {
+    test_symv_all_cases<false, double, layout_right>();
+    test_symv_all_cases<true, double, layout_right>();
+  }
+
+  TEST(BLAS2_symv, complex_layout_left)
+  {
+    test_symv_all_cases<false, complex_t, layout_left>();
+    test_symv_all_cases<true, complex_t, layout_left>();
+  }
+
+  TEST(BLAS2_symv, complex_layout_right)
+  {
+    test_symv_all_cases<false, complex_t, layout_right>();
+    test_symv_all_cases<true, complex_t, layout_right>();
+  }
+
+  // Scaled, conjugated and transposed views of A take the fused
+  // product too; compare them with products with the same matrix
+  // stored explicitly, and x conjugated.
+  template<bool Hermitian, class Layout>
+  void test_symv_views()
+  {
+    const std::size_t n = 70;
+    using matrix_t = mdspan<complex_t, dextents<std::size_t, 2>, Layout>;
+    // B is layout_stride, so its products take the unfused loops.
+    using stride_matrix_t = mdspan<complex_t, dextents<std::size_t, 2>, layout_stride>;
+    std::vector<complex_t> A_mem(n * n), B_mem(n * n);
+    matrix_t A(A_mem.data(), n, n);
+    stride_matrix_t B(B_mem.data(), layout_stride::mapping<dextents<std::size_t, 2>>(
+      dextents<std::size_t, 2>(n, n), std::array<std::size_t, 2>{1, n}));
+    static_assert(! LinearAlgebra::impl::fused_symv_eligible<stride_matrix_t,
+                  mdspan<complex_t, dextents<std::size_t, 1>>>());
+    const complex_t alpha(2.0, 1.0);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i,j) = test_value<complex_t>(int(2 * i + 7 * j));
+      }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        B(i,j) = alpha * std::conj(A(j,i));
+      }
+    }
+    auto A_view = scaled(alpha, conjugated(transposed(A)));
+
+    std::vector<complex_t> x_mem(n), y_mem(n), w_mem(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      x_mem[i] = test_value<complex_t>(int(i));
+    }
+    mdspan<complex_t, dextents<std::size_t, 1>> x(x_mem.data(), n);
+    mdspan<complex_t, dextents<std::size_t, 1>> y(y_mem.data(), n);
+    mdspan<complex_t, dextents<std::size_t, 1>> w(w_mem.data(), n);
+    static_assert(LinearAlgebra::impl::fused_symv_eligible<decltype(A_view), decltype(y)>());
+
+    auto check = [&] (auto t) {
+      if constexpr (Hermitian) {
+        hermitian_matrix_vector_product(A_view, t, conjugated(x), y);
+        hermitian_matrix_vector_product(B, t, conjugated(x), w);
+      } else {
+        symmetric_matrix_vector_product(A_view, t, conjugated(x), y);
+        symmetric_matrix_vector_product(B, t, conjugated(x), w);
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(y(i), w(i));
+      }
+    };
+    check(lower_triangle);
+    check(upper_triangle);
+  }
+
+  TEST(BLAS2_symv, views)
+  {
+    test_symv_views<false, layout_left>();
+    test_symv_views<false, layout_right>();
+    test_symv_views<true, layout_left>();
+    test_symv_views<true, layout_right>();
+  }
+
+  // Checks each SIMD kernel up to the one this CPU runs against the
+  // scalar kernel, with the lengths ending in whole vectors and in a
+  // scalar tail.
+  template<class Scalar>
+  void test_simd_symv_kernels()
+  {
+    using LinearAlgebra::impl::simd_isa;
+    constexpr std::size_t C = 4;
+    constexpr std::size_t lda = 41;
+    std::vector<Scalar> a(C * lda), x(lda), y0(lda);
+    for (std::size_t k = 0; k < a.size(); ++k) {
+      a[k] = test_value<Scalar>(int(k));
+    }
+    for (std::size_t k = 0; k < lda; ++k) {
+      x[k] = test_value<Scalar>(int(3 * k + 1));
+      y0[k] = test_value<Scalar>(int(k + 2));
+    }
+    const Scalar c[C] = {Scalar(1), Scalar(-2), Scalar(3), Scalar(2)};
+
+    for (std::size_t n : {std::size_t(1), std::size_t(8), std::size_t(16), std::size_t(37)}) {
+      std::vector<Scalar> y_expected(y0);
+      Scalar t_expected[C];
+      LinearAlgebra::impl::scalar_symv_columns<C>(a.data(), lda, c,
+        x.data(), y_expected.data(), n, t_expected);
+      for (simd_isa isa : {simd_isa::generic, simd_isa::avx2, simd_isa::avx512}) {
+        if (isa > LinearAlgebra::impl::active_simd_isa()) {
+          continue;
+        }
+        std::vector<Scalar> y(y0);
+        Scalar t[C];
+        LinearAlgebra::impl::simd_symv_columns<C>(isa, a.data(), lda, c,
+          x.data(), y.data(), n, t);
+        EXPECT_EQ(y, y_expected);
+        for (std::size_t q = 0; q < C; ++q) {
+          EXPECT_EQ(t[q], t_expected[q]);
+        }
+      }
+    }
+  }
+
+  TEST(BLAS2_symv, simd_kernels)
+  {
+    test_simd_symv_kernels<double>();
+    test_simd_symv_kernels<float>();
+  }
+
+} // end anonymous namespace
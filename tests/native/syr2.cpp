@@ -0,0 +1,36 @@
+#include "./gtest_fixtures.hpp"
+#include <complex>
+
+namespace {
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::upper_triangle;
+
+  // Rank-2 updates of the triangle of a matrix in a column-major or
+  // row-major array take the outer-product kernel, which must leave
+  // the other triangle alone too.
+  template<class Scalar, class Layout, class Triangle>
+  void test_syr2_kernel(Triangle t)
+  {
+    layout_stride_reference<Scalar, Layout> r(37, 37);
+    static_assert(LinearAlgebra::impl::outer_product_update_eligible<decltype(r.A)>());
+    const auto& x = r.x;
+    const auto& y = r.y;
+
+    r.check([&] (auto M) { LinearAlgebra::symmetric_matrix_rank_2_update(x, y, M, t); });
+    r.check([&] (auto M) { LinearAlgebra::hermitian_matrix_rank_2_update(x, y, M, t); });
+    r.check([&] (auto M) {
+      LinearAlgebra::hermitian_matrix_rank_2_update(LinearAlgebra::scaled(Scalar(2), y), x, M, t);
+    });
+  }
+
+  TEST(BLAS2_syr2, kernel)
+  {
+    test_syr2_kernel<double, layout_left>(lower_triangle);
+    test_syr2_kernel<double, layout_left>(upper_triangle);
+    test_syr2_kernel<double, layout_right>(lower_triangle);
+    test_syr2_kernel<double, layout_right>(upper_triangle);
+    test_syr2_kernel<std::complex<double>, layout_left>(lower_triangle);
+    test_syr2_kernel<std::complex<double>, layout_right>(upper_triangle);
+  }
+
+} // end anonymous namespace
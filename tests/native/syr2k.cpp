@@ -0,0 +1,78 @@
+#include "./gtest_fixtures.hpp"
+
+namespace {
+  using LinearAlgebra::hermitian_matrix_rank_2k_update;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::symmetric_matrix_rank_2k_update;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::upper_triangle;
+
+  // Large enough for the fused update: n crosses a panel boundary, and
+  // neither n nor k is a multiple of the register tile.  Entries
+  // outside the triangle must stay untouched.
+  template<class Layout, class Triangle>
+  void test_fused_syr2k(Triangle t)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    constexpr double flag = -1000.0;
+    const std::size_t n = 301;
+    const std::size_t k = 37;
+    using matrix_t = mdspan<double, dextents<std::size_t, 2>, Layout>;
+
+    std::vector<double> A_mem(n * k), B_mem(k * n), C_mem(n * n), C_ref_mem(n * n);
+    matrix_t A(A_mem.data(), n, k);
+    // B is stored transposed, to mix layouts.
+    matrix_t B_t(B_mem.data(), k, n);
+    matrix_t C(C_mem.data(), n, n);
+    matrix_t C_ref(C_ref_mem.data(), n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t p = 0; p < k; ++p) {
+        A(i,p) = double(int((3 * i + 7 * p) % 11) - 5);
+        B_t(p,i) = double(int((5 * i + 2 * p) % 7) - 3);
+      }
+    }
+    const auto B = scaled(2.0, transposed(B_t));
+
+    auto reset = [&] () {
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          const bool in_triangle = lower ? i >= j : i <= j;
+          C(i,j) = in_triangle ? double(int(i + 2 * j) % 5) : flag;
+          C_ref(i,j) = C(i,j);
+          if (in_triangle) {
+            for (std::size_t p = 0; p < k; ++p) {
+              C_ref(i,j) += A(i,p) * B(j,p) + B(i,p) * A(j,p);
+            }
+          }
+        }
+      }
+    };
+    auto check = [&] () {
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          // Integer data: the sums are exact.
+          EXPECT_EQ(C(i,j), C_ref(i,j)) << "at (" << i << ", " << j << ")";
+        }
+      }
+    };
+
+    reset();
+    symmetric_matrix_rank_2k_update(A, B, C, t);
+    check();
+
+    reset();
+    hermitian_matrix_rank_2k_update(A, B, C, t);
+    check();
+  }
+
+  TEST(BLAS3_syr2k, fused)
+  {
+    test_fused_syr2k<layout_left>(lower_triangle);
+    test_fused_syr2k<layout_left>(upper_triangle);
+    test_fused_syr2k<layout_right>(lower_triangle);
+    test_fused_syr2k<layout_right>(upper_triangle);
+  }
+
+} // end anonymous namespace
@@ -1,6 +1,9 @@
 #include "./gtest_fixtures.hpp"
 
 namespace {
+  using LinearAlgebra::hermitian_matrix_rank_k_update;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
   using LinearAlgebra::symmetric_matrix_rank_k_update;
   using LinearAlgebra::transposed;
   using LinearAlgebra::upper_triangle;
@@ -75,4 +78,78 @@ namespace {
     }
   }
 
+  // Large enough for the tiled update: n crosses a tile boundary, and
+  // neither n nor k is a multiple of the register tile.  Entries
+  // outside the triangle must stay untouched.
+  template<class Layout, class Triangle>
+  void test_tiled_syrk(Triangle t)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    constexpr double flag = -1000.0;
+    const std::size_t n = 301;
+    const std::size_t k = 43;
+    using matrix_t = mdspan<double, dextents<std::size_t, 2>, Layout>;
+
+    std::vector<double> A_mem(n * k), C_mem(n * n), C_ref_mem(n * n);
+    matrix_t A(A_mem.data(), n, k);
+    matrix_t C(C_mem.data(), n, n);
+    matrix_t C_ref(C_ref_mem.data(), n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < k; ++j) {
+        A(i,j) = double(int((3 * i + 7 * j) % 11) - 5);
+      }
+    }
+    auto reset = [&] () {
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          const bool in_triangle = lower ? i >= j : i <= j;
+          C(i,j) = in_triangle ? double(int(i + 2 * j) % 5) : flag;
+          C_ref(i,j) = C(i,j);
+        }
+      }
+    };
+    auto update_reference = [&] (double alpha) {
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          if (lower ? i >= j : i <= j) {
+            for (std::size_t p = 0; p < k; ++p) {
+              C_ref(i,j) += alpha * A(i,p) * A(j,p);
+            }
+          }
+        }
+      }
+    };
+    auto check = [&] () {
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+          // Integer data: the sums are exact.
+          EXPECT_EQ(C(i,j), C_ref(i,j)) << "at (" << i << ", " << j << ")";
+        }
+      }
+    };
+
+    reset();
+    update_reference(2.0);
+    symmetric_matrix_rank_k_update(2.0, A, C, t);
+    check();
+
+    reset();
+    update_reference(1.0);
+    symmetric_matrix_rank_k_update(A, C, t);
+    check();
+
+    reset();
+    update_reference(-3.0);
+    hermitian_matrix_rank_k_update(-3.0, A, C, t);
+    check();
+  }
+
+  TEST(BLAS3_syrk, tiled)
+  {
+    test_tiled_syrk<layout_left>(lower_triangle);
+    test_tiled_syrk<layout_left>(upper_triangle);
+    test_tiled_syrk<layout_right>(lower_triangle);
+    test_tiled_syrk<layout_right>(upper_triangle);
+  }
+
 } // end anonymous namespace
@@ -1,4 +1,5 @@
 #include "./gtest_fixtures.hpp"
+#include <cmath>
 #include <iostream>
 
 namespace {
@@ -88,4 +89,100 @@ namespace {
     test_tsrm_lower_triangular_right_side< int, layout_left >();
   }
 
+  // Large enough for the recursive, GEMM-based solve.  X has integer
+  // entries, and B is computed from X and A.
+  template<class Layout, class Triangle, class DiagonalStorage, class Side>
+  void test_blocked_trsm(Triangle t, DiagonalStorage d, Side side)
+  {
+    using LinearAlgebra::triangular_matrix_matrix_solve;
+    constexpr bool lower = std::is_same_v<Triangle, LinearAlgebra::lower_triangle_t>;
+    constexpr bool explicit_diag =
+      std::is_same_v<DiagonalStorage, LinearAlgebra::explicit_diagonal_t>;
+    constexpr bool left = std::is_same_v<Side, LinearAlgebra::left_side_t>;
+    const std::size_t m = 150;
+    const std::size_t nrhs = 37;
+    const std::size_t num_rows = left ? m : nrhs;
+    const std::size_t num_cols = left ? nrhs : m;
+    using matrix_t = mdspan<double, dextents<std::size_t, 2>, Layout>;
+
+    // The diagonal dominates, so the solve is well conditioned.  The
+    // other triangle and the implicit diagonal hold junk, which the
+    // solve must not read.
+    std::vector<double> vec_A(m * m);
+    matrix_t A(vec_A.data(), m, m);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = 0; j < m; ++j) {
+        const bool stored = lower ? j < i : j > i;
+        if (i == j) {
+          A(i,j) = explicit_diag ? 4.0 + double(i % 3) : -1.0e6;
+        } else {
+          A(i,j) = stored ? double(int((3 * i + 5 * j) % 7) - 3) / double(m) : 1.0e6;
+        }
+      }
+    }
+    auto a = [&](std::size_t i, std::size_t j) {
+      if (i == j) {
+        return explicit_diag ? A(i,j) : 1.0;
+      }
+      return (lower ? j < i : j > i) ? A(i,j) : 0.0;
+    };
+
+    std::vector<double> vec_X_true(num_rows * num_cols);
+    std::vector<double> vec_B(num_rows * num_cols);
+    std::vector<double> vec_X(num_rows * num_cols);
+    matrix_t X_true(vec_X_true.data(), num_rows, num_cols);
+    matrix_t B(vec_B.data(), num_rows, num_cols);
+    matrix_t X(vec_X.data(), num_rows, num_cols);
+    for (std::size_t i = 0; i < num_rows; ++i) {
+      for (std::size_t j = 0; j < num_cols; ++j) {
+        X_true(i,j) = double(int((i + 2 * j) % 9) - 4);
+      }
+    }
+    for (std::size_t i = 0; i < num_rows; ++i) {
+      for (std::size_t j = 0; j < num_cols; ++j) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < m; ++k) {
+          sum += left ? a(i,k) * X_true(k,j) : X_true(i,k) * a(k,j);
+        }
+        B(i,j) = sum;
+      }
+    }
+
+    triangular_matrix_matrix_solve(A, t, d, side, B, X);
+    for (std::size_t i = 0; i < num_rows; ++i) {
+      for (std::size_t j = 0; j < num_cols; ++j) {
+        EXPECT_NEAR(X(i,j), X_true(i,j), 1.0e-10);
+      }
+    }
+  }
+
+  template<class Layout>
+  void test_blocked_trsm_all_cases()
+  {
+    using LinearAlgebra::lower_triangle;
+    using LinearAlgebra::upper_triangle;
+    using LinearAlgebra::explicit_diagonal;
+    using LinearAlgebra::implicit_unit_diagonal;
+    using LinearAlgebra::left_side;
+    using LinearAlgebra::right_side;
+    test_blocked_trsm<Layout>(lower_triangle, explicit_diagonal, left_side);
+    test_blocked_trsm<Layout>(lower_triangle, implicit_unit_diagonal, left_side);
+    test_blocked_trsm<Layout>(upper_triangle, explicit_diagonal, left_side);
+    test_blocked_trsm<Layout>(upper_triangle, implicit_unit_diagonal, left_side);
+    test_blocked_trsm<Layout>(lower_triangle, explicit_diagonal, right_side);
+    test_blocked_trsm<Layout>(lower_triangle, implicit_unit_diagonal, right_side);
+    test_blocked_trsm<Layout>(upper_triangle, explicit_diagonal, right_side);
+    test_blocked_trsm<Layout>(upper_triangle, implicit_unit_diagonal, right_side);
+  }
+
+  TEST(BLAS3_trsm, blocked_layout_right)
+  {
+    test_blocked_trsm_all_cases<layout_right>();
+  }
+
+  TEST(BLAS3_trsm, blocked_layout_left)
+  {
+    test_blocked_trsm_all_cases<layout_left>();
+  }
+
 } // end anonymous namespace
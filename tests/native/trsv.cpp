@@ -0,0 +1,151 @@
+#include "./gtest_fixtures.hpp"
+#include <cmath>
+#include <complex>
+
+namespace {
+  using LinearAlgebra::conjugated;
+  using LinearAlgebra::explicit_diagonal;
+  using LinearAlgebra::explicit_diagonal_t;
+  using LinearAlgebra::implicit_unit_diagonal;
+  using LinearAlgebra::lower_triangle;
+  using LinearAlgebra::lower_triangle_t;
+  using LinearAlgebra::scaled;
+  using LinearAlgebra::transposed;
+  using LinearAlgebra::triangular_matrix_vector_solve;
+  using LinearAlgebra::upper_triangle;
+
+  // Solves A*x = b for x_true with integer entries and b = A*x_true,
+  // where A is n x n, diagonally dominant, and filled with junk outside
+  // the triangle that the solve may read.  n = 150 takes the blocked
+  // solve through full and partial blocks and panels.  x may be
+  // strided.
+  template<class Scalar, class Layout, class Triangle, class DiagonalStorage>
+  void test_trsv(Triangle t, DiagonalStorage d, std::size_t incx = 1)
+  {
+    constexpr bool lower = std::is_same_v<Triangle, lower_triangle_t>;
+    constexpr bool explicit_diag = std::is_same_v<DiagonalStorage, explicit_diagonal_t>;
+    const std::size_t n = 150;
+
+    std::vector<Scalar> A_mem(n * n);
+    mdspan<Scalar, dextents<std::size_t, 2>, Layout> A(A_mem.data(), n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        const bool stored = lower ? j < i : j > i;
+        if (i == j) {
+          A(i,j) = explicit_diag ? Scalar(4.0 + double(i % 3)) : Scalar(-1.0e6);
+        } else if (stored) {
+          A(i,j) = test_value<Scalar>(int(3 * i + 5 * j), 9) / Scalar(double(n));
+        } else {
+          A(i,j) = Scalar(1.0e6);
+        }
+      }
+    }
+
+    std::vector<Scalar> x_true(n), b_mem(n);
+    std::vector<Scalar> x_mem(n * incx, Scalar(7.0));
+    for (std::size_t i = 0; i < n; ++i) {
+      x_true[i] = test_value<Scalar>(int(i), 9);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      Scalar sum = explicit_diag ? A(i,i) * x_true[i] : x_true[i];
+      for (std::size_t j = lower ? 0 : i + 1; j < (lower ? i : n); ++j) {
+        sum += A(i,j) * x_true[j];
+      }
+      b_mem[i] = sum;
+    }
+
+    mdspan<const Scalar, dextents<std::size_t, 1>> b(b_mem.data(), n);
+    layout_stride::mapping<dextents<std::size_t, 1>> x_mapping(
+      dextents<std::size_t, 1>(n), std::array<std::size_t, 1>{incx});
+    mdspan<Scalar, dextents<std::size_t, 1>, layout_stride> x(x_mem.data(), x_mapping);
+
+    triangular_matrix_vector_solve(A, t, d, b, x);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(std::abs(x(i) - x_true[i]), 0.0, 1.0e-10);
+    }
+  }
+
+  template<class Scalar, class Layout>
+  void test_trsv_all_cases()
+  {
+    test_trsv<Scalar, Layout>(lower_triangle, explicit_diagonal);
+    test_trsv<Scalar, Layout>(lower_triangle, implicit_unit_diagonal);
+    test_trsv<Scalar, Layout>(upper_triangle, explicit_diagonal);
+    test_trsv<Scalar, Layout>(upper_triangle, implicit_unit_diagonal);
+    test_trsv<Scalar, Layout>(lower_triangle, explicit_diagonal, 3);
+    test_trsv<Scalar, Layout>(upper_triangle, implicit_unit_diagonal, 2);
+  }
+
+  TEST(BLAS2_trsv, double_layout_left)
+  {
+    test_trsv_all_cases<double, layout_left>();
+  }
+
+  TEST(BLAS2_trsv, double_layout_right)
+  {
+    test_trsv_all_cases<double, layout_right>();
+  }
+
+  TEST(BLAS2_trsv, complex_layout_left)
+  {
+    test_trsv_all_cases<std::complex<double>, layout_left>();
+  }
+
+  TEST(BLAS2_trsv, complex_layout_right)
+  {
+    test_trsv_all_cases<std::complex<double>, layout_right>();
+  }
+
+  // Scaled, conjugated and transposed views of A take the blocked
+  // solve too; compare them with solves with the same matrix stored
+  // explicitly.
+  TEST(BLAS2_trsv, views)
+  {
+    using complex_t = std::complex<double>;
+    const std::size_t n = 100;
+    using matrix_t = mdspan<complex_t, dextents<std::size_t, 2>, layout_left>;
+    using vector_t = mdspan<complex_t, dextents<std::size_t, 1>>;
+    static_assert(LinearAlgebra::impl::blocked_trsv_eligible<
+      decltype(scaled(complex_t(2.0, 1.0), conjugated(transposed(std::declval<matrix_t>())))),
+      vector_t>());
+
+    std::vector<complex_t> A_mem(n * n), B_mem(n * n);
+    matrix_t A(A_mem.data(), n, n);
+    matrix_t B(B_mem.data(), n, n);
+    const complex_t alpha(2.0, 1.0);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A(i,j) = i == j ? complex_t(3.0, 1.0) :
+          test_value<complex_t>(int(2 * i + 7 * j), 9) / double(n);
+      }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        B(i,j) = alpha * std::conj(A(j,i));
+      }
+    }
+
+    std::vector<complex_t> b_mem(n), x_mem(n), y_mem(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      b_mem[i] = test_value<complex_t>(int(i), 9);
+    }
+    vector_t b(b_mem.data(), n);
+    vector_t x(x_mem.data(), n);
+    vector_t y(y_mem.data(), n);
+
+    triangular_matrix_vector_solve(scaled(alpha, conjugated(transposed(A))),
+                                   lower_triangle, explicit_diagonal, b, x);
+    triangular_matrix_vector_solve(B, lower_triangle, explicit_diagonal, b, y);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(std::abs(x(i) - y(i)), 0.0, 1.0e-12);
+    }
+
+    triangular_matrix_vector_solve(scaled(alpha, conjugated(transposed(A))),
+                                   upper_triangle, implicit_unit_diagonal, b, x);
+    triangular_matrix_vector_solve(B, upper_triangle, implicit_unit_diagonal, b, y);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(std::abs(x(i) - y(i)), 0.0, 1.0e-12);
+    }
+  }
+
+} // end anonymous namespace